@@ -2,9 +2,11 @@
 
 function usage()
 {
-    echo "dsn.cg %name%.thrift|.proto cpp|csharp|js %out_dir% [format = binary|json] [mode = single]".PHP_EOL;
-    echo "\tformat - use binary(default) or json format to send rpc request/response".PHP_EOL;
+    echo "dsn.cg %name%.thrift|.proto cpp|csharp|js %out_dir% [format = binary|compact|json] [mode = single] [templates]".PHP_EOL;
+    echo "\tformat - use binary(default), compact or json format to send rpc request/response".PHP_EOL;
+    echo "\ttemplates - generate thrift cpp types with read/write templated on the concrete protocol".PHP_EOL;
     echo "\tnotice : currently for js we only support json format of thrift".PHP_EOL;
+    echo "\tnotice : compact format and templates are only supported for cpp with thrift".PHP_EOL;
 }
 
 if (count($argv) < 4)
@@ -24,6 +26,7 @@ global $g_program;
 global $g_idl_php;
 global $g_idl_format;
 global $g_mode;
+global $g_templated;
 
 $g_idl = $argv[1];
 $g_lang = $argv[2];
@@ -36,6 +39,7 @@ $g_idl_post = "";
 $g_program = "";
 $g_idl_php = "";
 $g_idl_format = "";
+$g_templated = false;
 
 if (strtoupper(substr(PHP_OS, 0, 3)) === 'WIN') 
 {
@@ -53,6 +57,10 @@ if (count($argv) >= 5)
     {
         $g_idl_format = "binary";
     }
+    else if ($format_input == "compact")
+    {
+        $g_idl_format = "compact";
+    }
     else
     {
         echo "invalid format '$format_input'".PHP_EOL;
@@ -81,6 +89,20 @@ if ($g_mode != "single" && $g_mode != "replication" && $g_mode != "layer3")
     exit(0);
 }
 
+if (count($argv) >= 7)
+{
+    if ($argv[6] == "templates")
+    {
+        $g_templated = true;
+    }
+    else
+    {
+        echo "invalid option '$argv[6]'".PHP_EOL;
+        usage();
+        exit(0);
+    }
+}
+
 if (!file_exists($g_idl))
 {
     echo "input file '". $g_idl ."' is not found.".PHP_EOL;
@@ -119,6 +141,12 @@ if ($g_lang == "js" && ($g_idl_type != "thrift" || $g_idl_format != "json"))
     exit(0);
 }
 
+if (($g_idl_format == "compact" || $g_templated) && ($g_idl_type != "thrift" || $g_lang != "cpp"))
+{
+    echo "compact format and templates are only supported for cpp with thrift, please check your arguments.".PHP_EOL;
+    exit(0);
+}
+
 $pos = strrpos($g_idl, "\\");
 $pos2 = strrpos($g_idl, "/");
 if ($pos == FALSE && $pos2 == FALSE)
@@ -168,6 +196,11 @@ case "thrift":
         if ($g_lang == "cpp")
         {
             $lang_with_options = $g_lang.":moveable_types";
+            if ($g_templated)
+            {
+                // read/write are templated on the protocol and emitted to %name%_types.tcc
+                $lang_with_options = $lang_with_options.",templates";
+            }
         }
         $command = $g_cg_dir."/".$os_name."/thrift --gen ".$lang_with_options." -out ".$g_out_dir." ".$g_idl;
         echo "exec: ".$command.PHP_EOL;
@@ -13,6 +13,7 @@ thrift_description = [
     {
         "name": "dsn.layer2",
         "path": "src",
+        "templates": True,
         "include_fix": {
             ".types.h": {
                 "add": ["<dsn/cpp/serialization_helper/dsn.layer2_types.h>"],
@@ -25,10 +26,14 @@ thrift_description = [
             "_types.cpp": {
                 "add": ["<dsn/cpp/serialization_helper/dsn.layer2_types.h>"],
                 "remove": ["\"dsn.layer2_types.h\""]
+            },
+            "_types.tcc": {
+                "add": ["<dsn/cpp/serialization_helper/dsn.layer2_types.h>"],
+                "remove": ["\"dsn_types.tcc\"", "\"dsn.layer2_types.h\""]
             }
         },
         "file_move": {
-            ".types.h _types.h": "include/dsn/cpp/serialization_helper",
+            ".types.h _types.h _types.tcc": "include/dsn/cpp/serialization_helper",
             "_types.cpp": "src/dev/cpp"
         }
     },
@@ -56,8 +61,9 @@ thrift_description = [
     {
         "name": "replication", 
         "path": "src/dist/replication", 
+        "templates": True,
         "file_move": {
-            ".types.h _types.h": "include/dsn/dist/replication",
+            ".types.h _types.h _types.tcc": "include/dsn/dist/replication",
             "_types.cpp": "src/dist/replication/client_lib"
         },
         "include_fix": {
@@ -69,6 +75,10 @@ thrift_description = [
                 "add": ["<dsn/dist/replication/replication_types.h>"],
                 "remove": ["\"replication_types.h\""]
             },
+            "_types.tcc": {
+                "add": ["<dsn/dist/replication/replication_types.h>"],
+                "remove": ["\"dsn_types.tcc\"", "\"dsn.layer2_types.tcc\"", "\"replication_types.h\""]
+            },
             ".types.h": {
                 "add": ["<dsn/dist/replication/replication_types.h>"],
                 "remove": ["\"replication_types.h\""]
@@ -263,11 +273,17 @@ def compile_thrift_file(thrift_info):
     os.system("rm -rf output")
     os.system("mkdir output")
     #### first generate .types.h
-    os.system("%s %s.thrift cpp build binary"%(env_tools["dsn_gentool"], thrift_name))
+    if thrift_info.get("templates", False):
+        # read/write of the types are templated on the concrete protocol, see thrift_helper.h
+        os.system("%s %s.thrift cpp build binary single templates"%(env_tools["dsn_gentool"], thrift_name))
+    else:
+        os.system("%s %s.thrift cpp build binary"%(env_tools["dsn_gentool"], thrift_name))
 
     os.system("cp build/%s.types.h output"%(thrift_name))
     os.system("cp build/%s_types.h output"%(thrift_name))
     os.system("cp build/%s_types.cpp output"%(thrift_name))
+    if thrift_info.get("templates", False):
+        os.system("cp build/%s_types.tcc output"%(thrift_name))
     os.system("rm -rf build")
 
     if "include_fix" in thrift_info:
@@ -410,6 +426,9 @@ if __name__ == "__main__":
     add_hook("simple_kv", "src/apps/skv", constructor_hook, ["simple_kv_types.h", "kv_pair", ctor_kv_pair])
     add_hook("replication", "src/dist/replication", constructor_hook, ["replication_types.h", "configuration_proposal_action", ctor_configuration_proposal_action])
     add_hook("dsn.layer2", "src", replace_hook, ["dsn.layer2_types.h", {r"dsn\.layer2_TYPES_H": 'dsn_layer2_TYPES_H'}])
+    add_hook("dsn.layer2", "src", replace_hook, ["dsn.layer2_types.h", {r'"dsn\.layer2_types\.tcc"': '<dsn/cpp/serialization_helper/dsn.layer2_types.tcc>'}])
+    add_hook("dsn.layer2", "src", replace_hook, ["dsn.layer2_types.tcc", {r"dsn\.layer2_TYPES_TCC": 'dsn_layer2_TYPES_TCC'}])
+    add_hook("replication", "src/dist/replication", replace_hook, ["replication_types.h", {r'"replication_types\.tcc"': '<dsn/dist/replication/replication_types.tcc>'}])
 
     if len(sys.argv)>1:
         for i in sys.argv[1:]:
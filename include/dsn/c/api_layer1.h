@@ -291,6 +291,17 @@ extern DSN_API dsn::error_code dsn_task_error(dsn_task_t task);
  */
 extern DSN_API bool dsn_task_is_running_inside(dsn_task_t t);
 
+/*!
+ check whether a task with the given code and hash would be executed by the worker
+ thread which is running the current task, so that the task body can be run inline
+
+ \param code task code of the task
+ \param hash hash value of the task
+
+ \return true if it is.
+ */
+extern DSN_API bool dsn_task_shares_current_worker(dsn::task_code code, int hash);
+
 /*!
  task trackers are used to track task context
 
@@ -647,7 +658,9 @@ dsn_msg_create_received_request(dsn::task_code rpc_code,
 
 /*! type of the parameter in \ref dsn_msg_context_t */
 typedef enum dsn_msg_parameter_type_t {
-    MSG_PARAM_NONE = 0, ///< nothing
+    MSG_PARAM_NONE = 0,           ///< nothing
+    MSG_PARAM_READ_STALENESS = 1, ///< read can be served by secondaries whose committed decree
+                                  ///< lags at most "parameter" decrees behind the primary
 } dsn_msg_parameter_type_t;
 
 /*! RPC message context */
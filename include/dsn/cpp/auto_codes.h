@@ -138,6 +138,12 @@ public:
 #ifdef DSN_USE_THRIFT_SERIALIZATION
     uint32_t read(::apache::thrift::protocol::TProtocol *iprot);
     uint32_t write(::apache::thrift::protocol::TProtocol *oprot) const;
+
+    // on the concrete protocols, see thrift_helper.h
+    template <typename TProto>
+    uint32_t read(TProto *iprot);
+    template <typename TProto>
+    uint32_t write(TProto *oprot) const;
 #endif
 };
 }
@@ -0,0 +1,202 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015 Microsoft Corporation
+ *
+ * -=- Robust Distributed System Nucleus (rDSN) -=-
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * Description:
+ *     stackless coroutines atop tasking, rpc and file apis
+ *
+ * Revision history:
+ *     xxxx-xx-xx, author, first version
+ *     xxxx-xx-xx, author, fix bug about xxx
+ */
+
+#pragma once
+
+#include <dsn/cpp/clientlet.h>
+#include <dsn/utility/synchronize.h>
+#include <atomic>
+
+namespace dsn {
+
+//
+// a coroutine turns a chain of callbacks into one sequential body:
+//
+//    class learn_round : public coroutine
+//    {
+//        void run() override
+//        {
+//            DSN_CO_BEGIN
+//            DSN_CO_AWAIT(await_rpc(_primary, RPC_LEARN, _request));
+//            unmarshall_response(_response);
+//            ...
+//            DSN_CO_AWAIT(await_task(LPC_LEARN_DONE, _hash, std::chrono::seconds(1)));
+//            ...
+//            DSN_CO_END
+//        }
+//    };
+//
+//    task_ptr t = (new learn_round(...))->start();
+//
+// the body resumes right after an await when the awaited task completes, with co_err,
+// co_io_size and co_response telling the result.
+//
+// as this is stackless (c++14 has no co_await), the states used across awaits must be
+// members of the coroutine, locals must be scoped in { } between two awaits, and there
+// must be at most one DSN_CO_AWAIT per line.
+//
+// the whole flow allocates one coroutine (from transient memory) rather than a callback
+// object per step, and each step allocates its native task only, or nothing at all when
+// await_task() finds the target worker is the current one and resumes inline.
+//
+// a coroutine is also a task handle referring to the task it is waiting on, so it can be
+// kept in a task_ptr and cancelled like a normal task, after which it never resumes.
+// cancel() may be called on a thread other than the one running the body (e.g., the body
+// runs on the LONG pool while the replica thread cleans up), as the task it is waiting on
+// is switched under a lock.
+//
+class coroutine : public safe_task_handle, public transient_object
+{
+public:
+    explicit coroutine(clientlet *svc = nullptr)
+        : co_io_size(0), co_response(nullptr), _co_line(0), _svc(svc), _cancelled(false)
+    {
+    }
+
+    // run the body on the calling thread until its first suspension
+    task_ptr start();
+
+    bool is_done() const { return _co_line == -1; }
+
+    virtual bool cancel(bool wait_until_finished, bool *finished = nullptr) override;
+
+protected:
+    virtual void run() = 0;
+
+    //
+    // the await_xxx routines return true when they complete inline so there is no suspension
+    //
+
+    // resume on the worker of the given task code and hash after the delay
+    bool await_task(dsn::task_code code,
+                    int hash = 0,
+                    std::chrono::milliseconds delay = std::chrono::milliseconds(0));
+
+    bool await_rpc(::dsn::rpc_address server, dsn_message_t request, int reply_thread_hash = 0);
+
+    template <typename TRequest>
+    bool await_rpc(::dsn::rpc_address server,
+                   dsn::task_code code,
+                   const TRequest &req,
+                   std::chrono::milliseconds timeout = std::chrono::milliseconds(0),
+                   int thread_hash = 0,
+                   uint64_t partition_hash = 0,
+                   int reply_thread_hash = 0)
+    {
+        dsn_message_t msg = dsn_msg_create_request(
+            code, static_cast<int>(timeout.count()), thread_hash, partition_hash);
+        ::dsn::marshall(msg, req);
+        return await_rpc(server, msg, reply_thread_hash);
+    }
+
+    // co_response is only valid until the next await
+    template <typename TResponse>
+    void unmarshall_response(TResponse &resp)
+    {
+        if (co_err == ERR_OK) {
+            ::dsn::unmarshall(co_response, resp);
+        }
+    }
+
+    bool await_read(dsn_handle_t fh,
+                    char *buffer,
+                    int count,
+                    uint64_t offset,
+                    dsn::task_code callback_code,
+                    int hash = 0);
+
+    bool await_write(dsn_handle_t fh,
+                     const char *buffer,
+                     int count,
+                     uint64_t offset,
+                     dsn::task_code callback_code,
+                     int hash = 0);
+
+    bool await_copy_remote_files(::dsn::rpc_address remote,
+                                 const std::string &source_dir,
+                                 const std::vector<std::string> &files, // empty for all
+                                 const std::string &dest_dir,
+                                 bool overwrite,
+                                 bool high_priority,
+                                 dsn::task_code callback_code,
+                                 int hash = 0);
+
+protected:
+    // results of the last await
+    error_code co_err;
+    size_t co_io_size;
+    dsn_message_t co_response;
+
+    // resume point, 0 for not started and -1 for done
+    int _co_line;
+
+private:
+    dsn_task_tracker_t tracker() const { return _svc ? _svc->tracker() : nullptr; }
+    void suspend_on(dsn_task_t t);
+
+    static void exec(void *co);
+    static void exec_rpc_response(error_code err, dsn_message_t req, dsn_message_t resp, void *co);
+    static void exec_aio(error_code err, size_t sz, void *co);
+    static void on_cancel(void *co);
+
+    clientlet *_svc;
+    utils::ex_lock_nr_spin _task_lock; // protects switching the task waited on
+    std::atomic<bool> _cancelled;
+};
+
+#define DSN_CO_BEGIN                                                                               \
+    switch (this->_co_line) {                                                                      \
+    case 0:
+
+#define DSN_CO_AWAIT(await_expr)                                                                   \
+    do {                                                                                           \
+        this->_co_line = __LINE__;                                                                 \
+        if (!(await_expr))                                                                         \
+            return;                                                                                \
+    case __LINE__:;                                                                                \
+    } while (0)
+
+#define DSN_CO_RETURN                                                                              \
+    do {                                                                                           \
+        this->_co_line = -1;                                                                       \
+        return;                                                                                    \
+    } while (0)
+
+#define DSN_CO_END                                                                                 \
+    default:                                                                                       \
+        break;                                                                                     \
+    }                                                                                              \
+    this->_co_line = -1;
+}
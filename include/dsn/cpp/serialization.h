@@ -69,6 +69,9 @@ std::string no_registered_function_error_notice(const T &t, dsn_msg_serialize_fo
     case DSF_THRIFT_BINARY:                                                                        \
         marshall_thrift_binary(writer, value);                                                     \
         break;                                                                                     \
+    case DSF_THRIFT_COMPACT:                                                                       \
+        marshall_thrift_compact(writer, value);                                                    \
+        break;                                                                                     \
     case DSF_THRIFT_JSON:                                                                          \
         marshall_thrift_json(writer, value);                                                       \
         break;
@@ -77,6 +80,9 @@ std::string no_registered_function_error_notice(const T &t, dsn_msg_serialize_fo
     case DSF_THRIFT_BINARY:                                                                        \
         unmarshall_thrift_binary(reader, value);                                                   \
         break;                                                                                     \
+    case DSF_THRIFT_COMPACT:                                                                       \
+        unmarshall_thrift_compact(reader, value);                                                  \
+        break;                                                                                     \
     case DSF_THRIFT_JSON:                                                                          \
         unmarshall_thrift_json(reader, value);                                                     \
         break;
@@ -119,8 +119,10 @@ class partition_configuration {
 
   bool operator < (const partition_configuration & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -173,8 +175,10 @@ class configuration_query_by_index_request {
 
   bool operator < (const configuration_query_by_index_request & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -245,8 +249,10 @@ class configuration_query_by_index_response {
 
   bool operator < (const configuration_query_by_index_response & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -343,8 +349,10 @@ class app_info {
 
   bool operator < (const app_info & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -359,4 +367,6 @@ inline std::ostream& operator<<(std::ostream& out, const app_info& obj)
 
 } // namespace
 
+#include <dsn/cpp/serialization_helper/dsn.layer2_types.tcc>
+
 #endif
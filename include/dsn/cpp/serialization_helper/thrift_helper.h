@@ -32,6 +32,7 @@
  *     xxxx-xx-xx, author, first version
  *     2016-02-24, Weijie Sun(sunweijie[at]xiaomi.com), add support for serialization in thrift
  *     2016-03-01, Weijie Sun(sunweijie[at]xiaomi.com), add support for rpc in thrift
+ *     xxxx-xx-xx, author, codecs templated on the concrete protocols, add compact protocol
  */
 
 #pragma once
@@ -41,6 +42,7 @@
 
 #include <thrift/Thrift.h>
 #include <thrift/protocol/TBinaryProtocol.h>
+#include <thrift/protocol/TCompactProtocol.h>
 #include <thrift/protocol/TJSONProtocol.h>
 #include <thrift/protocol/TVirtualProtocol.h>
 #include <thrift/transport/TVirtualTransport.h>
@@ -95,12 +97,148 @@ private:
     binary_writer &_writer;
 };
 
+//
+// like TBinaryProtocolT, the compact protocol here reads and writes any string type
+// with data()/size(), so that blobs and names are not copied through std::string
+//
+template <class Transport_>
+class thrift_compact_protocol : public ::apache::thrift::protocol::TCompactProtocolT<Transport_>
+{
+    typedef ::apache::thrift::protocol::TCompactProtocolT<Transport_> base_type;
+
+public:
+    thrift_compact_protocol(boost::shared_ptr<Transport_> trans) : base_type(trans) {}
+
+    using base_type::writeString;
+    using base_type::readString;
+
+    template <typename StrType>
+    uint32_t writeString(const StrType &str)
+    {
+        uint32_t ssize = static_cast<uint32_t>(str.size());
+        uint32_t wsize = this->writeVarint32(ssize);
+        this->trans_->write(reinterpret_cast<const uint8_t *>(str.data()), ssize);
+        return wsize + ssize;
+    }
+
+    template <typename StrType>
+    uint32_t readString(StrType &str)
+    {
+        using ::apache::thrift::protocol::TProtocolException;
+
+        int32_t size;
+        uint32_t rsize = this->readVarint32(size);
+        if (size < 0) {
+            throw TProtocolException(TProtocolException::NEGATIVE_SIZE);
+        }
+        if (this->string_limit_ > 0 && size > this->string_limit_) {
+            throw TProtocolException(TProtocolException::SIZE_LIMIT);
+        }
+        str.resize(size);
+        if (size > 0) {
+            this->trans_->readAll(reinterpret_cast<uint8_t *>(&str[0]), size);
+        }
+        return rsize + static_cast<uint32_t>(size);
+    }
+};
+
+//
+// the concrete protocols used by marshall_thrift_xxx, the codecs are instantiated on them
+// so all calls down to binary_writer/binary_reader are direct and can be inlined
+//
+typedef ::apache::thrift::protocol::TBinaryProtocolT<binary_writer_transport>
+    thrift_binary_writer_protocol;
+typedef ::apache::thrift::protocol::TBinaryProtocolT<binary_reader_transport>
+    thrift_binary_reader_protocol;
+typedef thrift_compact_protocol<binary_writer_transport> thrift_compact_writer_protocol;
+typedef thrift_compact_protocol<binary_reader_transport> thrift_compact_reader_protocol;
+
+// json carries rpc_address, gpid, task_code and error_code as structs to be readable,
+// while binary and compact carry them as plain values
+template <typename TProto>
+struct is_thrift_json_protocol
+    : std::is_base_of<::apache::thrift::protocol::TJSONProtocol, TProto>
+{
+};
+
+template <typename TProto, typename TString>
+inline uint32_t write_thrift_string(TProto *oprot, const TString &str, std::false_type)
+{
+    return oprot->template writeString<TString>(str);
+}
+
+template <typename TProto, typename TString>
+inline uint32_t write_thrift_string(TProto *oprot, const TString &str, std::true_type)
+{
+    return oprot->writeBinary(std::string(str.data(), str.size()));
+}
+
+template <typename TProto, typename TString>
+inline uint32_t read_thrift_string(TProto *iprot, TString &str, std::false_type)
+{
+    return iprot->template readString<TString>(str);
+}
+
+template <typename TProto, typename TString>
+inline uint32_t read_thrift_string(TProto *iprot, TString &str, std::true_type)
+{
+    std::string buffer;
+    uint32_t xfer = iprot->readBinary(buffer);
+    str.assign(buffer.data(), buffer.size());
+    return xfer;
+}
+
+//
+// the thrift types generated without templates call read/write with the virtual TProtocol,
+// these find out the concrete protocol once and go on with the inlined codecs
+//
+template <typename T>
+inline uint32_t read_from_thrift_protocol(T &value, ::apache::thrift::protocol::TProtocol *iprot)
+{
+    if (auto p = dynamic_cast<thrift_binary_reader_protocol *>(iprot)) {
+        return value.read(p);
+    }
+    if (auto p = dynamic_cast<thrift_compact_reader_protocol *>(iprot)) {
+        return value.read(p);
+    }
+    if (auto p = dynamic_cast<::apache::thrift::protocol::TJSONProtocol *>(iprot)) {
+        return value.read(p);
+    }
+    if (auto p = dynamic_cast<::apache::thrift::protocol::TBinaryProtocol *>(iprot)) {
+        return value.read(p);
+    }
+    dassert(false, "unsupported thrift protocol %s", typeid(*iprot).name());
+    return 0;
+}
+
+template <typename T>
+inline uint32_t write_to_thrift_protocol(const T &value,
+                                         ::apache::thrift::protocol::TProtocol *oprot)
+{
+    if (auto p = dynamic_cast<thrift_binary_writer_protocol *>(oprot)) {
+        return value.write(p);
+    }
+    if (auto p = dynamic_cast<thrift_compact_writer_protocol *>(oprot)) {
+        return value.write(p);
+    }
+    if (auto p = dynamic_cast<::apache::thrift::protocol::TJSONProtocol *>(oprot)) {
+        return value.write(p);
+    }
+    if (auto p = dynamic_cast<::apache::thrift::protocol::TBinaryProtocol *>(oprot)) {
+        return value.write(p);
+    }
+    dassert(false, "unsupported thrift protocol %s", typeid(*oprot).name());
+    return 0;
+}
+
 #define DEFINE_THRIFT_BASE_TYPE_SERIALIZATION(TName, TRealName, TTag, TMethod)                     \
-    inline uint32_t write_base(::apache::thrift::protocol::TProtocol *proto, const TName &val)     \
+    template <typename TProto>                                                                     \
+    inline uint32_t write_base(TProto *proto, const TName &val)                                    \
     {                                                                                              \
         return proto->write##TMethod((const TRealName &)val);                                      \
     }                                                                                              \
-    inline uint32_t read_base(::apache::thrift::protocol::TProtocol *proto, /*out*/ TName &val)    \
+    template <typename TProto>                                                                     \
+    inline uint32_t read_base(TProto *proto, /*out*/ TName &val)                                   \
     {                                                                                              \
         return proto->read##TMethod((TRealName &)val);                                             \
     }
@@ -117,13 +255,13 @@ DEFINE_THRIFT_BASE_TYPE_SERIALIZATION(uint64_t, int64_t, I64, I64)
 DEFINE_THRIFT_BASE_TYPE_SERIALIZATION(double, double, DOUBLE, Double)
 DEFINE_THRIFT_BASE_TYPE_SERIALIZATION(std::string, std::string, STRING, String)
 
-template <typename T>
-uint32_t marshall_base(::apache::thrift::protocol::TProtocol *oproto, const T &val);
-template <typename T>
-uint32_t unmarshall_base(::apache::thrift::protocol::TProtocol *iproto, T &val);
+template <typename T, typename TProto>
+uint32_t marshall_base(TProto *oproto, const T &val);
+template <typename T, typename TProto>
+uint32_t unmarshall_base(TProto *iproto, T &val);
 
-template <typename T>
-inline uint32_t write_base(::apache::thrift::protocol::TProtocol *oprot, const std::vector<T> &val)
+template <typename TProto, typename T>
+inline uint32_t write_base(TProto *oprot, const std::vector<T> &val)
 {
     uint32_t xfer = oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT,
                                           static_cast<uint32_t>(val.size()));
@@ -134,8 +272,8 @@ inline uint32_t write_base(::apache::thrift::protocol::TProtocol *oprot, const s
     return xfer;
 }
 
-template <typename T>
-inline uint32_t read_base(::apache::thrift::protocol::TProtocol *iprot, std::vector<T> &val)
+template <typename TProto, typename T>
+inline uint32_t read_base(TProto *iprot, std::vector<T> &val)
 {
     uint32_t xfer = 0;
 
@@ -152,9 +290,8 @@ inline uint32_t read_base(::apache::thrift::protocol::TProtocol *iprot, std::vec
     return xfer;
 }
 
-template <typename T_KEY, typename T_VALUE>
-inline uint32_t write_base(::apache::thrift::protocol::TProtocol *oprot,
-                           const std::map<T_KEY, T_VALUE> &val)
+template <typename TProto, typename T_KEY, typename T_VALUE>
+inline uint32_t write_base(TProto *oprot, const std::map<T_KEY, T_VALUE> &val)
 {
     uint32_t xfer = 0;
 
@@ -170,9 +307,8 @@ inline uint32_t write_base(::apache::thrift::protocol::TProtocol *oprot,
     return xfer;
 }
 
-template <typename T_KEY, typename T_VALUE>
-inline uint32_t read_base(::apache::thrift::protocol::TProtocol *iprot,
-                          std::map<T_KEY, T_VALUE> &val)
+template <typename TProto, typename T_KEY, typename T_VALUE>
+inline uint32_t read_base(TProto *iprot, std::map<T_KEY, T_VALUE> &val)
 {
     int xfer = 0;
 
@@ -229,12 +365,11 @@ public:
     char &operator[](int pos) { return const_cast<char *>(_buffer.data())[pos]; }
 };
 
-inline uint32_t rpc_address::read(apache::thrift::protocol::TProtocol *iprot)
+template <typename TProto>
+inline uint32_t rpc_address::read(TProto *iprot)
 {
-    apache::thrift::protocol::TBinaryProtocol *binary_proto =
-        dynamic_cast<apache::thrift::protocol::TBinaryProtocol *>(iprot);
-    if (binary_proto != nullptr) {
-        // the protocol is binary protocol
+    if (!is_thrift_json_protocol<TProto>::value) {
+        // the protocol is binary or compact protocol
         auto r = iprot->readI64(reinterpret_cast<int64_t &>(_addr.u.value));
         dassert(_addr.u.v4.type == HOST_TYPE_INVALID || _addr.u.v4.type == HOST_TYPE_IPV4,
                 "only invalid or ipv4 can be deserialized from binary");
@@ -289,12 +424,11 @@ inline uint32_t rpc_address::read(apache::thrift::protocol::TProtocol *iprot)
     }
 }
 
-inline uint32_t rpc_address::write(apache::thrift::protocol::TProtocol *oprot) const
+template <typename TProto>
+inline uint32_t rpc_address::write(TProto *oprot) const
 {
-    apache::thrift::protocol::TBinaryProtocol *binary_proto =
-        dynamic_cast<apache::thrift::protocol::TBinaryProtocol *>(oprot);
-    if (binary_proto != nullptr) {
-        // the protocol is binary protocol
+    if (!is_thrift_json_protocol<TProto>::value) {
+        // the protocol is binary or compact protocol
         dassert(_addr.u.v4.type == HOST_TYPE_INVALID || _addr.u.v4.type == HOST_TYPE_IPV4,
                 "only invalid or ipv4 can be serialized to binary");
         return oprot->writeI64((int64_t)_addr.u.value);
@@ -326,12 +460,11 @@ inline uint32_t rpc_address::write(apache::thrift::protocol::TProtocol *oprot) c
     }
 }
 
-inline uint32_t gpid::read(apache::thrift::protocol::TProtocol *iprot)
+template <typename TProto>
+inline uint32_t gpid::read(TProto *iprot)
 {
-    apache::thrift::protocol::TBinaryProtocol *binary_proto =
-        dynamic_cast<apache::thrift::protocol::TBinaryProtocol *>(iprot);
-    if (binary_proto != nullptr) {
-        // the protocol is binary protocol
+    if (!is_thrift_json_protocol<TProto>::value) {
+        // the protocol is binary or compact protocol
         return iprot->readI64(reinterpret_cast<int64_t &>(_value.value));
     } else {
         // the protocol is json protocol
@@ -370,12 +503,11 @@ inline uint32_t gpid::read(apache::thrift::protocol::TProtocol *iprot)
     }
 }
 
-inline uint32_t gpid::write(apache::thrift::protocol::TProtocol *oprot) const
+template <typename TProto>
+inline uint32_t gpid::write(TProto *oprot) const
 {
-    apache::thrift::protocol::TBinaryProtocol *binary_proto =
-        dynamic_cast<apache::thrift::protocol::TBinaryProtocol *>(oprot);
-    if (binary_proto != nullptr) {
-        // the protocol is binary protocol
+    if (!is_thrift_json_protocol<TProto>::value) {
+        // the protocol is binary or compact protocol
         return oprot->writeI64((int64_t)_value.value);
     } else {
         // the protocol is json protocol
@@ -393,14 +525,13 @@ inline uint32_t gpid::write(apache::thrift::protocol::TProtocol *oprot) const
     }
 }
 
-inline uint32_t task_code::read(apache::thrift::protocol::TProtocol *iprot)
+template <typename TProto>
+inline uint32_t task_code::read(TProto *iprot)
 {
     std::string task_code_string;
     uint32_t xfer = 0;
-    apache::thrift::protocol::TBinaryProtocol *binary_proto =
-        dynamic_cast<apache::thrift::protocol::TBinaryProtocol *>(iprot);
-    if (binary_proto != nullptr) {
-        // the protocol is binary protocol
+    if (!is_thrift_json_protocol<TProto>::value) {
+        // the protocol is binary or compact protocol
         xfer += iprot->readString(task_code_string);
     } else {
         // the protocol is json protocol
@@ -438,14 +569,15 @@ inline uint32_t task_code::read(apache::thrift::protocol::TProtocol *iprot)
     return xfer;
 }
 
-inline uint32_t task_code::write(apache::thrift::protocol::TProtocol *oprot) const
+template <typename TProto>
+inline uint32_t task_code::write(TProto *oprot) const
 {
     const char *name = to_string();
-    apache::thrift::protocol::TBinaryProtocol *binary_proto =
-        dynamic_cast<apache::thrift::protocol::TBinaryProtocol *>(oprot);
-    if (binary_proto != nullptr) {
-        // the protocol is binary protocol
-        return binary_proto->writeString<char_ptr>(char_ptr(name, static_cast<int>(strlen(name))));
+    if (!is_thrift_json_protocol<TProto>::value) {
+        // the protocol is binary or compact protocol
+        return write_thrift_string(oprot,
+                                   char_ptr(name, static_cast<int>(strlen(name))),
+                                   is_thrift_json_protocol<TProto>());
     } else {
         // the protocol is json protocol
         uint32_t xfer = 0;
@@ -461,30 +593,28 @@ inline uint32_t task_code::write(apache::thrift::protocol::TProtocol *oprot) con
     }
 }
 
-inline uint32_t blob::read(apache::thrift::protocol::TProtocol *iprot)
+template <typename TProto>
+inline uint32_t blob::read(TProto *iprot)
 {
-    // for optimization, it is dangerous if the oprot is not a binary proto
-    apache::thrift::protocol::TBinaryProtocol *binary_proto =
-        static_cast<apache::thrift::protocol::TBinaryProtocol *>(iprot);
+    // binary and compact read into the blob directly, json goes through base64
     blob_string str(*this);
-    return binary_proto->readString<blob_string>(str);
+    return read_thrift_string(iprot, str, is_thrift_json_protocol<TProto>());
 }
 
-inline uint32_t blob::write(apache::thrift::protocol::TProtocol *oprot) const
+template <typename TProto>
+inline uint32_t blob::write(TProto *oprot) const
 {
-    apache::thrift::protocol::TBinaryProtocol *binary_proto =
-        static_cast<apache::thrift::protocol::TBinaryProtocol *>(oprot);
-    return binary_proto->writeString<blob_string>(blob_string(const_cast<blob &>(*this)));
+    return write_thrift_string(
+        oprot, blob_string(const_cast<blob &>(*this)), is_thrift_json_protocol<TProto>());
 }
 
-inline uint32_t error_code::read(apache::thrift::protocol::TProtocol *iprot)
+template <typename TProto>
+inline uint32_t error_code::read(TProto *iprot)
 {
     std::string ec_string;
-    apache::thrift::protocol::TBinaryProtocol *binary_proto =
-        dynamic_cast<apache::thrift::protocol::TBinaryProtocol *>(iprot);
     uint32_t xfer = 0;
-    if (binary_proto != nullptr) {
-        // the protocol is binary protocol
+    if (!is_thrift_json_protocol<TProto>::value) {
+        // the protocol is binary or compact protocol
         xfer += iprot->readString(ec_string);
     } else {
         // the protocol is json protocol
@@ -522,14 +652,15 @@ inline uint32_t error_code::read(apache::thrift::protocol::TProtocol *iprot)
     return xfer;
 }
 
-inline uint32_t error_code::write(apache::thrift::protocol::TProtocol *oprot) const
+template <typename TProto>
+inline uint32_t error_code::write(TProto *oprot) const
 {
     const char *name = to_string();
-    apache::thrift::protocol::TBinaryProtocol *binary_proto =
-        dynamic_cast<apache::thrift::protocol::TBinaryProtocol *>(oprot);
-    if (binary_proto != nullptr) {
-        // the protocol is binary protocol
-        return binary_proto->writeString<char_ptr>(char_ptr(name, static_cast<int>(strlen(name))));
+    if (!is_thrift_json_protocol<TProto>::value) {
+        // the protocol is binary or compact protocol
+        return write_thrift_string(oprot,
+                                   char_ptr(name, static_cast<int>(strlen(name))),
+                                   is_thrift_json_protocol<TProto>());
     } else {
         // the protocol is json protocol
         uint32_t xfer = 0;
@@ -545,6 +676,56 @@ inline uint32_t error_code::write(apache::thrift::protocol::TProtocol *oprot) co
     }
 }
 
+inline uint32_t rpc_address::read(apache::thrift::protocol::TProtocol *iprot)
+{
+    return read_from_thrift_protocol(*this, iprot);
+}
+
+inline uint32_t rpc_address::write(apache::thrift::protocol::TProtocol *oprot) const
+{
+    return write_to_thrift_protocol(*this, oprot);
+}
+
+inline uint32_t gpid::read(apache::thrift::protocol::TProtocol *iprot)
+{
+    return read_from_thrift_protocol(*this, iprot);
+}
+
+inline uint32_t gpid::write(apache::thrift::protocol::TProtocol *oprot) const
+{
+    return write_to_thrift_protocol(*this, oprot);
+}
+
+inline uint32_t task_code::read(apache::thrift::protocol::TProtocol *iprot)
+{
+    return read_from_thrift_protocol(*this, iprot);
+}
+
+inline uint32_t task_code::write(apache::thrift::protocol::TProtocol *oprot) const
+{
+    return write_to_thrift_protocol(*this, oprot);
+}
+
+inline uint32_t blob::read(apache::thrift::protocol::TProtocol *iprot)
+{
+    return read_from_thrift_protocol(*this, iprot);
+}
+
+inline uint32_t blob::write(apache::thrift::protocol::TProtocol *oprot) const
+{
+    return write_to_thrift_protocol(*this, oprot);
+}
+
+inline uint32_t error_code::read(apache::thrift::protocol::TProtocol *iprot)
+{
+    return read_from_thrift_protocol(*this, iprot);
+}
+
+inline uint32_t error_code::write(apache::thrift::protocol::TProtocol *oprot) const
+{
+    return write_to_thrift_protocol(*this, oprot);
+}
+
 inline const char *to_string(const rpc_address &addr) { return addr.to_string(); }
 inline const char *to_string(const blob &blob) { return ""; }
 inline const char *to_string(const task_code &code) { return code.to_string(); }
@@ -570,51 +751,52 @@ private:
 
     typedef decltype(check_method<T>(nullptr)) has_read_write_method;
 
-    static uint32_t marshall_internal(::apache::thrift::protocol::TProtocol *oproto,
-                                      const T &value,
-                                      std::false_type)
+    template <typename TProto>
+    static uint32_t marshall_internal(TProto *oproto, const T &value, std::false_type)
     {
         return write_base(oproto, value);
     }
 
-    static uint32_t
-    marshall_internal(::apache::thrift::protocol::TProtocol *oproto, const T &value, std::true_type)
+    template <typename TProto>
+    static uint32_t marshall_internal(TProto *oproto, const T &value, std::true_type)
     {
         return value.write(oproto);
     }
 
-    static uint32_t
-    unmarshall_internal(::apache::thrift::protocol::TProtocol *iproto, T &value, std::false_type)
+    template <typename TProto>
+    static uint32_t unmarshall_internal(TProto *iproto, T &value, std::false_type)
     {
         return read_base(iproto, value);
     }
 
-    static uint32_t
-    unmarshall_internal(::apache::thrift::protocol::TProtocol *iproto, T &value, std::true_type)
+    template <typename TProto>
+    static uint32_t unmarshall_internal(TProto *iproto, T &value, std::true_type)
     {
         return value.read(iproto);
     }
 
 public:
-    static uint32_t marshall(::apache::thrift::protocol::TProtocol *oproto, const T &value)
+    template <typename TProto>
+    static uint32_t marshall(TProto *oproto, const T &value)
     {
         return marshall_internal(oproto, value, has_read_write_method());
     }
 
-    static uint32_t unmarshall(::apache::thrift::protocol::TProtocol *iproto, T &value)
+    template <typename TProto>
+    static uint32_t unmarshall(TProto *iproto, T &value)
     {
         return unmarshall_internal(iproto, value, has_read_write_method());
     }
 };
 
-template <typename TName>
-inline uint32_t marshall_base(::apache::thrift::protocol::TProtocol *oproto, const TName &val)
+template <typename TName, typename TProto>
+inline uint32_t marshall_base(TProto *oproto, const TName &val)
 {
     return serialization_forwarder<TName>::marshall(oproto, val);
 }
 
-template <typename TName>
-inline uint32_t unmarshall_base(::apache::thrift::protocol::TProtocol *iproto, /*out*/ TName &val)
+template <typename TName, typename TProto>
+inline uint32_t unmarshall_base(TProto *iproto, /*out*/ TName &val)
 {
     // well, we assume read/write are in coupled
     return serialization_forwarder<TName>::unmarshall(iproto, val);
@@ -650,8 +832,8 @@ inline ::apache::thrift::protocol::TType get_thrift_type(const T &)
     return ::apache::thrift::protocol::T_STRUCT;
 }
 
-template <typename T>
-inline void marshall_thrift_internal(const T &val, ::apache::thrift::protocol::TProtocol *proto)
+template <typename T, typename TProto>
+inline void marshall_thrift_internal(const T &val, TProto *proto)
 {
     /*
      * we treat every element as a whole struct
@@ -664,8 +846,8 @@ inline void marshall_thrift_internal(const T &val, ::apache::thrift::protocol::T
     proto->writeStructEnd();
 }
 
-template <typename T>
-inline void unmarshall_thrift_internal(T &val, ::apache::thrift::protocol::TProtocol *proto)
+template <typename T, typename TProto>
+inline void unmarshall_thrift_internal(T &val, TProto *proto)
 {
     std::string fname;
     ::apache::thrift::protocol::TType ftype;
@@ -689,9 +871,18 @@ inline void marshall_thrift_binary(binary_writer &writer, const T &val)
     ::dsn::binary_writer_transport trans(writer);
     boost::shared_ptr<::dsn::binary_writer_transport> transport(
         &trans, [](::dsn::binary_writer_transport *) {});
-    ::apache::thrift::protocol::TBinaryProtocol proto(transport);
+    ::dsn::thrift_binary_writer_protocol proto(transport);
+    marshall_thrift_internal(val, &proto);
+}
+
+template <typename T>
+inline void marshall_thrift_compact(binary_writer &writer, const T &val)
+{
+    ::dsn::binary_writer_transport trans(writer);
+    boost::shared_ptr<::dsn::binary_writer_transport> transport(
+        &trans, [](::dsn::binary_writer_transport *) {});
+    ::dsn::thrift_compact_writer_protocol proto(transport);
     marshall_thrift_internal(val, &proto);
-    proto.getTransport()->flush();
 }
 
 template <typename T>
@@ -711,7 +902,17 @@ inline void unmarshall_thrift_binary(binary_reader &reader, T &val)
     ::dsn::binary_reader_transport trans(reader);
     boost::shared_ptr<::dsn::binary_reader_transport> transport(
         &trans, [](::dsn::binary_reader_transport *) {});
-    ::apache::thrift::protocol::TBinaryProtocol proto(transport);
+    ::dsn::thrift_binary_reader_protocol proto(transport);
+    unmarshall_thrift_internal(val, &proto);
+}
+
+template <typename T>
+inline void unmarshall_thrift_compact(binary_reader &reader, T &val)
+{
+    ::dsn::binary_reader_transport trans(reader);
+    boost::shared_ptr<::dsn::binary_reader_transport> transport(
+        &trans, [](::dsn::binary_reader_transport *) {});
+    ::dsn::thrift_compact_reader_protocol proto(transport);
     unmarshall_thrift_internal(val, &proto);
 }
 
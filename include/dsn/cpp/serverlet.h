@@ -88,8 +88,24 @@ public:
         }
     }
 
+    // reply with more content appended by attach(dsn_message_t) after the marshalled resp,
+    // e.g., a file segment sent without copying it into memory
+    template <typename TAttach>
+    void operator()(const TResponse &resp, TAttach &&attach)
+    {
+        if (_response != nullptr) {
+            ::dsn::marshall(_response, resp);
+            attach(_response);
+            dsn_rpc_reply(_response);
+            _response = nullptr;
+        }
+    }
+
     bool is_empty() const { return _response == nullptr; }
 
+    // the response message to be sent, nullptr if already replied
+    dsn_message_t response() const { return _response; }
+
 private:
     void release()
     {
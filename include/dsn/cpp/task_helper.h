@@ -71,16 +71,25 @@ public:
 
     virtual ~safe_task_handle()
     {
-        dsn_task_release_ref(_task);
+        if (_task != nullptr)
+            dsn_task_release_ref(_task);
 
         if (_rpc_response != nullptr)
             dsn_msg_release_ref(_rpc_response);
     }
 
+    // a handle may be rebound to another task (see coroutine), the previous one is released
     void set_task_info(dsn_task_t t)
     {
-        _task = t;
         dsn_task_add_ref(t);
+        if (_task != nullptr)
+            dsn_task_release_ref(_task);
+        _task = t;
+
+        if (_rpc_response != nullptr) {
+            dsn_msg_release_ref(_rpc_response);
+            _rpc_response = nullptr;
+        }
     }
 
     dsn_task_t native_handle() const { return _task; }
@@ -67,7 +67,7 @@ public:
 
 public:
     partition_resolver(rpc_address meta_server, const char *app_path)
-        : _app_path(app_path), _meta_server(meta_server)
+        : _app_path(app_path), _meta_server(meta_server), _read_staleness(-1)
     {
     }
 
@@ -87,6 +87,23 @@ public:
             std::function<void(dist::partition_resolver::resolve_result &&)> &&callback,
             int timeout_ms) = 0;
 
+    /**
+    * resolve partition_hash for a read which may be served by any replica of the partition
+    * with bounded staleness (see MSG_PARAM_READ_STALENESS), by default the read is resolved
+    * to the same target as \ref resolve
+    *
+    * \param partition_hash the partition hash
+    * \param callback       callback invoked on completion or timeout
+    * \param timeout_ms     timeout to execute the callback
+    */
+    virtual void
+    resolve_read(uint64_t partition_hash,
+                 std::function<void(dist::partition_resolver::resolve_result &&)> &&callback,
+                 int timeout_ms)
+    {
+        resolve(partition_hash, std::move(callback), timeout_ms);
+    }
+
     /*!
      failure handler when access failed for certain partition
 
@@ -112,9 +129,15 @@ public:
 
     ::dsn::rpc_address get_meta_server() const { return _meta_server; }
 
+    /*! max staleness (in decrees) for reads of this app which do not specify one, -1 for none */
+    int64_t get_read_staleness() const { return _read_staleness; }
+
+    void set_read_staleness(int64_t staleness) { _read_staleness = staleness; }
+
 protected:
     std::string _app_path;
     rpc_address _meta_server;
+    int64_t _read_staleness;
 };
 
 typedef ref_ptr<partition_resolver> partition_resolver_ptr;
@@ -26,6 +26,7 @@ namespace dsn { namespace replication {
     GENERATED_TYPE_SERIALIZATION(configuration_update_request, THRIFT)
     GENERATED_TYPE_SERIALIZATION(configuration_update_response, THRIFT)
     GENERATED_TYPE_SERIALIZATION(replica_server_info, THRIFT)
+    GENERATED_TYPE_SERIALIZATION(replica_load_stat, THRIFT)
     GENERATED_TYPE_SERIALIZATION(configuration_query_by_node_request, THRIFT)
     GENERATED_TYPE_SERIALIZATION(configuration_query_by_node_response, THRIFT)
     GENERATED_TYPE_SERIALIZATION(create_app_options, THRIFT)
@@ -147,6 +147,8 @@ class configuration_update_response;
 
 class replica_server_info;
 
+class replica_load_stat;
+
 class configuration_query_by_node_request;
 
 class configuration_query_by_node_response;
@@ -303,8 +305,10 @@ class mutation_header {
 
   bool operator < (const mutation_header & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -363,8 +367,10 @@ class mutation_update {
 
   bool operator < (const mutation_update & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -417,8 +423,10 @@ class mutation_data {
 
   bool operator < (const mutation_data & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -491,8 +499,10 @@ class replica_configuration {
 
   bool operator < (const replica_configuration & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -545,8 +555,10 @@ class prepare_msg {
 
   bool operator < (const prepare_msg & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -613,8 +625,10 @@ class read_request_header {
 
   bool operator < (const read_request_header & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -667,8 +681,10 @@ class write_request_header {
 
   bool operator < (const write_request_header & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -715,8 +731,10 @@ class rw_response_header {
 
   bool operator < (const rw_response_header & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -793,8 +811,10 @@ class prepare_ack {
 
   bool operator < (const prepare_ack & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -859,8 +879,10 @@ class learn_state {
 
   bool operator < (const learn_state & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -937,8 +959,10 @@ class learn_request {
 
   bool operator < (const learn_request & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -1029,8 +1053,10 @@ class learn_response {
 
   bool operator < (const learn_response & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -1089,8 +1115,10 @@ class learn_notify_response {
 
   bool operator < (const learn_notify_response & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -1155,8 +1183,10 @@ class group_check_request {
 
   bool operator < (const group_check_request & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -1241,8 +1271,10 @@ class group_check_response {
 
   bool operator < (const group_check_response & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -1297,8 +1329,10 @@ class node_info {
 
   bool operator < (const node_info & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -1371,8 +1405,10 @@ class configuration_update_request {
 
   bool operator < (const configuration_update_request & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -1425,8 +1461,10 @@ class configuration_update_response {
 
   bool operator < (const configuration_update_response & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -1479,8 +1517,10 @@ class replica_server_info {
 
   bool operator < (const replica_server_info & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -1493,11 +1533,106 @@ inline std::ostream& operator<<(std::ostream& out, const replica_server_info& ob
   return out;
 }
 
+typedef struct _replica_load_stat__isset {
+  _replica_load_stat__isset() : pid(false), read_qps(false), write_qps(false), read_bytes_per_sec(false), write_bytes_per_sec(false), read_latency_p99_ns(false), write_latency_p99_ns(false), storage_mb(false) {}
+  bool pid :1;
+  bool read_qps :1;
+  bool write_qps :1;
+  bool read_bytes_per_sec :1;
+  bool write_bytes_per_sec :1;
+  bool read_latency_p99_ns :1;
+  bool write_latency_p99_ns :1;
+  bool storage_mb :1;
+} _replica_load_stat__isset;
+
+class replica_load_stat {
+ public:
+
+  replica_load_stat(const replica_load_stat&);
+  replica_load_stat(replica_load_stat&&);
+  replica_load_stat& operator=(const replica_load_stat&);
+  replica_load_stat& operator=(replica_load_stat&&);
+  replica_load_stat() : read_qps(0), write_qps(0), read_bytes_per_sec(0), write_bytes_per_sec(0), read_latency_p99_ns(0), write_latency_p99_ns(0), storage_mb(0) {
+  }
+
+  virtual ~replica_load_stat() throw();
+   ::dsn::gpid pid;
+  int64_t read_qps;
+  int64_t write_qps;
+  int64_t read_bytes_per_sec;
+  int64_t write_bytes_per_sec;
+  int64_t read_latency_p99_ns;
+  int64_t write_latency_p99_ns;
+  int64_t storage_mb;
+
+  _replica_load_stat__isset __isset;
+
+  void __set_pid(const  ::dsn::gpid& val);
+
+  void __set_read_qps(const int64_t val);
+
+  void __set_write_qps(const int64_t val);
+
+  void __set_read_bytes_per_sec(const int64_t val);
+
+  void __set_write_bytes_per_sec(const int64_t val);
+
+  void __set_read_latency_p99_ns(const int64_t val);
+
+  void __set_write_latency_p99_ns(const int64_t val);
+
+  void __set_storage_mb(const int64_t val);
+
+  bool operator == (const replica_load_stat & rhs) const
+  {
+    if (!(pid == rhs.pid))
+      return false;
+    if (!(read_qps == rhs.read_qps))
+      return false;
+    if (!(write_qps == rhs.write_qps))
+      return false;
+    if (!(read_bytes_per_sec == rhs.read_bytes_per_sec))
+      return false;
+    if (!(write_bytes_per_sec == rhs.write_bytes_per_sec))
+      return false;
+    if (!(read_latency_p99_ns == rhs.read_latency_p99_ns))
+      return false;
+    if (!(write_latency_p99_ns == rhs.write_latency_p99_ns))
+      return false;
+    if (!(storage_mb == rhs.storage_mb))
+      return false;
+    return true;
+  }
+  bool operator != (const replica_load_stat &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const replica_load_stat & ) const;
+
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
+
+  virtual void printTo(std::ostream& out) const;
+};
+
+void swap(replica_load_stat &a, replica_load_stat &b);
+
+inline std::ostream& operator<<(std::ostream& out, const replica_load_stat& obj)
+{
+  obj.printTo(out);
+  return out;
+}
+
 typedef struct _configuration_query_by_node_request__isset {
-  _configuration_query_by_node_request__isset() : node(false), stored_replicas(false), info(false) {}
+  _configuration_query_by_node_request__isset() : node(false), stored_replicas(false), info(false), load_stats(false), config_epoch(false), config_version(false) {}
   bool node :1;
   bool stored_replicas :1;
   bool info :1;
+  bool load_stats :1;
+  bool config_epoch :1;
+  bool config_version :1;
 } _configuration_query_by_node_request__isset;
 
 class configuration_query_by_node_request {
@@ -1507,13 +1642,16 @@ class configuration_query_by_node_request {
   configuration_query_by_node_request(configuration_query_by_node_request&&);
   configuration_query_by_node_request& operator=(const configuration_query_by_node_request&);
   configuration_query_by_node_request& operator=(configuration_query_by_node_request&&);
-  configuration_query_by_node_request() {
+  configuration_query_by_node_request() : config_epoch(0), config_version(0) {
   }
 
   virtual ~configuration_query_by_node_request() throw();
    ::dsn::rpc_address node;
   std::vector<replica_info>  stored_replicas;
   replica_server_info info;
+  std::vector<replica_load_stat>  load_stats;
+  int64_t config_epoch;
+  int64_t config_version;
 
   _configuration_query_by_node_request__isset __isset;
 
@@ -1523,6 +1661,12 @@ class configuration_query_by_node_request {
 
   void __set_info(const replica_server_info& val);
 
+  void __set_load_stats(const std::vector<replica_load_stat> & val);
+
+  void __set_config_epoch(const int64_t val);
+
+  void __set_config_version(const int64_t val);
+
   bool operator == (const configuration_query_by_node_request & rhs) const
   {
     if (!(node == rhs.node))
@@ -1535,6 +1679,18 @@ class configuration_query_by_node_request {
       return false;
     else if (__isset.info && !(info == rhs.info))
       return false;
+    if (__isset.load_stats != rhs.__isset.load_stats)
+      return false;
+    else if (__isset.load_stats && !(load_stats == rhs.load_stats))
+      return false;
+    if (__isset.config_epoch != rhs.__isset.config_epoch)
+      return false;
+    else if (__isset.config_epoch && !(config_epoch == rhs.config_epoch))
+      return false;
+    if (__isset.config_version != rhs.__isset.config_version)
+      return false;
+    else if (__isset.config_version && !(config_version == rhs.config_version))
+      return false;
     return true;
   }
   bool operator != (const configuration_query_by_node_request &rhs) const {
@@ -1543,8 +1699,10 @@ class configuration_query_by_node_request {
 
   bool operator < (const configuration_query_by_node_request & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -1558,10 +1716,14 @@ inline std::ostream& operator<<(std::ostream& out, const configuration_query_by_
 }
 
 typedef struct _configuration_query_by_node_response__isset {
-  _configuration_query_by_node_response__isset() : err(false), partitions(false), gc_replicas(false) {}
+  _configuration_query_by_node_response__isset() : err(false), partitions(false), gc_replicas(false), config_epoch(false), config_version(false), is_delta(false), apps(false) {}
   bool err :1;
   bool partitions :1;
   bool gc_replicas :1;
+  bool config_epoch :1;
+  bool config_version :1;
+  bool is_delta :1;
+  bool apps :1;
 } _configuration_query_by_node_response__isset;
 
 class configuration_query_by_node_response {
@@ -1571,13 +1733,17 @@ class configuration_query_by_node_response {
   configuration_query_by_node_response(configuration_query_by_node_response&&);
   configuration_query_by_node_response& operator=(const configuration_query_by_node_response&);
   configuration_query_by_node_response& operator=(configuration_query_by_node_response&&);
-  configuration_query_by_node_response() {
+  configuration_query_by_node_response() : config_epoch(0), config_version(0), is_delta(0) {
   }
 
   virtual ~configuration_query_by_node_response() throw();
    ::dsn::error_code err;
   std::vector<configuration_update_request>  partitions;
   std::vector<replica_info>  gc_replicas;
+  int64_t config_epoch;
+  int64_t config_version;
+  bool is_delta;
+  std::vector< ::dsn::app_info>  apps;
 
   _configuration_query_by_node_response__isset __isset;
 
@@ -1587,6 +1753,14 @@ class configuration_query_by_node_response {
 
   void __set_gc_replicas(const std::vector<replica_info> & val);
 
+  void __set_config_epoch(const int64_t val);
+
+  void __set_config_version(const int64_t val);
+
+  void __set_is_delta(const bool val);
+
+  void __set_apps(const std::vector< ::dsn::app_info> & val);
+
   bool operator == (const configuration_query_by_node_response & rhs) const
   {
     if (!(err == rhs.err))
@@ -1597,6 +1771,22 @@ class configuration_query_by_node_response {
       return false;
     else if (__isset.gc_replicas && !(gc_replicas == rhs.gc_replicas))
       return false;
+    if (__isset.config_epoch != rhs.__isset.config_epoch)
+      return false;
+    else if (__isset.config_epoch && !(config_epoch == rhs.config_epoch))
+      return false;
+    if (__isset.config_version != rhs.__isset.config_version)
+      return false;
+    else if (__isset.config_version && !(config_version == rhs.config_version))
+      return false;
+    if (__isset.is_delta != rhs.__isset.is_delta)
+      return false;
+    else if (__isset.is_delta && !(is_delta == rhs.is_delta))
+      return false;
+    if (__isset.apps != rhs.__isset.apps)
+      return false;
+    else if (__isset.apps && !(apps == rhs.apps))
+      return false;
     return true;
   }
   bool operator != (const configuration_query_by_node_response &rhs) const {
@@ -1605,8 +1795,10 @@ class configuration_query_by_node_response {
 
   bool operator < (const configuration_query_by_node_response & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -1683,8 +1875,10 @@ class create_app_options {
 
   bool operator < (const create_app_options & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -1737,8 +1931,10 @@ class configuration_create_app_request {
 
   bool operator < (const configuration_create_app_request & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -1793,8 +1989,10 @@ class drop_app_options {
 
   bool operator < (const drop_app_options & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -1847,8 +2045,10 @@ class configuration_drop_app_request {
 
   bool operator < (const configuration_drop_app_request & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -1897,8 +2097,10 @@ class configuration_list_apps_request {
 
   bool operator < (const configuration_list_apps_request & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -1947,8 +2149,10 @@ class configuration_list_nodes_request {
 
   bool operator < (const configuration_list_nodes_request & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -1984,8 +2188,10 @@ class configuration_cluster_info_request {
 
   bool operator < (const configuration_cluster_info_request & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -2038,8 +2244,10 @@ class configuration_recall_app_request {
 
   bool operator < (const configuration_recall_app_request & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -2092,8 +2300,10 @@ class configuration_create_app_response {
 
   bool operator < (const configuration_create_app_response & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -2140,8 +2350,10 @@ class configuration_meta_control_request {
 
   bool operator < (const configuration_meta_control_request & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -2194,8 +2406,10 @@ class configuration_meta_control_response {
 
   bool operator < (const configuration_meta_control_response & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -2254,8 +2468,10 @@ class configuration_proposal_action {
   }
 
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -2316,8 +2532,10 @@ class configuration_balancer_request {
 
   bool operator < (const configuration_balancer_request & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -2364,8 +2582,10 @@ class configuration_balancer_response {
 
   bool operator < (const configuration_balancer_response & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -2412,8 +2632,10 @@ class configuration_drop_app_response {
 
   bool operator < (const configuration_drop_app_response & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -2466,8 +2688,10 @@ class configuration_list_apps_response {
 
   bool operator < (const configuration_list_apps_response & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -2520,8 +2744,10 @@ class configuration_list_nodes_response {
 
   bool operator < (const configuration_list_nodes_response & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -2580,8 +2806,10 @@ class configuration_cluster_info_response {
 
   bool operator < (const configuration_cluster_info_response & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -2634,8 +2862,10 @@ class configuration_recall_app_response {
 
   bool operator < (const configuration_recall_app_response & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -2688,8 +2918,10 @@ class query_replica_decree_request {
 
   bool operator < (const query_replica_decree_request & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -2742,8 +2974,10 @@ class query_replica_decree_response {
 
   bool operator < (const query_replica_decree_response & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -2832,8 +3066,10 @@ class replica_info {
 
   bool operator < (const replica_info & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -2880,8 +3116,10 @@ class query_replica_info_request {
 
   bool operator < (const query_replica_info_request & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -2934,8 +3172,10 @@ class query_replica_info_response {
 
   bool operator < (const query_replica_info_response & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -2982,8 +3222,10 @@ class query_app_info_request {
 
   bool operator < (const query_app_info_request & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -3036,8 +3278,10 @@ class query_app_info_response {
 
   bool operator < (const query_app_info_response & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -3096,8 +3340,10 @@ class configuration_recovery_request {
 
   bool operator < (const configuration_recovery_request & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -3150,8 +3396,10 @@ class configuration_recovery_response {
 
   bool operator < (const configuration_recovery_response & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -3204,8 +3452,10 @@ class policy_info {
 
   bool operator < (const policy_info & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -3294,8 +3544,10 @@ class configuration_restore_request {
 
   bool operator < (const configuration_restore_request & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -3360,8 +3612,10 @@ class backup_request {
 
   bool operator < (const backup_request & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -3438,8 +3692,10 @@ class backup_response {
 
   bool operator < (const backup_response & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -3534,8 +3790,10 @@ class configuration_modify_backup_policy_request {
 
   bool operator < (const configuration_modify_backup_policy_request & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -3588,8 +3846,10 @@ class configuration_modify_backup_policy_response {
 
   bool operator < (const configuration_modify_backup_policy_response & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -3666,8 +3926,10 @@ class configuration_add_backup_policy_request {
 
   bool operator < (const configuration_add_backup_policy_request & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -3720,8 +3982,10 @@ class configuration_add_backup_policy_response {
 
   bool operator < (const configuration_add_backup_policy_response & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -3804,8 +4068,10 @@ class policy_entry {
 
   bool operator < (const policy_entry & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -3870,8 +4136,10 @@ class backup_entry {
 
   bool operator < (const backup_entry & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -3924,8 +4192,10 @@ class configuration_query_backup_policy_request {
 
   bool operator < (const configuration_query_backup_policy_request & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -3992,8 +4262,10 @@ class configuration_query_backup_policy_response {
 
   bool operator < (const configuration_query_backup_policy_response & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -4060,8 +4332,10 @@ class configuration_report_restore_status_request {
 
   bool operator < (const configuration_report_restore_status_request & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -4108,8 +4382,10 @@ class configuration_report_restore_status_response {
 
   bool operator < (const configuration_report_restore_status_response & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -4156,8 +4432,10 @@ class configuration_query_restore_request {
 
   bool operator < (const configuration_query_restore_request & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -4216,8 +4494,10 @@ class configuration_query_restore_response {
 
   bool operator < (const configuration_query_restore_response & ) const;
 
-  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
-  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+  template <class Protocol_>
+  uint32_t read(Protocol_* iprot);
+  template <class Protocol_>
+  uint32_t write(Protocol_* oprot) const;
 
   virtual void printTo(std::ostream& out) const;
 };
@@ -4232,4 +4512,6 @@ inline std::ostream& operator<<(std::ostream& out, const configuration_query_res
 
 }} // namespace
 
+#include <dsn/dist/replication/replication_types.tcc>
+
 #endif
@@ -81,6 +81,11 @@ public:
     virtual void aio(aio_task *aio) = 0;
     virtual disk_aio *prepare_aio_context(aio_task *) = 0;
 
+    // whether write tasks with aio_task::_unmerged_write_buffers are written
+    // as they are (e.g., with pwritev); otherwise the buffers are merged into
+    // one before aio() is called
+    virtual bool support_write_vec() const { return false; }
+
     virtual void start(io_modifer &ctx) = 0;
 
 protected:
@@ -38,6 +38,7 @@
 #include <dsn/tool-api/task.h>
 #include <dsn/utility/synchronize.h>
 #include <dsn/tool-api/message_parser.h>
+#include <dsn/tool-api/perf_counter.h>
 #include <dsn/cpp/address.h>
 #include <dsn/utility/exp_delay.h>
 #include <dsn/utility/dlib.h>
@@ -171,7 +172,7 @@ public:
     DSN_API void on_server_session_accepted(rpc_session_ptr &s);
     DSN_API void on_server_session_disconnected(rpc_session_ptr &s);
 
-    // client session management
+    // client session management, returns any connected session to the remote server
     DSN_API rpc_session_ptr get_client_session(::dsn::rpc_address ep);
     DSN_API void on_client_session_connected(rpc_session_ptr &s);
     DSN_API void on_client_session_disconnected(rpc_session_ptr &s);
@@ -186,9 +187,19 @@ public:
     virtual rpc_session_ptr create_client_session(::dsn::rpc_address server_addr) = 0;
 
 protected:
-    typedef std::unordered_map<::dsn::rpc_address, rpc_session_ptr> client_sessions;
-    client_sessions _clients; // to_address => rpc_session
+    // index of the session in the pool to the remote server for sending the message:
+    // bulk rpc calls go to the last session, while others are spread by thread hash
+    DSN_API int get_client_session_index(message_ex *msg) const;
+
+protected:
+    // each remote server is connected with a pool of client sessions, so bulk transfers
+    // (e.g., learning and nfs copies) do not block small latency sensitive messages (e.g.,
+    // prepares) behind one socket and one send queue. the sessions are created on demand.
+    typedef std::vector<rpc_session_ptr> client_session_pool;
+    typedef std::unordered_map<::dsn::rpc_address, client_session_pool> client_sessions;
+    client_sessions _clients; // to_address => rpc_session pool
     utils::rw_lock_nr _clients_lock;
+    int _client_session_count_per_server;
 
     typedef std::unordered_map<::dsn::rpc_address, rpc_session_ptr> server_sessions;
     server_sessions _servers; // from_address => rpc_session
@@ -227,6 +238,9 @@ public:
     DSN_API bool cancel(message_ex *request);
     void delay_recv(int delay_ms);
     DSN_API bool on_recv_message(message_ex *msg, int delay_ms);
+    // whether the session can send message_ex::file_seg directly, otherwise
+    // the segment must be loaded into the message buffers before sending
+    virtual bool can_send_file_segment(message_ex *msg) const { return false; }
 
     // for client session
 public:
@@ -282,6 +296,11 @@ protected:
     // also locked by _lock later
     std::vector<message_parser::send_buf> _sending_buffers;
     std::vector<message_ex *> _sending_msgs;
+    // file segment of the last message in _sending_msgs, sent after _sending_buffers
+    file_segment _sending_file_seg;
+    // compact headers referred by _sending_buffers, which are kept alive until sent as
+    // the message may be resent meanwhile on another session with a new compact header
+    std::vector<blob> _sending_compact_headers;
 
 private:
     const bool _is_client;
@@ -303,6 +322,8 @@ private:
     uint64_t _message_sent;
     // ]
 
+    perf_counter_ptr _message_count_counter; // the send queue depth of this session
+
     std::atomic_int _delay_server_receive_ms;
 };
 
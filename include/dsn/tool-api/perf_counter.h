@@ -38,6 +38,7 @@
 #include <dsn/utility/enum_helper.h>
 #include <dsn/utility/autoref_ptr.h>
 #include <dsn/utility/dlib.h>
+#include <dsn/utility/histogram.h>
 #include <dsn/service_api_c.h>
 #include <memory>
 #include <sstream>
@@ -48,6 +49,7 @@ typedef enum dsn_perf_counter_type_t {
     COUNTER_TYPE_VOLATILE_NUMBER, // special kind of NUMBER which will be reset on get
     COUNTER_TYPE_RATE,
     COUNTER_TYPE_NUMBER_PERCENTILES,
+    COUNTER_TYPE_HISTOGRAM, // values set are counted in a mergeable log-linear histogram
     COUNTER_TYPE_INVALID,
     COUNTER_TYPE_COUNT
 } dsn_perf_counter_type_t;
@@ -74,6 +76,7 @@ ENUM_REG(COUNTER_TYPE_NUMBER)
 ENUM_REG(COUNTER_TYPE_VOLATILE_NUMBER)
 ENUM_REG(COUNTER_TYPE_RATE)
 ENUM_REG(COUNTER_TYPE_NUMBER_PERCENTILES)
+ENUM_REG(COUNTER_TYPE_HISTOGRAM)
 ENUM_END(dsn_perf_counter_type_t)
 
 ENUM_BEGIN(dsn_perf_counter_percentile_type_t, COUNTER_PERCENTILE_INVALID)
@@ -135,6 +138,10 @@ public:
     // return the latest sample value
     virtual uint64_t get_latest_sample() const { return 0; }
 
+    // merge the values of a COUNTER_TYPE_HISTOGRAM counter into the snapshot,
+    // return false if it is not a histogram counter
+    virtual bool get_histogram(/*out*/ histogram_snapshot &snapshot) const { return false; }
+
     const char *full_name() const { return _full_name.c_str(); }
     const char *app() const { return _app.c_str(); }
     const char *section() const { return _section.c_str(); }
@@ -90,6 +90,7 @@ public:
 
 private:
     std::string list_counter_internal(const std::vector<std::string> &args);
+    static std::string get_histogram_value(const std::vector<std::string> &args);
     mutable utils::rw_lock_nr _lock;
     std::map<std::string, perf_counter_ptr> _counters;
     perf_counter::factory _factory;
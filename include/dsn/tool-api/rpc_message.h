@@ -100,6 +100,19 @@ typedef struct message_header
     } server;
 } message_header;
 
+// a range of an opened file which is sent right after the body buffers of a message,
+// by which the network may send the file content without copying it into memory
+// (e.g., with sendfile), see message_ex::attach_file_segment
+struct file_segment
+{
+    int fd; // native file descriptor
+    uint64_t offset;
+    uint32_t size;
+    std::shared_ptr<void> holder; // keeps the file opened until the segment is sent
+
+    file_segment() : fd(-1), offset(0), size(0) {}
+};
+
 class message_ex : public ref_counter,
                    public extensible_object<message_ex, 4>,
                    public transient_object
@@ -116,6 +129,8 @@ public:
     dsn::task_code local_rpc_code;
     network_header_format hdr_format;
     int send_retry_count;
+    blob compact_header; // prepared on send, replacing the message_header in buffers[0] if set
+    file_segment file_seg; // sent after buffers if size > 0, included in body_length
 
     // by message queuing
     dlink dl;
@@ -152,6 +167,14 @@ public:
     DSN_API void write_next(void **ptr, size_t *size, size_t min_size);
     DSN_API void write_commit(size_t size);
     DSN_API void write_append(const blob &data);
+    // append a file range to the body, which must be the last write of the message.
+    // the body crc is not computed for such messages.
+    DSN_API void attach_file_segment(int fd,
+                                     uint64_t offset,
+                                     uint32_t size,
+                                     std::shared_ptr<void> holder);
+    // read the attached file range into buffers, for networks which cannot send it directly
+    DSN_API error_code load_file_segment();
     DSN_API bool read_next(void **ptr, size_t *size);
     bool read_next(blob &data);
     DSN_API void read_commit(size_t size);
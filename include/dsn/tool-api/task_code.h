@@ -82,7 +82,8 @@ public:
     task_code(const char *name,
               dsn_task_type_t tt,
               dsn_task_priority_t pri,
-              dsn::threadpool_code pool);
+              dsn::threadpool_code pool,
+              bool is_bulk_rpc = false);
     task_code() { _internal_code = 0; }
     task_code(const task_code &r) { _internal_code = r._internal_code; }
     explicit task_code(int code) { _internal_code = code; }
@@ -101,6 +102,12 @@ public:
 #ifdef DSN_USE_THRIFT_SERIALIZATION
     uint32_t read(::apache::thrift::protocol::TProtocol *iprot);
     uint32_t write(::apache::thrift::protocol::TProtocol *oprot) const;
+
+    // on the concrete protocols, see thrift_helper.h
+    template <typename TProto>
+    uint32_t read(TProto *iprot);
+    template <typename TProto>
+    uint32_t write(TProto *oprot) const;
 #endif
 
     static int max();
@@ -124,10 +131,17 @@ private:
     __selectany const ::dsn::task_code x(#name, TASK_TYPE_RPC_REQUEST, pri, pool);                 \
     __selectany const ::dsn::task_code x##_ACK(#name "_ACK", TASK_TYPE_RPC_RESPONSE, pri, pool);
 
+// the rpc calls carry bulk data by default, i.e., rpc_call_is_bulk in task_spec.h is true
+// unless it is set in the config
+#define DEFINE_NAMED_TASK_CODE_RPC_BULK(x, name, pri, pool)                                        \
+    __selectany const ::dsn::task_code x(#name, TASK_TYPE_RPC_REQUEST, pri, pool, true);           \
+    __selectany const ::dsn::task_code x##_ACK(#name "_ACK", TASK_TYPE_RPC_RESPONSE, pri, pool);
+
 /*! define a new task code with TASK_TYPE_COMPUTATION */
 #define DEFINE_TASK_CODE(x, pri, pool) DEFINE_NAMED_TASK_CODE(x, x, pri, pool)
 #define DEFINE_TASK_CODE_AIO(x, pri, pool) DEFINE_NAMED_TASK_CODE_AIO(x, x, pri, pool)
 #define DEFINE_TASK_CODE_RPC(x, pri, pool) DEFINE_NAMED_TASK_CODE_RPC(x, x, pri, pool)
+#define DEFINE_TASK_CODE_RPC_BULK(x, pri, pool) DEFINE_NAMED_TASK_CODE_RPC_BULK(x, x, pri, pool)
 
 // define a default task code "task_code_invalid", it's mainly used for representing
 // some error status when you want to return task_code in some functions.
@@ -201,6 +201,7 @@ public:
     dsn_msg_serialize_format rpc_msg_payload_serialize_default_format;
     rpc_channel rpc_call_channel;
     bool rpc_message_crc_required;
+    bool rpc_call_is_bulk; // sent with the client session reserved for bulk transfers
 
     int32_t rpc_timeout_milliseconds;
     int32_t rpc_request_resend_timeout_milliseconds;  // 0 for no auto-resend
@@ -315,6 +316,13 @@ CONFIG_FLD(bool,
            rpc_message_crc_required,
            false,
            "whether to calculate the crc checksum when send request/response")
+CONFIG_FLD(bool,
+           bool,
+           rpc_call_is_bulk,
+           false,
+           "whether this kind of rpc calls carries bulk data (e.g., learning and nfs copies), "
+           "which is sent with a dedicated client session to the remote server, true by "
+           "default for the codes defined with DEFINE_TASK_CODE_RPC_BULK")
 CONFIG_FLD(int32_t,
            uint64,
            rpc_timeout_milliseconds,
@@ -29,7 +29,7 @@ class get_file_size_request;
 class get_file_size_response;
 
 typedef struct _copy_request__isset {
-  _copy_request__isset() : source(false), source_dir(false), dst_dir(false), file_name(false), offset(false), size(false), is_last(false), overwrite(false) {}
+  _copy_request__isset() : source(false), source_dir(false), dst_dir(false), file_name(false), offset(false), size(false), is_last(false), overwrite(false), zero_copy(false) {}
   bool source :1;
   bool source_dir :1;
   bool dst_dir :1;
@@ -38,6 +38,7 @@ typedef struct _copy_request__isset {
   bool size :1;
   bool is_last :1;
   bool overwrite :1;
+  bool zero_copy :1;
 } _copy_request__isset;
 
 class copy_request {
@@ -47,7 +48,7 @@ class copy_request {
   copy_request(copy_request&&);
   copy_request& operator=(const copy_request&);
   copy_request& operator=(copy_request&&);
-  copy_request() : source_dir(), dst_dir(), file_name(), offset(0), size(0), is_last(0), overwrite(0) {
+  copy_request() : source_dir(), dst_dir(), file_name(), offset(0), size(0), is_last(0), overwrite(0), zero_copy(0) {
   }
 
   virtual ~copy_request() throw();
@@ -59,6 +60,7 @@ class copy_request {
   int32_t size;
   bool is_last;
   bool overwrite;
+  bool zero_copy;
 
   _copy_request__isset __isset;
 
@@ -78,6 +80,8 @@ class copy_request {
 
   void __set_overwrite(const bool val);
 
+  void __set_zero_copy(const bool val);
+
   bool operator == (const copy_request & rhs) const
   {
     if (!(source == rhs.source))
@@ -96,6 +100,10 @@ class copy_request {
       return false;
     if (!(overwrite == rhs.overwrite))
       return false;
+    if (__isset.zero_copy != rhs.__isset.zero_copy)
+      return false;
+    else if (__isset.zero_copy && !(zero_copy == rhs.zero_copy))
+      return false;
     return true;
   }
   bool operator != (const copy_request &rhs) const {
@@ -119,11 +127,12 @@ inline std::ostream& operator<<(std::ostream& out, const copy_request& obj)
 }
 
 typedef struct _copy_response__isset {
-  _copy_response__isset() : error(false), file_content(false), offset(false), size(false) {}
+  _copy_response__isset() : error(false), file_content(false), offset(false), size(false), checksum(false) {}
   bool error :1;
   bool file_content :1;
   bool offset :1;
   bool size :1;
+  bool checksum :1;
 } _copy_response__isset;
 
 class copy_response {
@@ -133,7 +142,7 @@ class copy_response {
   copy_response(copy_response&&);
   copy_response& operator=(const copy_response&);
   copy_response& operator=(copy_response&&);
-  copy_response() : offset(0), size(0) {
+  copy_response() : offset(0), size(0), checksum(0) {
   }
 
   virtual ~copy_response() throw();
@@ -141,6 +150,7 @@ class copy_response {
    ::dsn::blob file_content;
   int64_t offset;
   int32_t size;
+  int64_t checksum;
 
   _copy_response__isset __isset;
 
@@ -152,6 +162,8 @@ class copy_response {
 
   void __set_size(const int32_t val);
 
+  void __set_checksum(const int64_t val);
+
   bool operator == (const copy_response & rhs) const
   {
     if (!(error == rhs.error))
@@ -162,6 +174,10 @@ class copy_response {
       return false;
     if (!(size == rhs.size))
       return false;
+    if (__isset.checksum != rhs.__isset.checksum)
+      return false;
+    else if (__isset.checksum && !(checksum == rhs.checksum))
+      return false;
     return true;
   }
   bool operator != (const copy_response &rhs) const {
@@ -257,10 +273,11 @@ inline std::ostream& operator<<(std::ostream& out, const get_file_size_request&
 }
 
 typedef struct _get_file_size_response__isset {
-  _get_file_size_response__isset() : error(false), file_list(false), size_list(false) {}
+  _get_file_size_response__isset() : error(false), file_list(false), size_list(false), mtime_list(false) {}
   bool error :1;
   bool file_list :1;
   bool size_list :1;
+  bool mtime_list :1;
 } _get_file_size_response__isset;
 
 class get_file_size_response {
@@ -277,6 +294,7 @@ class get_file_size_response {
   int32_t error;
   std::vector<std::string>  file_list;
   std::vector<int64_t>  size_list;
+  std::vector<int64_t>  mtime_list;
 
   _get_file_size_response__isset __isset;
 
@@ -286,6 +304,8 @@ class get_file_size_response {
 
   void __set_size_list(const std::vector<int64_t> & val);
 
+  void __set_mtime_list(const std::vector<int64_t> & val);
+
   bool operator == (const get_file_size_response & rhs) const
   {
     if (!(error == rhs.error))
@@ -294,6 +314,10 @@ class get_file_size_response {
       return false;
     if (!(size_list == rhs.size_list))
       return false;
+    if (__isset.mtime_list != rhs.__isset.mtime_list)
+      return false;
+    else if (__isset.mtime_list && !(mtime_list == rhs.mtime_list))
+      return false;
     return true;
   }
   bool operator != (const get_file_size_response &rhs) const {
@@ -2,12 +2,14 @@
 
 #include <cstdint>
 #include <cstddef>
+#include <vector>
 
 #define CRC_INVALID 0x0
 
 namespace dsn {
 namespace utils {
 
+// crc32c (Castagnoli), computed with the fastest implementation available on the running cpu
 uint32_t crc32_calc(const void *ptr, size_t size, uint32_t init_crc);
 
 //
@@ -45,5 +47,26 @@ uint64_t crc64_concat(uint32_t xy_init,
                       uint64_t y_init,
                       uint64_t y_final,
                       size_t y_size);
+
+//
+// All the implementations available on the running cpu, for testing and benchmarking.
+// The first one is the byte-wise table reference version, the last one is the one used by
+// crc32_calc/crc64_calc.
+//
+struct crc32_impl
+{
+    typedef uint32_t (*calc_func)(const void *ptr, size_t size, uint32_t init_crc);
+    const char *name;
+    calc_func calc;
+};
+const std::vector<crc32_impl> &crc32_impls();
+
+struct crc64_impl
+{
+    typedef uint64_t (*calc_func)(const void *ptr, size_t size, uint64_t init_crc);
+    const char *name;
+    calc_func calc;
+};
+const std::vector<crc64_impl> &crc64_impls();
 }
 }
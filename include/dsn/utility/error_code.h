@@ -28,6 +28,12 @@ public:
 #ifdef DSN_USE_THRIFT_SERIALIZATION
     uint32_t read(::apache::thrift::protocol::TProtocol *iprot);
     uint32_t write(::apache::thrift::protocol::TProtocol *oprot) const;
+
+    // on the concrete protocols, see thrift_helper.h
+    template <typename TProto>
+    uint32_t read(TProto *iprot);
+    template <typename TProto>
+    uint32_t write(TProto *oprot) const;
 #endif
 
     static int max();
@@ -117,4 +123,5 @@ DEFINE_ERR_CODE(ERR_IGNORE_BAD_DATA)
 DEFINE_ERR_CODE(ERR_APP_DROPPED)
 DEFINE_ERR_CODE(ERR_MOCK_INTERNAL)
 DEFINE_ERR_CODE(ERR_ZOOKEEPER_OPERATION)
+DEFINE_ERR_CODE(ERR_STALE_READ)
 }
@@ -0,0 +1,139 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015 Microsoft Corporation
+ *
+ * -=- Robust Distributed System Nucleus (rDSN) -=-
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * Description:
+ *     mergeable log-linear histogram, the storage of histogram perf counters
+ *
+ * Revision history:
+ *     xxxx-xx-xx, author, first version
+ *     xxxx-xx-xx, author, fix bug about xxx
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace dsn {
+
+//
+// Values are counted in log-linear buckets like HdrHistogram: [0, 2^sub_bucket_bits) is
+// recorded exactly, and every [2^k, 2^(k+1)) above is split into 2^sub_bucket_bits linear
+// buckets, so a value read back is within 1/2^sub_bucket_bits of the recorded ones.
+// Values from 2^max_value_bits (about 18 minutes in nanoseconds) on all fall in the last
+// bucket, only their max is kept exactly.
+//
+// A snapshot is a plain container, which is not thread safe. Snapshots of different
+// histograms can be merged, e.g., to aggregate the latencies of all the replicas of an app.
+//
+class histogram_snapshot
+{
+public:
+    static const int sub_bucket_bits = 4;
+    static const int sub_bucket_count = 1 << sub_bucket_bits;
+    static const int max_value_bits = 40;
+    static const int bucket_count = ((max_value_bits - sub_bucket_bits + 1) << sub_bucket_bits) + 1;
+
+    static int bucket_index(uint64_t value);
+    static uint64_t bucket_lower_bound(int index);
+    static uint64_t bucket_upper_bound(int index);
+
+public:
+    histogram_snapshot();
+
+    void record(uint64_t value, uint64_t count = 1);
+    void merge(const histogram_snapshot &other);
+    void clear();
+
+    uint64_t count() const { return _count; }
+    uint64_t sum() const { return _sum; }
+    // 0 if no value is recorded
+    uint64_t min() const { return _count == 0 ? 0 : _min; }
+    uint64_t max() const { return _max; }
+    double mean() const { return _count == 0 ? 0.0 : static_cast<double>(_sum) / _count; }
+
+    // percentile in [0, 100], e.g., 99.9 for P999. The upper bound of the bucket where the
+    // percentile falls in is returned, which is clipped to [min, max]
+    uint64_t percentile(double percent) const;
+
+    // iterate the non-empty buckets with (lower bound, upper bound, count)
+    void for_each_bucket(const std::function<void(uint64_t, uint64_t, uint64_t)> &f) const;
+
+private:
+    friend class histogram;
+
+    std::vector<uint64_t> _buckets;
+    uint64_t _count;
+    uint64_t _sum;
+    uint64_t _min;
+    uint64_t _max;
+};
+
+//
+// A histogram which can be recorded by multiple threads concurrently. Threads record into
+// min(max_shard_count, hardware concurrency) shards with relaxed atomics, which are allocated
+// on the first record into them, and the shards are merged on read.
+//
+// The histogram is cumulative: merge_to() reads all the values recorded since it is created.
+// Use merge_and_reset() instead to read the values of a window, e.g., since the last read.
+//
+class histogram
+{
+public:
+    histogram();
+    ~histogram();
+
+    void record(uint64_t value);
+
+    // merge the values recorded so far into the snapshot
+    void merge_to(/*out*/ histogram_snapshot &snapshot) const;
+
+    // merge the values recorded so far into the snapshot and clear them, a value recorded
+    // concurrently is either merged now or kept for the next read
+    void merge_and_reset(/*out*/ histogram_snapshot &snapshot);
+
+private:
+    struct shard
+    {
+        std::atomic<uint64_t> buckets[histogram_snapshot::bucket_count];
+        std::atomic<uint64_t> count;
+        std::atomic<uint64_t> sum;
+        std::atomic<uint64_t> min;
+        std::atomic<uint64_t> max;
+
+        shard();
+    };
+
+    shard *get_shard();
+
+    static const int max_shard_count = 8;
+    const int _shard_count;
+    std::atomic<shard *> _shards[max_shard_count];
+};
+}
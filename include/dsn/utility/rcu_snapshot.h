@@ -0,0 +1,168 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015 Microsoft Corporation
+ *
+ * -=- Robust Distributed System Nucleus (rDSN) -=-
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * Description:
+ *     read-copy-update snapshot of a read-mostly object
+ *
+ * Revision history:
+ *     xxxx-xx-xx, author, first version
+ *     xxxx-xx-xx, author, fix bug about xxx
+ */
+
+#pragma once
+
+#include <dsn/utility/ports.h>
+#include <atomic>
+#include <memory>
+#include <thread>
+
+namespace dsn {
+namespace utils {
+
+// dense index of the current thread, starting from 0
+extern int get_rcu_reader_index_internal();
+extern __thread int s_rcu_reader_index; // index + 1, 0 means not assigned yet
+
+inline int get_rcu_reader_index()
+{
+    if (s_rcu_reader_index == 0) {
+        s_rcu_reader_index = get_rcu_reader_index_internal() + 1;
+    }
+    return s_rcu_reader_index - 1;
+}
+
+//
+// An immutable snapshot of T which is replaced as a whole by writers.
+//
+// Readers access the current snapshot without taking any shared lock: each thread marks
+// itself active in its own cache line, so that concurrent readers never write to the same
+// memory. Writers build a new copy, publish it atomically and then wait for the readers
+// which may still be using the old copy before releasing it.
+//
+// The readers are counted by the parity of a global epoch. The writer flips the epoch and
+// waits for the readers of the old parity to drain, twice so that both parities are waited
+// for. The readers arriving meanwhile are counted in the other parity, so the writer is not
+// starved by a continuous stream of readers.
+//
+// Writers must be serialized by the caller.
+//
+template <typename T>
+class rcu_snapshot
+{
+public:
+    typedef std::shared_ptr<const T> value_ptr;
+
+    explicit rcu_snapshot(value_ptr v = value_ptr(new T()))
+        : _current(new value_ptr(std::move(v))), _epoch(0), _max_reader_index(0)
+    {
+        for (auto &slot : _slots) {
+            slot.active[0].store(0, std::memory_order_relaxed);
+            slot.active[1].store(0, std::memory_order_relaxed);
+        }
+    }
+
+    ~rcu_snapshot() { delete _current.load(); }
+
+    // call 'reader' with the current snapshot and return its result.
+    // 'reader' should be short and non-blocking, as it delays the writers
+    template <typename TReader>
+    auto read(TReader &&reader) const -> decltype(reader(std::declval<const T &>()))
+    {
+        read_guard g(*this);
+        return reader(**_current.load());
+    }
+
+    // hold the current snapshot, which is useful for long readers such as iterations
+    value_ptr get() const
+    {
+        read_guard g(*this);
+        return *_current.load();
+    }
+
+    // replace the current snapshot with 'v', the old snapshot is released after all the
+    // readers which may still see it are done
+    void publish(value_ptr v)
+    {
+        value_ptr *old = _current.exchange(new value_ptr(std::move(v)));
+
+        for (int phase = 0; phase < 2; phase++) {
+            int parity = _epoch.fetch_add(1) & 1;
+            int max_index = _max_reader_index.load();
+            for (int i = 0; i <= max_index; i++) {
+                while (_slots[i].active[parity].load() != 0) {
+                    std::this_thread::yield();
+                }
+            }
+        }
+
+        delete old;
+    }
+
+private:
+    enum
+    {
+        MAX_READER_SLOTS = 256
+    };
+
+    struct reader_slot
+    {
+        // count of active readers by epoch parity, a slot is only shared by different
+        // threads when there are more threads than slots
+        std::atomic<int> active[2];
+        char padding[64 - 2 * sizeof(std::atomic<int>)];
+    };
+
+    class read_guard
+    {
+    public:
+        explicit read_guard(const rcu_snapshot &s)
+        {
+            int index = get_rcu_reader_index() % MAX_READER_SLOTS;
+            int max_index = s._max_reader_index.load(std::memory_order_relaxed);
+            while (index > max_index &&
+                   !s._max_reader_index.compare_exchange_weak(max_index, index)) {
+            }
+
+            // sequentially consistent with the exchange in publish(): if this reader sees the
+            // old snapshot, the writer is guaranteed to see it active
+            _active = &s._slots[index].active[s._epoch.load() & 1];
+            _active->fetch_add(1);
+        }
+
+        ~read_guard() { _active->fetch_sub(1, std::memory_order_release); }
+
+    private:
+        std::atomic<int> *_active;
+    };
+
+    std::atomic<value_ptr *> _current;
+    mutable std::atomic<int> _epoch;
+    mutable std::atomic<int> _max_reader_index;
+    mutable reader_slot _slots[MAX_READER_SLOTS];
+};
+}
+}
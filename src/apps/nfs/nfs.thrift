@@ -12,6 +12,9 @@ struct copy_request
     6: i32 size;
     7: bool is_last;
     8: bool overwrite;
+    // the client accepts the file content appended after the response, in which case
+    // copy_response.file_content is left empty, see nfs_service_impl::on_copy
+    9: optional bool zero_copy;
 }
 
 struct copy_response
@@ -20,6 +23,7 @@ struct copy_response
     2: dsn.blob file_content;
     3: i64 offset;
     4: i32 size;
+    5: optional i64 checksum; // crc32c of file_content
 }
 
 struct get_file_size_request
@@ -36,6 +40,9 @@ struct get_file_size_response
     1: i32 error;
     2: list<string> file_list;
     3: list<i64> size_list;
+    // last modification time of the files in seconds, so a resumed copy can tell whether
+    // the source file has been changed since the resume record was written
+    4: optional list<i64> mtime_list;
 }
 
 service nfs
@@ -35,6 +35,8 @@
 #include "nfs_client_impl.h"
 #include <dsn/tool-api/nfs.h>
 #include <dsn/utility/filesystem.h>
+#include <dsn/utility/crc.h>
+#include <fstream>
 #include <queue>
 
 namespace dsn {
@@ -46,7 +48,10 @@ nfs_client_impl::nfs_client_impl(nfs_opts &opts)
       _concurrent_local_write_count(0),
       _buffered_local_write_count(0),
       _copy_requests_low(_opts.max_file_copy_request_count_per_file),
-      _high_priority_remaining_time(_opts.high_priority_speed_rate)
+      _high_priority_remaining_time(_opts.high_priority_speed_rate),
+      _copy_quota_bytes((int64_t)_opts.max_copy_rate_megabytes << 20),
+      _copy_quota_refill_ms(dsn_now_ms()),
+      _copy_quota_timer_pending(false)
 {
     _recent_copy_data_size.init_app_counter("eon.nfs_client",
                                             "recent_copy_data_size",
@@ -66,6 +71,16 @@ nfs_client_impl::nfs_client_impl(nfs_opts &opts)
         "recent_write_fail_count",
         COUNTER_TYPE_VOLATILE_NUMBER,
         "nfs client write fail count count in the recent period");
+    _recent_checksum_fail_count.init_app_counter(
+        "eon.nfs_client",
+        "recent_checksum_fail_count",
+        COUNTER_TYPE_VOLATILE_NUMBER,
+        "nfs client copy checksum mismatch count in the recent period");
+    _recent_resumed_data_size.init_app_counter(
+        "eon.nfs_client",
+        "recent_resumed_data_size",
+        COUNTER_TYPE_VOLATILE_NUMBER,
+        "nfs client data size skipped by resuming in the recent period");
 }
 
 void nfs_client_impl::begin_remote_copy(std::shared_ptr<remote_copy_request> &rci,
@@ -115,16 +130,45 @@ void nfs_client_impl::end_get_file_size(::dsn::error_code err,
         return;
     }
 
+    // servers not telling the modification time of files do not support resuming
+    bool has_mtime = resp.__isset.mtime_list && resp.mtime_list.size() == resp.size_list.size();
+
     std::deque<copy_request_ex_ptr> copy_requests;
     ureq->file_contexts.resize(resp.size_list.size());
     for (size_t i = 0; i < resp.size_list.size(); i++) // file list
     {
         file_context_ptr filec(new file_context(ureq, resp.file_list[i], resp.size_list[i]));
+        if (has_mtime) {
+            filec->source_mtime = resp.mtime_list[i];
+        }
         ureq->file_contexts[i] = filec;
 
         // init copy requests
         uint64_t size = resp.size_list[i];
         uint64_t req_offset = 0;
+        if (_opts.enable_resumable_copy && size > 0 && filec->source_mtime >= 0) {
+            std::string file_path = dsn::utils::filesystem::path_combine(
+                ureq->file_size_req.dst_dir, filec->file_name);
+            req_offset = load_resume_offset(file_path, get_resume_source(*filec));
+            if (req_offset >= size) {
+                // copy the tail again, so the file is still completed by a write
+                req_offset = size > _opts.nfs_copy_block_bytes ? size - _opts.nfs_copy_block_bytes
+                                                               : 0;
+            }
+            if (req_offset > 0) {
+                ddebug("{nfs_service} resume copying file %s from offset %" PRIu64
+                       ", file_size = %" PRIu64,
+                       file_path.c_str(),
+                       req_offset,
+                       size);
+                _recent_resumed_data_size->add(req_offset);
+                filec->resume_offset = req_offset;
+                filec->verified_offset = req_offset;
+                filec->recorded_offset = req_offset;
+                size -= req_offset;
+            }
+        }
+
         uint32_t req_size = size > _opts.nfs_copy_block_bytes ? _opts.nfs_copy_block_bytes
                                                               : static_cast<uint32_t>(size);
 
@@ -182,6 +226,13 @@ void nfs_client_impl::continue_copy()
 
     copy_request_ex_ptr req = nullptr;
     while (true) {
+        if (!check_copy_quota()) {
+            // exceed max_copy_rate_megabytes limit, pause.
+            // the copy task will be triggered by the timer scheduled in check_copy_quota().
+            --_concurrent_copy_request_count;
+            break;
+        }
+
         {
             zauto_lock l(_copy_requests_lock);
 
@@ -227,22 +278,29 @@ void nfs_client_impl::continue_copy()
                 copy_req.source_dir = ureq->file_size_req.source_dir;
                 copy_req.overwrite = ureq->file_size_req.overwrite;
                 copy_req.is_last = req->is_last;
-                req->remote_copy_task = copy(copy_req,
-                                             [=](error_code err, copy_response &&resp) {
-                                                 end_copy(err, std::move(resp), req);
-                                                 // reset task to release memory quickly.
-                                                 // should do this after end_copy() done.
-                                                 if (req->is_ready_for_write) {
-                                                     ::dsn::task_ptr tsk;
-                                                     zauto_lock l(req->lock);
-                                                     tsk = std::move(req->remote_copy_task);
-                                                 }
-                                             },
-                                             std::chrono::milliseconds(_opts.rpc_timeout_ms),
-                                             0,
-                                             0,
-                                             0,
-                                             req->file_ctx->user_req->file_size_req.source);
+                if (_opts.enable_zero_copy)
+                    copy_req.__set_zero_copy(true);
+                consume_copy_quota(req->size);
+                req->remote_copy_task = ::dsn::rpc::call(
+                    ureq->file_size_req.source,
+                    RPC_NFS_COPY,
+                    copy_req,
+                    this,
+                    [=](error_code err, dsn_message_t request, dsn_message_t response) {
+                        copy_response resp;
+                        if (err == ERR_OK) {
+                            err = unmarshall_copy_response(response, resp);
+                        }
+                        end_copy(err, resp, req);
+                        // reset task to release memory quickly.
+                        // should do this after end_copy() done.
+                        if (req->is_ready_for_write) {
+                            ::dsn::task_ptr tsk;
+                            zauto_lock l(req->lock);
+                            tsk = std::move(req->remote_copy_task);
+                        }
+                    },
+                    std::chrono::milliseconds(_opts.rpc_timeout_ms));
             } else {
                 --ureq->concurrent_copy_count;
                 --_concurrent_copy_request_count;
@@ -258,6 +316,25 @@ void nfs_client_impl::continue_copy()
     }
 }
 
+error_code nfs_client_impl::unmarshall_copy_response(dsn_message_t msg,
+                                                     /*out*/ copy_response &resp)
+{
+    ::dsn::rpc_read_stream reader(msg);
+    ::dsn::unmarshall(reader, resp, dsn_msg_get_serialize_format(msg));
+
+    // the file content follows the response if it is sent in zero-copy mode
+    if (resp.error == ERR_OK && resp.file_content.length() == 0 && resp.size > 0) {
+        if (reader.get_remaining_size() != resp.size) {
+            derror("{nfs_service} invalid copy response, size = %d, remaining size = %d",
+                   resp.size,
+                   reader.get_remaining_size());
+            return ERR_INVALID_DATA;
+        }
+        reader.read(resp.file_content, resp.size);
+    }
+    return ERR_OK;
+}
+
 void nfs_client_impl::end_copy(::dsn::error_code err,
                                const copy_response &resp,
                                const copy_request_ex_ptr &reqc)
@@ -271,6 +348,22 @@ void nfs_client_impl::end_copy(::dsn::error_code err,
         err = resp.error;
     }
 
+    if (err == ERR_OK && resp.__isset.checksum) {
+        uint32_t crc = dsn::utils::crc32_calc(resp.file_content.data(), resp.size, 0);
+        if (crc != (uint32_t)resp.checksum) {
+            _recent_checksum_fail_count->increment();
+            derror("{nfs_service} checksum mismatch, source = %s, file = %s, offset = %" PRId64
+                   ", size = %d, expected = %u, actual = %u",
+                   fc->user_req->file_size_req.source.to_string(),
+                   fc->file_name.c_str(),
+                   resp.offset,
+                   resp.size,
+                   (uint32_t)resp.checksum,
+                   crc);
+            err = ERR_WRONG_CHECKSUM;
+        }
+    }
+
     if (err != ::dsn::ERR_OK) {
         _recent_copy_fail_count->increment();
 
@@ -395,8 +488,9 @@ void nfs_client_impl::continue_write()
         // double check
         zauto_lock l(fc->user_req->user_req_lock);
         if (!fc->file_holder->file_handle) {
-            fc->file_holder->file_handle =
-                dsn_file_open(file_path.c_str(), O_RDWR | O_CREAT | O_BINARY, 0666);
+            // keep the verified prefix when resuming, or drop the stale content
+            int flag = O_RDWR | O_CREAT | O_BINARY | (fc->resume_offset > 0 ? 0 : O_TRUNC);
+            fc->file_holder->file_handle = dsn_file_open(file_path.c_str(), flag, 0666);
         }
     }
 
@@ -452,15 +546,49 @@ void nfs_client_impl::end_write(error_code err, size_t sz, const copy_request_ex
         _recent_write_data_size->add(sz);
 
         file_wrapper_ptr temp_holder;
-        zauto_lock l(fc->user_req->user_req_lock);
-        if (!fc->user_req->is_finished &&
-            ++fc->finished_segments == (int)fc->copy_requests.size()) {
-            // release file to make it closed immediately after write done.
-            // we use temp_holder to make file closing out of lock.
-            temp_holder = std::move(fc->file_holder);
-
-            if (++fc->user_req->finished_files == (int)fc->user_req->file_contexts.size()) {
-                completed = true;
+        file_wrapper_ptr record_holder;
+        bool file_completed = false;
+        uint64_t record_offset = 0;
+        {
+            zauto_lock l(fc->user_req->user_req_lock);
+            if (!fc->user_req->is_finished) {
+                // advance the contiguous written prefix
+                reqc->is_written = true;
+                while (fc->verified_segments < (int)fc->copy_requests.size() &&
+                       fc->copy_requests[fc->verified_segments]->is_written) {
+                    const copy_request_ex_ptr &vreq = fc->copy_requests[fc->verified_segments];
+                    fc->verified_offset = vreq->offset + vreq->size;
+                    fc->verified_segments++;
+                }
+
+                if (++fc->finished_segments == (int)fc->copy_requests.size()) {
+                    // release file to make it closed immediately after write done.
+                    // we use temp_holder to make file closing out of lock.
+                    temp_holder = std::move(fc->file_holder);
+                    file_completed = true;
+
+                    if (++fc->user_req->finished_files ==
+                        (int)fc->user_req->file_contexts.size()) {
+                        completed = true;
+                    }
+                } else if (_opts.enable_resumable_copy && fc->source_mtime >= 0 &&
+                           fc->verified_offset - fc->recorded_offset >=
+                               ((uint64_t)_opts.resume_record_interval_megabytes << 20)) {
+                    fc->recorded_offset = fc->verified_offset;
+                    record_offset = fc->verified_offset;
+                    record_holder = fc->file_holder;
+                }
+            }
+        }
+
+        if (_opts.enable_resumable_copy && (file_completed || record_holder != nullptr)) {
+            std::string file_path = dsn::utils::filesystem::path_combine(
+                fc->user_req->file_size_req.dst_dir, fc->file_name);
+            if (file_completed) {
+                remove_resume_record(file_path);
+            } else if (dsn_file_flush(record_holder->file_handle) == ERR_OK) {
+                // only record the offset after the data before it is durable
+                save_resume_offset(file_path, get_resume_source(*fc), record_offset);
             }
         }
     }
@@ -503,5 +631,129 @@ void nfs_client_impl::handle_completion(const user_request_ptr &req, error_code
     // notify aio_task
     req->nfs_task->enqueue(err, err == ERR_OK ? total_size : 0);
 }
+bool nfs_client_impl::check_copy_quota()
+{
+    if (_opts.max_copy_rate_megabytes == 0)
+        return true;
+
+    zauto_lock l(_copy_quota_lock);
+    int64_t rate = (int64_t)_opts.max_copy_rate_megabytes << 20;
+    uint64_t now = dsn_now_ms();
+    if (now > _copy_quota_refill_ms) {
+        // allow a burst of at most one second
+        int64_t refill = (int64_t)(now - _copy_quota_refill_ms) * rate / 1000;
+        _copy_quota_bytes = std::min(rate, _copy_quota_bytes + refill);
+        _copy_quota_refill_ms = now;
+    }
+
+    if (_copy_quota_bytes > 0)
+        return true;
+
+    if (!_copy_quota_timer_pending) {
+        _copy_quota_timer_pending = true;
+        int64_t delay_ms = (-_copy_quota_bytes) * 1000 / rate + 1;
+        tasking::enqueue(LPC_NFS_COPY_THROTTLING,
+                         this,
+                         [this]() {
+                             {
+                                 zauto_lock l(_copy_quota_lock);
+                                 _copy_quota_timer_pending = false;
+                             }
+                             continue_copy();
+                         },
+                         0,
+                         std::chrono::milliseconds(delay_ms));
+    }
+    return false;
+}
+
+void nfs_client_impl::consume_copy_quota(uint32_t size)
+{
+    if (_opts.max_copy_rate_megabytes == 0)
+        return;
+
+    zauto_lock l(_copy_quota_lock);
+    _copy_quota_bytes -= size;
+}
+
+nfs_client_impl::resume_source nfs_client_impl::get_resume_source(const file_context &fc)
+{
+    resume_source src;
+    src.address = fc.user_req->file_size_req.source.to_std_string();
+    src.path =
+        dsn::utils::filesystem::path_combine(fc.user_req->file_size_req.source_dir, fc.file_name);
+    src.file_size = fc.file_size;
+    src.mtime = fc.source_mtime;
+    return src;
+}
+
+uint64_t nfs_client_impl::load_resume_offset(const std::string &file_path,
+                                             const resume_source &src)
+{
+    std::ifstream is(file_path + ".nfs_resume");
+    if (!is)
+        return 0;
+
+    std::string address, path;
+    uint64_t recorded_size = 0, offset = 0;
+    int64_t recorded_mtime = -1, local_size = 0;
+    if (!std::getline(is, address) || !std::getline(is, path) ||
+        !(is >> recorded_size >> recorded_mtime >> offset)) {
+        dwarn("{nfs_service} ignore invalid resume record of file %s", file_path.c_str());
+        return 0;
+    }
+    if (address != src.address || path != src.path || recorded_size != src.file_size ||
+        recorded_mtime != src.mtime) {
+        dwarn("{nfs_service} ignore stale resume record of file %s, which is recorded for %s "
+              "from %s with size = %" PRIu64 " and mtime = %" PRId64 ", but now copied for %s "
+              "from %s with size = %" PRIu64 " and mtime = %" PRId64,
+              file_path.c_str(),
+              path.c_str(),
+              address.c_str(),
+              recorded_size,
+              recorded_mtime,
+              src.path.c_str(),
+              src.address.c_str(),
+              src.file_size,
+              src.mtime);
+        return 0;
+    }
+    if (!dsn::utils::filesystem::file_size(file_path, local_size) ||
+        (uint64_t)local_size < offset) {
+        dwarn("{nfs_service} ignore resume record of file %s beyond its size", file_path.c_str());
+        return 0;
+    }
+    return offset;
+}
+
+void nfs_client_impl::save_resume_offset(const std::string &file_path,
+                                         const resume_source &src,
+                                         uint64_t offset)
+{
+    std::string record_path = file_path + ".nfs_resume";
+    std::string tmp_path = record_path + ".tmp";
+    {
+        std::ofstream os(tmp_path, std::ios::out | std::ios::trunc);
+        os << src.address << std::endl
+           << src.path << std::endl
+           << src.file_size << " " << src.mtime << " " << offset << std::endl;
+        if (!os) {
+            dwarn("{nfs_service} write resume record %s failed", tmp_path.c_str());
+            return;
+        }
+    }
+
+    if (!dsn::utils::filesystem::rename_path(tmp_path, record_path)) {
+        dwarn("{nfs_service} rename resume record %s failed", tmp_path.c_str());
+    }
+}
+
+void nfs_client_impl::remove_resume_record(const std::string &file_path)
+{
+    std::string record_path = file_path + ".nfs_resume";
+    if (dsn::utils::filesystem::file_exists(record_path)) {
+        dsn::utils::filesystem::remove_path(record_path);
+    }
+}
 }
 }
@@ -56,6 +56,11 @@ struct nfs_opts
     int max_retry_count_per_copy_request;
     int64_t rpc_timeout_ms;
 
+    uint32_t max_copy_rate_megabytes;
+    bool enable_resumable_copy;
+    uint32_t resume_record_interval_megabytes;
+    bool enable_zero_copy;
+
     void init()
     {
         nfs_copy_block_bytes =
@@ -101,6 +106,29 @@ struct nfs_opts
                                              10000,
                                              "rpc timeout in milliseconds for nfs copy, "
                                              "0 means use default timeout of rpc engine");
+        max_copy_rate_megabytes = (uint32_t)dsn_config_get_value_uint64(
+            "nfs",
+            "max_copy_rate_megabytes",
+            0,
+            "max remote copy rate (MB/s) of the nfs client on this node, 0 means no limit");
+        enable_resumable_copy = dsn_config_get_value_bool(
+            "nfs",
+            "enable_resumable_copy",
+            true,
+            "whether to record the verified offset of copying files, so an interrupted copy "
+            "into the same directory can be resumed from there");
+        resume_record_interval_megabytes = (uint32_t)dsn_config_get_value_uint64(
+            "nfs",
+            "resume_record_interval_megabytes",
+            64,
+            "flush the copying file and record its verified offset every such size (MB)");
+        enable_zero_copy = dsn_config_get_value_bool(
+            "nfs",
+            "enable_zero_copy",
+            false,
+            "whether the file content of copy responses is sent from the file by the network "
+            "directly (e.g., with sendfile) instead of being read into memory first, which is "
+            "only done for the ranges already in the page cache of the server");
     }
 };
 
@@ -143,6 +171,7 @@ public:
         ::dsn::task_ptr local_write_task;
         bool is_ready_for_write;
         bool is_valid;
+        bool is_written;
         int retry_count;
         zlock lock; // to protect is_valid
 
@@ -155,6 +184,7 @@ public:
             is_last = false;
             is_ready_for_write = false;
             is_valid = true;
+            is_written = false;
             retry_count = try_count;
         }
     };
@@ -171,6 +201,18 @@ public:
         int finished_segments;
         std::vector<copy_request_ex_ptr> copy_requests;
 
+        // the file is copied from resume_offset, as the bytes before are verified
+        // by a previous copy into the same path.
+        // verified_segments/verified_offset track the contiguous written prefix,
+        // and recorded_offset is the last one persisted for a later resume.
+        // source_mtime is the last modification time of the source file, or -1 if the
+        // remote server does not tell it, in which case the copy is not resumable.
+        uint64_t resume_offset;
+        int verified_segments;
+        uint64_t verified_offset;
+        uint64_t recorded_offset;
+        int64_t source_mtime;
+
         file_context(const user_request_ptr &req, const std::string &file_nm, uint64_t sz)
         {
             user_req = req;
@@ -179,6 +221,11 @@ public:
             file_holder = new file_wrapper();
             current_write_index = -1;
             finished_segments = 0;
+            resume_offset = 0;
+            verified_segments = 0;
+            verified_offset = 0;
+            recorded_offset = 0;
+            source_mtime = -1;
         }
     };
 
@@ -297,6 +344,9 @@ private:
 
     void continue_copy();
 
+    // the file content may follow the marshalled response, see copy_request.zero_copy
+    static error_code unmarshall_copy_response(dsn_message_t msg, /*out*/ copy_response &resp);
+
     void
     end_copy(::dsn::error_code err, const copy_response &resp, const copy_request_ex_ptr &reqc);
 
@@ -306,6 +356,28 @@ private:
 
     void handle_completion(const user_request_ptr &req, error_code err);
 
+    // bandwidth throttling of remote copy, see nfs_opts::max_copy_rate_megabytes.
+    // check_copy_quota() schedules continue_copy() when the quota is exhausted.
+    bool check_copy_quota();
+    void consume_copy_quota(uint32_t size);
+
+    // resume record of a copying file, stored in "<file_path>.nfs_resume" as
+    //   <source address>\n<source path>\n<file size> <source mtime> <offset>\n
+    // it is only used for copying the same version of the same source file again
+    struct resume_source
+    {
+        std::string address;
+        std::string path;
+        uint64_t file_size;
+        int64_t mtime;
+    };
+    static resume_source get_resume_source(const file_context &fc);
+    static uint64_t load_resume_offset(const std::string &file_path, const resume_source &src);
+    static void save_resume_offset(const std::string &file_path,
+                                   const resume_source &src,
+                                   uint64_t offset);
+    static void remove_resume_record(const std::string &file_path);
+
 private:
     nfs_opts &_opts;
 
@@ -324,10 +396,17 @@ private:
     zlock _local_writes_lock;
     std::deque<copy_request_ex_ptr> _local_writes;
 
+    zlock _copy_quota_lock;
+    int64_t _copy_quota_bytes;
+    uint64_t _copy_quota_refill_ms;
+    bool _copy_quota_timer_pending;
+
     perf_counter_wrapper _recent_copy_data_size;
     perf_counter_wrapper _recent_copy_fail_count;
     perf_counter_wrapper _recent_write_data_size;
     perf_counter_wrapper _recent_write_fail_count;
+    perf_counter_wrapper _recent_checksum_fail_count;
+    perf_counter_wrapper _recent_resumed_data_size;
 };
 }
 }
@@ -35,7 +35,15 @@
 #include "nfs_server_impl.h"
 #include <cstdlib>
 #include <sys/stat.h>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 #include <dsn/utility/filesystem.h>
+#include <dsn/utility/crc.h>
+#include <dsn/tool-api/rpc_message.h>
+#include <dsn/tool-api/network.h>
 
 namespace dsn {
 namespace service {
@@ -106,6 +114,11 @@ void nfs_service_impl::on_copy(const ::dsn::service::copy_request &request,
         return;
     }
 
+    if (_opts.enable_zero_copy && request.__isset.zero_copy && request.zero_copy &&
+        reply_with_file_segment(request, file_path, hfile, reply)) {
+        return;
+    }
+
     callback_para cp(std::move(reply));
     cp.bb = blob(dsn::utils::make_shared_array<char>(request.size), request.size);
     cp.dst_dir = std::move(request.dst_dir);
@@ -145,10 +158,113 @@ void nfs_service_impl::internal_read_callback(error_code err, size_t sz, callbac
     resp.file_content = std::move(cp.bb);
     resp.offset = cp.offset;
     resp.size = cp.size;
+    if (err == ERR_OK) {
+        // let the client verify the content
+        resp.__set_checksum(dsn::utils::crc32_calc(resp.file_content.data(), resp.size, 0));
+    }
 
     cp.replier(resp);
 }
 
+#ifndef _WIN32
+// compute the crc of [offset, offset + size) of the file only if the range is all in the
+// page cache, so neither this nor the later sendfile blocks on disk reads
+static bool checksum_cached_file_range(int fd, uint64_t offset, uint32_t size, uint32_t &crc)
+{
+    static const uint64_t page_size = (uint64_t)::sysconf(_SC_PAGESIZE);
+    uint64_t start = offset / page_size * page_size;
+    size_t length = (size_t)(offset + size - start);
+    void *addr = ::mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, (off_t)start);
+    if (addr == MAP_FAILED) {
+        return false;
+    }
+
+    std::vector<unsigned char> pages((length + page_size - 1) / page_size);
+    bool cached = (0 == ::mincore(addr, length, pages.data()));
+    for (size_t i = 0; cached && i < pages.size(); ++i) {
+        cached = (pages[i] & 1) != 0;
+    }
+    if (cached) {
+        crc = dsn::utils::crc32_calc((const char *)addr + (offset - start), size, 0);
+    }
+    ::munmap(addr, length);
+    return cached;
+}
+#endif
+
+bool nfs_service_impl::reply_with_file_segment(const copy_request &request,
+                                               const std::string &file_path,
+                                               dsn_handle_t hfile,
+                                               ::dsn::rpc_replier<copy_response> &reply)
+{
+#ifdef _WIN32
+    return false;
+#else
+    // otherwise the segment would be read on the rpc thread without a checksum
+    message_ex *msg = (message_ex *)reply.response();
+    rpc_session *s = (msg == nullptr ? nullptr : msg->io_session.get());
+    if (s == nullptr || msg->header->context.u.is_forwarded || !s->can_send_file_segment(msg)) {
+        return false;
+    }
+
+    // the announced body length must be satisfied by the file
+    int fd = (int)(uintptr_t)dsn_file_native_handle(hfile);
+    struct stat st;
+    if (request.size <= 0 || 0 != ::fstat(fd, &st) ||
+        request.offset + request.size > (int64_t)st.st_size) {
+        return false;
+    }
+
+    // the segment is sent by sendfile on the io looper thread, where a page cache miss would
+    // stall all the sessions of the looper. so only the cached ranges are sent this way, and
+    // once a range of the file is found not cached, the file is not probed any more but read
+    // by the buffered reply, which is done off the looper
+    {
+        zauto_lock l(_handles_map_lock);
+        auto it = _handles_map.find(file_path);
+        if (it == _handles_map.end() || it->second->uncached) {
+            return false;
+        }
+    }
+    uint32_t crc = 0;
+    if (!checksum_cached_file_range(fd, (uint64_t)request.offset, (uint32_t)request.size, crc)) {
+        dinfo("nfs: file %s [%" PRId64 ", %" PRId64 ") is not cached, reply with buffer",
+              file_path.c_str(),
+              request.offset,
+              request.offset + request.size);
+        zauto_lock l(_handles_map_lock);
+        auto it = _handles_map.find(file_path);
+        if (it != _handles_map.end()) {
+            it->second->uncached = true;
+        }
+        return false;
+    }
+
+    // the file access is released after the segment is sent
+    std::shared_ptr<void> holder(nullptr, [this, file_path](void *) {
+        zauto_lock l(_handles_map_lock);
+        auto it = _handles_map.find(file_path);
+        if (it != _handles_map.end()) {
+            it->second->file_access_count--;
+        }
+    });
+
+    _recent_copy_data_size->add(request.size);
+
+    // file_content is left empty, and the content follows the marshalled response
+    ::dsn::service::copy_response resp;
+    resp.error = ERR_OK;
+    resp.offset = request.offset;
+    resp.size = request.size;
+    resp.__set_checksum(crc);
+    reply(resp, [&](dsn_message_t m) {
+        ((message_ex *)m)
+            ->attach_file_segment(fd, (uint64_t)request.offset, (uint32_t)request.size, holder);
+    });
+    return true;
+#endif
+}
+
 // RPC_NFS_NEW_NFS_GET_FILE_SIZE
 void nfs_service_impl::on_get_file_size(
     const ::dsn::service::get_file_size_request &request,
@@ -174,13 +290,16 @@ void nfs_service_impl::on_get_file_size(
                     // TODO: using uint64 instead as file ma
                     // Done
                     int64_t sz;
-                    if (!dsn::utils::filesystem::file_size(fpath, sz)) {
+                    time_t mtime;
+                    if (!dsn::utils::filesystem::file_size(fpath, sz) ||
+                        !dsn::utils::filesystem::last_write_time(fpath, mtime)) {
                         derror("{nfs_service} get size of file %s failed", fpath.c_str());
                         err = ERR_FILE_OPERATION_FAILED;
                         break;
                     }
 
                     resp.size_list.push_back((uint64_t)sz);
+                    resp.mtime_list.push_back((int64_t)mtime);
                     resp.file_list.push_back(
                         fpath.substr(request.source_dir.length(), fpath.length() - 1));
                 }
@@ -207,6 +326,7 @@ void nfs_service_impl::on_get_file_size(
             uint64_t size = st.st_size;
 
             resp.size_list.push_back(size);
+            resp.mtime_list.push_back((int64_t)st.st_mtime);
             resp.file_list.push_back((folder + request.file_list[i])
                                          .substr(request.source_dir.length(),
                                                  (folder + request.file_list[i]).length() - 1));
@@ -214,6 +334,7 @@ void nfs_service_impl::on_get_file_size(
     }
 
     resp.error = err;
+    resp.__isset.mtime_list = true;
     reply(resp);
 }
 
@@ -88,15 +88,25 @@ private:
         dsn_handle_t file_handle;
         int32_t file_access_count; // concurrent r/w count
         uint64_t last_access_time; // last touch time
+        bool uncached;             // some range is not in page cache, so no more file segment
 
         file_handle_info_on_server()
-            : file_handle(nullptr), file_access_count(0), last_access_time(0)
+            : file_handle(nullptr), file_access_count(0), last_access_time(0), uncached(false)
         {
         }
     };
 
     void internal_read_callback(error_code err, size_t sz, callback_para &cp);
 
+    // reply the file range as a file segment of the response message, which the network
+    // sends without reading it into memory, see message_ex::attach_file_segment.
+    // it is only applicable when the session can send file segments and the range is in
+    // the page cache, otherwise false is returned and the reply is not consumed.
+    bool reply_with_file_segment(const copy_request &request,
+                                 const std::string &file_path,
+                                 dsn_handle_t hfile,
+                                 ::dsn::rpc_replier<copy_response> &reply);
+
     void close_file();
 
 private:
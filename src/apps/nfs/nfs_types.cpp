@@ -50,6 +50,11 @@ void copy_request::__set_overwrite(const bool val) {
   this->overwrite = val;
 }
 
+void copy_request::__set_zero_copy(const bool val) {
+  this->zero_copy = val;
+__isset.zero_copy = true;
+}
+
 uint32_t copy_request::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
@@ -135,6 +140,14 @@ uint32_t copy_request::read(::apache::thrift::protocol::TProtocol* iprot) {
           xfer += iprot->skip(ftype);
         }
         break;
+      case 9:
+        if (ftype == ::apache::thrift::protocol::T_BOOL) {
+          xfer += iprot->readBool(this->zero_copy);
+          this->__isset.zero_copy = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -184,6 +197,11 @@ uint32_t copy_request::write(::apache::thrift::protocol::TProtocol* oprot) const
   xfer += oprot->writeBool(this->overwrite);
   xfer += oprot->writeFieldEnd();
 
+  if (this->__isset.zero_copy) {
+    xfer += oprot->writeFieldBegin("zero_copy", ::apache::thrift::protocol::T_BOOL, 9);
+    xfer += oprot->writeBool(this->zero_copy);
+    xfer += oprot->writeFieldEnd();
+  }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
   return xfer;
@@ -199,6 +217,7 @@ void swap(copy_request &a, copy_request &b) {
   swap(a.size, b.size);
   swap(a.is_last, b.is_last);
   swap(a.overwrite, b.overwrite);
+  swap(a.zero_copy, b.zero_copy);
   swap(a.__isset, b.__isset);
 }
 
@@ -211,6 +230,7 @@ copy_request::copy_request(const copy_request& other0) {
   size = other0.size;
   is_last = other0.is_last;
   overwrite = other0.overwrite;
+  zero_copy = other0.zero_copy;
   __isset = other0.__isset;
 }
 copy_request::copy_request( copy_request&& other1) {
@@ -222,6 +242,7 @@ copy_request::copy_request( copy_request&& other1) {
   size = std::move(other1.size);
   is_last = std::move(other1.is_last);
   overwrite = std::move(other1.overwrite);
+  zero_copy = std::move(other1.zero_copy);
   __isset = std::move(other1.__isset);
 }
 copy_request& copy_request::operator=(const copy_request& other2) {
@@ -233,6 +254,7 @@ copy_request& copy_request::operator=(const copy_request& other2) {
   size = other2.size;
   is_last = other2.is_last;
   overwrite = other2.overwrite;
+  zero_copy = other2.zero_copy;
   __isset = other2.__isset;
   return *this;
 }
@@ -245,6 +267,7 @@ copy_request& copy_request::operator=(copy_request&& other3) {
   size = std::move(other3.size);
   is_last = std::move(other3.is_last);
   overwrite = std::move(other3.overwrite);
+  zero_copy = std::move(other3.zero_copy);
   __isset = std::move(other3.__isset);
   return *this;
 }
@@ -259,6 +282,7 @@ void copy_request::printTo(std::ostream& out) const {
   out << ", " << "size=" << to_string(size);
   out << ", " << "is_last=" << to_string(is_last);
   out << ", " << "overwrite=" << to_string(overwrite);
+  out << ", " << "zero_copy="; (__isset.zero_copy ? (out << to_string(zero_copy)) : (out << "<null>"));
   out << ")";
 }
 
@@ -283,6 +307,11 @@ void copy_response::__set_size(const int32_t val) {
   this->size = val;
 }
 
+void copy_response::__set_checksum(const int64_t val) {
+  this->checksum = val;
+__isset.checksum = true;
+}
+
 uint32_t copy_response::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
@@ -336,6 +365,14 @@ uint32_t copy_response::read(::apache::thrift::protocol::TProtocol* iprot) {
           xfer += iprot->skip(ftype);
         }
         break;
+      case 5:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->checksum);
+          this->__isset.checksum = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -369,6 +406,11 @@ uint32_t copy_response::write(::apache::thrift::protocol::TProtocol* oprot) cons
   xfer += oprot->writeI32(this->size);
   xfer += oprot->writeFieldEnd();
 
+  if (this->__isset.checksum) {
+    xfer += oprot->writeFieldBegin("checksum", ::apache::thrift::protocol::T_I64, 5);
+    xfer += oprot->writeI64(this->checksum);
+    xfer += oprot->writeFieldEnd();
+  }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
   return xfer;
@@ -380,6 +422,7 @@ void swap(copy_response &a, copy_response &b) {
   swap(a.file_content, b.file_content);
   swap(a.offset, b.offset);
   swap(a.size, b.size);
+  swap(a.checksum, b.checksum);
   swap(a.__isset, b.__isset);
 }
 
@@ -388,6 +431,7 @@ copy_response::copy_response(const copy_response& other4) {
   file_content = other4.file_content;
   offset = other4.offset;
   size = other4.size;
+  checksum = other4.checksum;
   __isset = other4.__isset;
 }
 copy_response::copy_response( copy_response&& other5) {
@@ -395,6 +439,7 @@ copy_response::copy_response( copy_response&& other5) {
   file_content = std::move(other5.file_content);
   offset = std::move(other5.offset);
   size = std::move(other5.size);
+  checksum = std::move(other5.checksum);
   __isset = std::move(other5.__isset);
 }
 copy_response& copy_response::operator=(const copy_response& other6) {
@@ -402,6 +447,7 @@ copy_response& copy_response::operator=(const copy_response& other6) {
   file_content = other6.file_content;
   offset = other6.offset;
   size = other6.size;
+  checksum = other6.checksum;
   __isset = other6.__isset;
   return *this;
 }
@@ -410,6 +456,7 @@ copy_response& copy_response::operator=(copy_response&& other7) {
   file_content = std::move(other7.file_content);
   offset = std::move(other7.offset);
   size = std::move(other7.size);
+  checksum = std::move(other7.checksum);
   __isset = std::move(other7.__isset);
   return *this;
 }
@@ -420,6 +467,7 @@ void copy_response::printTo(std::ostream& out) const {
   out << ", " << "file_content=" << to_string(file_content);
   out << ", " << "offset=" << to_string(offset);
   out << ", " << "size=" << to_string(size);
+  out << ", " << "checksum="; (__isset.checksum ? (out << to_string(checksum)) : (out << "<null>"));
   out << ")";
 }
 
@@ -643,6 +691,11 @@ void get_file_size_response::__set_size_list(const std::vector<int64_t> & val) {
   this->size_list = val;
 }
 
+void get_file_size_response::__set_mtime_list(const std::vector<int64_t> & val) {
+  this->mtime_list = val;
+__isset.mtime_list = true;
+}
+
 uint32_t get_file_size_response::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
@@ -712,6 +765,26 @@ uint32_t get_file_size_response::read(::apache::thrift::protocol::TProtocol* ipr
           xfer += iprot->skip(ftype);
         }
         break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->mtime_list.clear();
+            uint32_t _size34;
+            ::apache::thrift::protocol::TType _etype37;
+            xfer += iprot->readListBegin(_etype37, _size34);
+            this->mtime_list.resize(_size34);
+            uint32_t _i38;
+            for (_i38 = 0; _i38 < _size34; ++_i38)
+            {
+              xfer += iprot->readI64(this->mtime_list[_i38]);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.mtime_list = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -757,6 +830,19 @@ uint32_t get_file_size_response::write(::apache::thrift::protocol::TProtocol* op
   }
   xfer += oprot->writeFieldEnd();
 
+  if (this->__isset.mtime_list) {
+    xfer += oprot->writeFieldBegin("mtime_list", ::apache::thrift::protocol::T_LIST, 4);
+    {
+      xfer += oprot->writeListBegin(::apache::thrift::protocol::T_I64, static_cast<uint32_t>(this->mtime_list.size()));
+      std::vector<int64_t> ::const_iterator _iter39;
+      for (_iter39 = this->mtime_list.begin(); _iter39 != this->mtime_list.end(); ++_iter39)
+      {
+        xfer += oprot->writeI64((*_iter39));
+      }
+      xfer += oprot->writeListEnd();
+    }
+    xfer += oprot->writeFieldEnd();
+  }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
   return xfer;
@@ -767,6 +853,7 @@ void swap(get_file_size_response &a, get_file_size_response &b) {
   swap(a.error, b.error);
   swap(a.file_list, b.file_list);
   swap(a.size_list, b.size_list);
+  swap(a.mtime_list, b.mtime_list);
   swap(a.__isset, b.__isset);
 }
 
@@ -774,18 +861,21 @@ get_file_size_response::get_file_size_response(const get_file_size_response& oth
   error = other30.error;
   file_list = other30.file_list;
   size_list = other30.size_list;
+  mtime_list = other30.mtime_list;
   __isset = other30.__isset;
 }
 get_file_size_response::get_file_size_response( get_file_size_response&& other31) {
   error = std::move(other31.error);
   file_list = std::move(other31.file_list);
   size_list = std::move(other31.size_list);
+  mtime_list = std::move(other31.mtime_list);
   __isset = std::move(other31.__isset);
 }
 get_file_size_response& get_file_size_response::operator=(const get_file_size_response& other32) {
   error = other32.error;
   file_list = other32.file_list;
   size_list = other32.size_list;
+  mtime_list = other32.mtime_list;
   __isset = other32.__isset;
   return *this;
 }
@@ -793,6 +883,7 @@ get_file_size_response& get_file_size_response::operator=(get_file_size_response
   error = std::move(other33.error);
   file_list = std::move(other33.file_list);
   size_list = std::move(other33.size_list);
+  mtime_list = std::move(other33.mtime_list);
   __isset = std::move(other33.__isset);
   return *this;
 }
@@ -802,6 +893,7 @@ void get_file_size_response::printTo(std::ostream& out) const {
   out << "error=" << to_string(error);
   out << ", " << "file_list=" << to_string(file_list);
   out << ", " << "size_list=" << to_string(size_list);
+  out << ", " << "mtime_list="; (__isset.mtime_list ? (out << to_string(mtime_list)) : (out << "<null>"));
   out << ")";
 }
 
@@ -0,0 +1,199 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015 Microsoft Corporation
+ *
+ * -=- Robust Distributed System Nucleus (rDSN) -=-
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * Description:
+ *     stackless coroutines atop tasking, rpc and file apis
+ *
+ * Revision history:
+ *     xxxx-xx-xx, author, first version
+ *     xxxx-xx-xx, author, fix bug about xxx
+ */
+
+#include <dsn/cpp/coroutine.h>
+
+namespace dsn {
+
+task_ptr coroutine::start()
+{
+    dassert(_co_line == 0, "coroutine can only be started once");
+    task_ptr self(this);
+    run();
+    return self;
+}
+
+bool coroutine::cancel(bool wait_until_finished, bool *finished)
+{
+    // the body may switch to another task concurrently, so the current one is held while
+    // being cancelled, and the next one is cancelled as well if the body has switched to
+    // it meanwhile. the coroutine is only marked cancelled when the cancellation takes
+    // effect, as a caller seeing it still running (e.g., CLEANUP_TASK) keeps the handle and
+    // expects the coroutine to go on.
+    while (true) {
+        dsn_task_t t;
+        {
+            utils::auto_lock<utils::ex_lock_nr_spin> l(_task_lock);
+            t = native_handle();
+            if (t != nullptr)
+                dsn_task_add_ref(t);
+        }
+
+        // done without any suspension
+        if (t == nullptr) {
+            if (finished != nullptr)
+                *finished = true;
+            return false;
+        }
+
+        bool fin = false;
+        bool r = dsn_task_cancel2(t, wait_until_finished, &fin);
+        bool switched = false;
+        if (r || fin) {
+            utils::auto_lock<utils::ex_lock_nr_spin> l(_task_lock);
+            switched = (native_handle() != t);
+            if (!switched)
+                _cancelled = true;
+        }
+        dsn_task_release_ref(t);
+
+        if (!switched) {
+            if (finished != nullptr)
+                *finished = (r || fin);
+            return r;
+        }
+    }
+}
+
+void coroutine::suspend_on(dsn_task_t t)
+{
+    add_ref(); // released in exec_xxx or on_cancel
+
+    utils::auto_lock<utils::ex_lock_nr_spin> l(_task_lock);
+    set_task_info(t);
+}
+
+bool coroutine::await_task(dsn::task_code code, int hash, std::chrono::milliseconds delay)
+{
+    if (delay.count() == 0 && dsn_task_shares_current_worker(code, hash)) {
+        co_err = ERR_OK;
+        return true;
+    }
+
+    auto t = dsn_task_create_ex(code, exec, on_cancel, this, hash, tracker());
+    suspend_on(t);
+    // the coroutine may be resumed on another thread from now on
+    dsn_task_call(t, static_cast<int>(delay.count()));
+    return false;
+}
+
+bool coroutine::await_rpc(::dsn::rpc_address server, dsn_message_t request, int reply_thread_hash)
+{
+    auto t = dsn_rpc_create_response_task_ex(
+        request, exec_rpc_response, on_cancel, this, reply_thread_hash, tracker());
+    suspend_on(t);
+    dsn_rpc_call(server.c_addr(), t);
+    return false;
+}
+
+bool coroutine::await_read(dsn_handle_t fh,
+                           char *buffer,
+                           int count,
+                           uint64_t offset,
+                           dsn::task_code callback_code,
+                           int hash)
+{
+    auto t = dsn_file_create_aio_task_ex(callback_code, exec_aio, on_cancel, this, hash, tracker());
+    suspend_on(t);
+    dsn_file_read(fh, buffer, count, offset, t);
+    return false;
+}
+
+bool coroutine::await_write(dsn_handle_t fh,
+                            const char *buffer,
+                            int count,
+                            uint64_t offset,
+                            dsn::task_code callback_code,
+                            int hash)
+{
+    auto t = dsn_file_create_aio_task_ex(callback_code, exec_aio, on_cancel, this, hash, tracker());
+    suspend_on(t);
+    dsn_file_write(fh, buffer, count, offset, t);
+    return false;
+}
+
+bool coroutine::await_copy_remote_files(::dsn::rpc_address remote,
+                                        const std::string &source_dir,
+                                        const std::vector<std::string> &files,
+                                        const std::string &dest_dir,
+                                        bool overwrite,
+                                        bool high_priority,
+                                        dsn::task_code callback_code,
+                                        int hash)
+{
+    auto t = dsn_file_create_aio_task_ex(callback_code, exec_aio, on_cancel, this, hash, tracker());
+    suspend_on(t);
+    file::copy_remote_files_impl(remote, source_dir, files, dest_dir, overwrite, high_priority, t);
+    return false;
+}
+
+/*static*/ void coroutine::exec(void *co)
+{
+    auto c = static_cast<coroutine *>(co);
+    if (!c->_cancelled) {
+        c->co_err = ERR_OK;
+        c->run();
+    }
+    c->release_ref(); // added in suspend_on
+}
+
+/*static*/ void
+coroutine::exec_rpc_response(error_code err, dsn_message_t req, dsn_message_t resp, void *co)
+{
+    auto c = static_cast<coroutine *>(co);
+    if (!c->_cancelled) {
+        c->co_err = err;
+        c->co_response = resp;
+        c->run();
+    }
+    c->release_ref(); // added in suspend_on
+}
+
+/*static*/ void coroutine::exec_aio(error_code err, size_t sz, void *co)
+{
+    auto c = static_cast<coroutine *>(co);
+    if (!c->_cancelled) {
+        c->co_err = err;
+        c->co_io_size = sz;
+        c->run();
+    }
+    c->release_ref(); // added in suspend_on
+}
+
+/*static*/ void coroutine::on_cancel(void *co)
+{
+    static_cast<coroutine *>(co)->release_ref(); // added in suspend_on
+}
+}
@@ -1,5 +1,10 @@
 #include <cstdio>
+#include <cstring>
 #include <dsn/utility/crc.h>
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <nmmintrin.h>
+#include <wmmintrin.h>
+#endif
 
 namespace dsn {
 namespace utils {
@@ -409,10 +414,213 @@ uint64_t crc64::_crc_table[sizeof(crc64::_crc_table) / sizeof(crc64::_crc_table[
     0x620ba46c27f3aa2c, 0x1d6554a417c62355, 0x9cd645fc4798b8de, 0xe3b8b53477ad31a7,
     0xab69411fbfb21ca3, 0xd407b1d78f8795da, 0x55b4a08fdfd90e51, 0x2ada5047efec8728};
 
+//
+// slice-by-8: consume 8 bytes per step with 8 lookup tables derived from _crc_table,
+// which is the portable fallback when there is no hardware support
+//
+template <typename generator>
+struct crc_slice8
+{
+    typedef typename generator::uint uintxx_t;
+
+    uintxx_t table[8][256];
+
+    crc_slice8()
+    {
+        for (int i = 0; i < 256; ++i) {
+            table[0][i] = generator::_crc_table[i];
+        }
+        for (int t = 1; t < 8; ++t) {
+            for (int i = 0; i < 256; ++i) {
+                uintxx_t c = table[t - 1][i];
+                table[t][i] = table[0][(uint8_t)c] ^ (c >> 8);
+            }
+        }
+    }
+
+    static const crc_slice8 &instance()
+    {
+        static crc_slice8 s_instance;
+        return s_instance;
+    }
+
+    static uintxx_t compute(const void *pSrc, size_t uSize, uintxx_t uCrc)
+    {
+        const uintxx_t(*t)[256] = instance().table;
+        const uint8_t *pData = (const uint8_t *)pSrc;
+
+        uCrc = ~uCrc;
+
+        // align the data for the 8-byte loads
+        for (; uSize > 0 && ((uintptr_t)pData & 7) != 0; --uSize, ++pData)
+            uCrc = t[0][(uint8_t)(uCrc ^ pData[0])] ^ (uCrc >> 8);
+
+        for (; uSize >= 8; uSize -= 8, pData += 8) {
+            uint64_t v;
+            memcpy(&v, pData, sizeof(v));
+            v = to_little_endian(v) ^ (uint64_t)uCrc;
+            uCrc = t[7][(uint8_t)v] ^ t[6][(uint8_t)(v >> 8)] ^ t[5][(uint8_t)(v >> 16)] ^
+                   t[4][(uint8_t)(v >> 24)] ^ t[3][(uint8_t)(v >> 32)] ^
+                   t[2][(uint8_t)(v >> 40)] ^ t[1][(uint8_t)(v >> 48)] ^ t[0][(uint8_t)(v >> 56)];
+        }
+
+        for (; uSize > 0; --uSize, ++pData)
+            uCrc = t[0][(uint8_t)(uCrc ^ pData[0])] ^ (uCrc >> 8);
+
+        return ~uCrc;
+    }
+
+    static uint64_t to_little_endian(uint64_t v)
+    {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        return __builtin_bswap64(v);
+#else
+        return v;
+#endif
+    }
+};
+
+typedef crc_slice8<crc32> crc32_slice8;
+typedef crc_slice8<crc64> crc64_slice8;
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define DSN_CRC_X86_HW 1
+
+//
+// crc32c with the SSE4.2 crc32 instruction, 8 bytes per instruction
+//
+__attribute__((target("sse4.2"))) static uint32_t
+crc32_sse42_update(const uint8_t *pData, size_t uSize, uint32_t uCrc)
+{
+    for (; uSize > 0 && ((uintptr_t)pData & 7) != 0; --uSize, ++pData)
+        uCrc = _mm_crc32_u8(uCrc, *pData);
+
+    uint64_t c = uCrc;
+    for (; uSize >= 8; uSize -= 8, pData += 8)
+        c = _mm_crc32_u64(c, *(const uint64_t *)pData);
+    uCrc = (uint32_t)c;
+
+    for (; uSize > 0; --uSize, ++pData)
+        uCrc = _mm_crc32_u8(uCrc, *pData);
+
+    return uCrc;
+}
+
+static uint32_t crc32_sse42(const void *pSrc, size_t uSize, uint32_t uCrc)
+{
+    return ~crc32_sse42_update((const uint8_t *)pSrc, uSize, ~uCrc);
+}
+
+//
+// crc32c for large buffers: the crc32 instruction has a latency of 3 cycles but a throughput
+// of 1 per cycle, so 3 adjacent stripes are computed in an interleaved way and then folded
+// together by multiplying with x**(8*stripe_size) with PCLMULQDQ
+//
+struct crc32_pclmul
+{
+    static const size_t LONG_STRIPE = 8192;
+    static const size_t SHORT_STRIPE = 256;
+
+    uint32_t long_shift;  // x**(8*LONG_STRIPE) mod POLY
+    uint32_t short_shift; // x**(8*SHORT_STRIPE) mod POLY
+
+    crc32_pclmul()
+    {
+        long_shift = crc32::ComputeX_N(LONG_STRIPE);
+        short_shift = crc32::ComputeX_N(SHORT_STRIPE);
+    }
+
+    static const crc32_pclmul &instance()
+    {
+        static crc32_pclmul s_instance;
+        return s_instance;
+    }
+
+    //
+    // Returns (a * b) mod POLY, same as crc32::MulPoly.
+    // The carry-less product of the two reversed 32-bit polynomials is a reversed 63-bit
+    // polynomial, after shifting it by one bit, the lower half holds the coefficients of
+    // x**32..x**63, which are reduced by the crc32 instruction, while the upper half holds
+    // those of x**0..x**31.
+    //
+    __attribute__((target("sse4.2,pclmul"))) static uint32_t multiply(uint32_t a, uint32_t b)
+    {
+        __m128i p = _mm_clmulepi64_si128(_mm_cvtsi32_si128(a), _mm_cvtsi32_si128(b), 0);
+        uint64_t v = (uint64_t)_mm_cvtsi128_si64(p) << 1;
+        return _mm_crc32_u32(0, (uint32_t)v) ^ (uint32_t)(v >> 32);
+    }
+
+    template <size_t STRIPE>
+    __attribute__((target("sse4.2,pclmul"))) static uint32_t
+    update_stripes(const uint8_t *&pData, size_t &uSize, uint32_t uCrc, uint32_t shift)
+    {
+        while (uSize >= 3 * STRIPE) {
+            const uint64_t *p = (const uint64_t *)pData;
+            uint64_t a = uCrc, b = 0, c = 0;
+            for (size_t i = 0; i < STRIPE / 8; ++i) {
+                a = _mm_crc32_u64(a, p[i]);
+                b = _mm_crc32_u64(b, p[i + STRIPE / 8]);
+                c = _mm_crc32_u64(c, p[i + 2 * STRIPE / 8]);
+            }
+
+            // crc(ABC) = (crc(A) * x**(16*STRIPE) + crc(B) * x**(8*STRIPE) + crc(C)) mod POLY
+            uCrc = multiply(multiply((uint32_t)a, shift) ^ (uint32_t)b, shift) ^ (uint32_t)c;
+            pData += 3 * STRIPE;
+            uSize -= 3 * STRIPE;
+        }
+        return uCrc;
+    }
+
+    __attribute__((target("sse4.2,pclmul"))) static uint32_t
+    compute(const void *pSrc, size_t uSize, uint32_t uCrc)
+    {
+        const crc32_pclmul &s = instance();
+        const uint8_t *pData = (const uint8_t *)pSrc;
+
+        uCrc = ~uCrc;
+        for (; uSize > 0 && ((uintptr_t)pData & 7) != 0; --uSize, ++pData)
+            uCrc = _mm_crc32_u8(uCrc, *pData);
+
+        uCrc = update_stripes<LONG_STRIPE>(pData, uSize, uCrc, s.long_shift);
+        uCrc = update_stripes<SHORT_STRIPE>(pData, uSize, uCrc, s.short_shift);
+        uCrc = crc32_sse42_update(pData, uSize, uCrc);
+
+        return ~uCrc;
+    }
+};
+#endif // DSN_CRC_X86_HW
+
 #undef crc32_POLY
 #undef crc64_POLY
 #undef BIT64
 #undef BIT32
+
+static const std::vector<crc32_impl> &crc32_impl_list()
+{
+    static std::vector<crc32_impl> s_impls = []() {
+        std::vector<crc32_impl> impls;
+        impls.push_back({"table", crc32::compute});
+        impls.push_back({"slice8", crc32_slice8::compute});
+#ifdef DSN_CRC_X86_HW
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("sse4.2")) {
+            impls.push_back({"sse42", crc32_sse42});
+            if (__builtin_cpu_supports("pclmul")) {
+                impls.push_back({"sse42_pclmul", crc32_pclmul::compute});
+            }
+        }
+#endif
+        return impls;
+    }();
+    return s_impls;
+}
+
+static const std::vector<crc64_impl> &crc64_impl_list()
+{
+    static std::vector<crc64_impl> s_impls = {{"table", crc64::compute},
+                                              {"slice8", crc64_slice8::compute}};
+    return s_impls;
+}
 }
 }
 
@@ -420,7 +628,9 @@ namespace dsn {
 namespace utils {
 uint32_t crc32_calc(const void *ptr, size_t size, uint32_t init_crc)
 {
-    return dsn::utils::crc32::compute(ptr, size, init_crc);
+    // the best one available on this cpu, decided on the first call
+    static const crc32_impl::calc_func s_calc = crc32_impl_list().back().calc;
+    return s_calc(ptr, size, init_crc);
 }
 
 uint32_t crc32_concat(uint32_t xy_init,
@@ -431,13 +641,19 @@ uint32_t crc32_concat(uint32_t xy_init,
                       uint32_t y_final,
                       size_t y_size)
 {
+    // y is chained from x, e.g. when y_final = crc32_calc(y_ptr, y_size, x_final),
+    // so y_final is already the crc of the concatenation
+    if (xy_init == x_init && y_init == x_final) {
+        return y_final;
+    }
+
     return dsn::utils::crc32::concatenate(
-        0, x_init, x_final, (uint64_t)x_size, y_init, y_final, (uint64_t)y_size);
+        xy_init, x_init, x_final, (uint64_t)x_size, y_init, y_final, (uint64_t)y_size);
 }
 
 uint64_t crc64_calc(const void *ptr, size_t size, uint64_t init_crc)
 {
-    return dsn::utils::crc64::compute(ptr, size, init_crc);
+    return dsn::utils::crc64_slice8::compute(ptr, size, init_crc);
 }
 
 uint64_t crc64_concat(uint32_t xy_init,
@@ -448,8 +664,16 @@ uint64_t crc64_concat(uint32_t xy_init,
                       uint64_t y_final,
                       size_t y_size)
 {
+    if (xy_init == x_init && y_init == x_final) {
+        return y_final;
+    }
+
     return ::dsn::utils::crc64::concatenate(
-        0, x_init, x_final, (uint64_t)x_size, y_init, y_final, (uint64_t)y_size);
+        xy_init, x_init, x_final, (uint64_t)x_size, y_init, y_final, (uint64_t)y_size);
 }
+
+const std::vector<crc32_impl> &crc32_impls() { return crc32_impl_list(); }
+
+const std::vector<crc64_impl> &crc64_impls() { return crc64_impl_list(); }
 }
 }
@@ -45,6 +45,9 @@ namespace dsn {
 
 DEFINE_TASK_CODE_AIO(LPC_AIO_BATCH_WRITE, TASK_PRIORITY_COMMON, THREAD_POOL_DEFAULT)
 
+// IOV_MAX on linux, the buffers are merged when there are more
+static const size_t MAX_WRITE_VEC_SIZE = 1024;
+
 //----------------- disk_file ------------------------
 aio_task *disk_write_queue::unlink_next_workload(void *plength)
 {
@@ -245,6 +248,13 @@ public:
         _buffer = buffer;
     }
 
+    // vectored write, the buffers are still owned by the batched tasks
+    batch_write_io_task(aio_task *tasks, std::vector<dsn_file_buffer_t> &&buffers)
+        : aio_task(LPC_AIO_BATCH_WRITE, nullptr, tasks, nullptr)
+    {
+        _unmerged_write_buffers = std::move(buffers);
+    }
+
     virtual void exec() override
     {
         aio_task *tasks = (aio_task *)_context;
@@ -291,32 +301,64 @@ void disk_engine::process_write(aio_task *aio, uint32_t sz)
 {
     // no batching
     if (aio->aio()->buffer_size == sz) {
-        aio->collapse();
+        if (!_provider->support_write_vec() ||
+            aio->_unmerged_write_buffers.size() > MAX_WRITE_VEC_SIZE) {
+            aio->collapse();
+        }
         return _provider->aio(aio);
     }
 
     // batching
     else {
+        aio_task *new_task = nullptr;
+
+        // write the buffers of all the tasks as they are
+        if (_provider->support_write_vec()) {
+            std::vector<dsn_file_buffer_t> buffers;
+            auto current_wk = aio;
+            do {
+                if (!current_wk->_unmerged_write_buffers.empty()) {
+                    buffers.insert(buffers.end(),
+                                   current_wk->_unmerged_write_buffers.begin(),
+                                   current_wk->_unmerged_write_buffers.end());
+                } else {
+                    dsn_file_buffer_t buffer;
+                    buffer.buffer = current_wk->aio()->buffer;
+                    buffer.size = static_cast<int>(current_wk->aio()->buffer_size);
+                    buffers.push_back(buffer);
+                }
+                current_wk = (aio_task *)current_wk->next;
+            } while (current_wk);
+
+            if (buffers.size() <= MAX_WRITE_VEC_SIZE) {
+                new_task = new batch_write_io_task(aio, std::move(buffers));
+                new_task->aio()->buffer = nullptr;
+            }
+        }
+
         // merge the buffers
-        auto bb = tls_trans_mem_alloc_blob((size_t)sz);
-        char *ptr = (char *)bb.data();
-        auto current_wk = aio;
-        do {
-            current_wk->copy_to(ptr);
-            ptr += current_wk->aio()->buffer_size;
-            current_wk = (aio_task *)current_wk->next;
-        } while (current_wk);
-
-        dassert(ptr == (char *)bb.data() + bb.length(),
-                "ptr = %" PRIu64 ", bb.data() = %" PRIu64 ", bb.length = %u",
-                (uint64_t)(ptr),
-                (uint64_t)(bb.data()),
-                bb.length());
+        if (new_task == nullptr) {
+            auto bb = tls_trans_mem_alloc_blob((size_t)sz);
+            char *ptr = (char *)bb.data();
+            auto current_wk = aio;
+            do {
+                current_wk->copy_to(ptr);
+                ptr += current_wk->aio()->buffer_size;
+                current_wk = (aio_task *)current_wk->next;
+            } while (current_wk);
+
+            dassert(ptr == (char *)bb.data() + bb.length(),
+                    "ptr = %" PRIu64 ", bb.data() = %" PRIu64 ", bb.length = %u",
+                    (uint64_t)(ptr),
+                    (uint64_t)(bb.data()),
+                    bb.length());
+
+            new_task = new batch_write_io_task(aio, bb);
+            new_task->aio()->buffer = (void *)bb.data();
+        }
 
         // setup io task
-        auto new_task = new batch_write_io_task(aio, bb);
         auto dio = new_task->aio();
-        dio->buffer = (void *)bb.data();
         dio->buffer_size = sz;
         dio->file_offset = aio->aio()->file_offset;
 
@@ -0,0 +1,261 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015 Microsoft Corporation
+ *
+ * -=- Robust Distributed System Nucleus (rDSN) -=-
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * Description:
+ *     mergeable log-linear histogram
+ *
+ * Revision history:
+ *     xxxx-xx-xx, author, first version
+ *     xxxx-xx-xx, author, fix bug about xxx
+ */
+
+#include <dsn/utility/histogram.h>
+#include <dsn/utility/ports.h>
+#include <dsn/utility/rcu_snapshot.h>
+#include <dsn/c/api_utilities.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <thread>
+
+namespace dsn {
+
+const int histogram_snapshot::sub_bucket_bits;
+const int histogram_snapshot::sub_bucket_count;
+const int histogram_snapshot::max_value_bits;
+const int histogram_snapshot::bucket_count;
+const int histogram::max_shard_count;
+
+int histogram_snapshot::bucket_index(uint64_t value)
+{
+    if (value < sub_bucket_count)
+        return static_cast<int>(value);
+    if (value >> max_value_bits)
+        return bucket_count - 1;
+
+    int magnitude = 63 - __builtin_clzll(value);
+    int shift = magnitude - sub_bucket_bits;
+    return ((shift + 1) << sub_bucket_bits) +
+           static_cast<int>((value >> shift) - sub_bucket_count);
+}
+
+uint64_t histogram_snapshot::bucket_lower_bound(int index)
+{
+    if (index < sub_bucket_count)
+        return index;
+    if (index == bucket_count - 1)
+        return 1ULL << max_value_bits;
+
+    int shift = (index >> sub_bucket_bits) - 1;
+    uint64_t sub_bucket = (index & (sub_bucket_count - 1)) + sub_bucket_count;
+    return sub_bucket << shift;
+}
+
+uint64_t histogram_snapshot::bucket_upper_bound(int index)
+{
+    if (index < sub_bucket_count)
+        return index;
+    if (index == bucket_count - 1)
+        return std::numeric_limits<uint64_t>::max();
+
+    int shift = (index >> sub_bucket_bits) - 1;
+    return bucket_lower_bound(index) + ((1ULL << shift) - 1);
+}
+
+histogram_snapshot::histogram_snapshot() : _buckets(bucket_count, 0) { clear(); }
+
+void histogram_snapshot::clear()
+{
+    std::fill(_buckets.begin(), _buckets.end(), 0);
+    _count = 0;
+    _sum = 0;
+    _min = std::numeric_limits<uint64_t>::max();
+    _max = 0;
+}
+
+void histogram_snapshot::record(uint64_t value, uint64_t count)
+{
+    if (count == 0)
+        return;
+
+    _buckets[bucket_index(value)] += count;
+    _count += count;
+    _sum += value * count;
+    _min = std::min(_min, value);
+    _max = std::max(_max, value);
+}
+
+void histogram_snapshot::merge(const histogram_snapshot &other)
+{
+    if (other._count == 0)
+        return;
+
+    for (int i = 0; i < bucket_count; ++i) {
+        _buckets[i] += other._buckets[i];
+    }
+    _count += other._count;
+    _sum += other._sum;
+    _min = std::min(_min, other._min);
+    _max = std::max(_max, other._max);
+}
+
+uint64_t histogram_snapshot::percentile(double percent) const
+{
+    dassert(percent >= 0 && percent <= 100, "invalid percentile %lf", percent);
+    if (_count == 0)
+        return 0;
+
+    uint64_t rank = static_cast<uint64_t>(std::ceil(percent / 100 * _count));
+    rank = std::max<uint64_t>(rank, 1);
+
+    uint64_t seen = 0;
+    for (int i = 0; i < bucket_count; ++i) {
+        seen += _buckets[i];
+        if (seen >= rank) {
+            return std::max(_min, std::min(_max, bucket_upper_bound(i)));
+        }
+    }
+    return _max;
+}
+
+void histogram_snapshot::for_each_bucket(
+    const std::function<void(uint64_t, uint64_t, uint64_t)> &f) const
+{
+    for (int i = 0; i < bucket_count; ++i) {
+        if (_buckets[i] != 0) {
+            f(bucket_lower_bound(i), bucket_upper_bound(i), _buckets[i]);
+        }
+    }
+}
+
+histogram::shard::shard() : count(0), sum(0), min(std::numeric_limits<uint64_t>::max()), max(0)
+{
+    for (auto &b : buckets) {
+        b.store(0, std::memory_order_relaxed);
+    }
+}
+
+histogram::histogram()
+    : _shard_count(std::max(
+          1, std::min<int>(max_shard_count, static_cast<int>(std::thread::hardware_concurrency()))))
+{
+    for (auto &s : _shards) {
+        s.store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+histogram::~histogram()
+{
+    for (auto &s : _shards) {
+        delete s.load(std::memory_order_relaxed);
+    }
+}
+
+histogram::shard *histogram::get_shard()
+{
+    std::atomic<shard *> &slot = _shards[utils::get_rcu_reader_index() % _shard_count];
+    shard *s = slot.load(std::memory_order_acquire);
+    if (dsn_unlikely(s == nullptr)) {
+        shard *new_shard = new shard();
+        if (slot.compare_exchange_strong(s, new_shard, std::memory_order_acq_rel)) {
+            s = new_shard;
+        } else {
+            // another thread of the same slot wins
+            delete new_shard;
+        }
+    }
+    return s;
+}
+
+void histogram::record(uint64_t value)
+{
+    shard *s = get_shard();
+    s->buckets[histogram_snapshot::bucket_index(value)].fetch_add(1, std::memory_order_relaxed);
+    s->count.fetch_add(1, std::memory_order_relaxed);
+    s->sum.fetch_add(value, std::memory_order_relaxed);
+
+    uint64_t old = s->min.load(std::memory_order_relaxed);
+    while (value < old &&
+           !s->min.compare_exchange_weak(old, value, std::memory_order_relaxed)) {
+    }
+    old = s->max.load(std::memory_order_relaxed);
+    while (value > old &&
+           !s->max.compare_exchange_weak(old, value, std::memory_order_relaxed)) {
+    }
+}
+
+void histogram::merge_to(/*out*/ histogram_snapshot &snapshot) const
+{
+    for (const auto &slot : _shards) {
+        const shard *s = slot.load(std::memory_order_acquire);
+        if (s == nullptr)
+            continue;
+
+        // the shard may be recorded concurrently, so count is summed from the buckets
+        // to keep the snapshot consistent with itself
+        uint64_t count = 0;
+        for (int i = 0; i < histogram_snapshot::bucket_count; ++i) {
+            uint64_t c = s->buckets[i].load(std::memory_order_relaxed);
+            snapshot._buckets[i] += c;
+            count += c;
+        }
+        if (count == 0)
+            continue;
+        snapshot._count += count;
+        snapshot._sum += s->sum.load(std::memory_order_relaxed);
+        snapshot._min = std::min(snapshot._min, s->min.load(std::memory_order_relaxed));
+        snapshot._max = std::max(snapshot._max, s->max.load(std::memory_order_relaxed));
+    }
+}
+
+void histogram::merge_and_reset(/*out*/ histogram_snapshot &snapshot)
+{
+    for (auto &slot : _shards) {
+        shard *s = slot.load(std::memory_order_acquire);
+        if (s == nullptr)
+            continue;
+
+        uint64_t count = 0;
+        for (int i = 0; i < histogram_snapshot::bucket_count; ++i) {
+            uint64_t c = s->buckets[i].exchange(0, std::memory_order_relaxed);
+            snapshot._buckets[i] += c;
+            count += c;
+        }
+        s->count.exchange(0, std::memory_order_relaxed);
+        uint64_t sum = s->sum.exchange(0, std::memory_order_relaxed);
+        uint64_t min =
+            s->min.exchange(std::numeric_limits<uint64_t>::max(), std::memory_order_relaxed);
+        uint64_t max = s->max.exchange(0, std::memory_order_relaxed);
+        if (count == 0)
+            continue;
+        snapshot._count += count;
+        snapshot._sum += sum;
+        snapshot._min = std::min(snapshot._min, min);
+        snapshot._max = std::max(snapshot._max, max);
+    }
+}
+}
@@ -38,8 +38,12 @@
 #endif
 #include <dsn/tool-api/network.h>
 #include <dsn/utility/factory_store.h>
+#include <dsn/tool-api/perf_counters.h>
 #include "message_parser_manager.h"
 #include "rpc_engine.h"
+#include "service_engine.h"
+
+#include <algorithm>
 
 namespace dsn {
 /*static*/ join_point<void, rpc_session *>
@@ -56,6 +60,8 @@ rpc_session::~rpc_session()
         dassert(0 == _sending_msgs.size(), "sending queue is not cleared yet");
         dassert(0 == _message_count, "sending queue is not cleared yet");
     }
+
+    perf_counters::instance().remove_counter(_message_count_counter->full_name());
 }
 
 bool rpc_session::try_connecting()
@@ -121,6 +127,8 @@ void rpc_session::clear_send_queue(bool resend_msgs)
         utils::auto_lock<utils::ex_lock_nr> l(_lock);
         _sending_msgs.swap(swapped_sending_msgs);
         _sending_buffers.clear();
+        _sending_compact_headers.clear();
+        _sending_file_seg = file_segment();
     }
 
     // resend pending messages if need
@@ -149,6 +157,7 @@ void rpc_session::clear_send_queue(bool resend_msgs)
 
             msg->remove();
             --_message_count;
+            _message_count_counter->set(_message_count);
         }
 
         auto rmsg = CONTAINING_RECORD(msg, message_ex, dl);
@@ -195,13 +204,23 @@ inline bool rpc_session::unlink_message_for_send()
             _sending_buffers.resize(bcount + rcount);
         bcount += rcount;
         _sending_msgs.push_back(lmsg);
+        if (lmsg->compact_header.length() > 0) {
+            _sending_compact_headers.push_back(lmsg->compact_header);
+        }
 
         n = n->next();
         lmsg->dl.remove();
+
+        if (lmsg->file_seg.size > 0) {
+            // the file segment is sent after all the buffers, so it ends this batch
+            _sending_file_seg = lmsg->file_seg;
+            break;
+        }
     }
 
     // added in send_message
     _message_count -= (int)_sending_msgs.size();
+    _message_count_counter->set(_message_count);
     return _sending_msgs.size() > 0;
 }
 
@@ -272,6 +291,7 @@ void rpc_session::send_message(message_ex *msg)
         utils::auto_lock<utils::ex_lock_nr> l(_lock);
         msg->dl.insert_before(&_messages);
         ++_message_count;
+        _message_count_counter->set(_message_count);
 
         if (SS_CONNECTED == _connect_state && !_is_sending_next) {
             _is_sending_next = true;
@@ -297,6 +317,7 @@ bool rpc_session::cancel(message_ex *request)
 
         request->dl.remove();
         --_message_count;
+        _message_count_counter->set(_message_count);
     }
 
     // added in rpc_engine::reply (for server) or rpc_session::send_message (for client)
@@ -328,6 +349,8 @@ void rpc_session::on_send_completed(uint64_t signature)
             }
             _sending_msgs.clear();
             _sending_buffers.clear();
+            _sending_compact_headers.clear();
+            _sending_file_seg = file_segment();
         }
 
         if (!_is_sending_next) {
@@ -366,6 +389,19 @@ rpc_session::rpc_session(connection_oriented_network &net,
       _message_sent(0),
       _delay_server_receive_ms(0)
 {
+    // several sessions may be connected to the same remote address at the same time
+    static std::atomic<uint64_t> s_session_id(0);
+    std::string counter_name = std::string(is_client ? "client" : "server") + ".session." +
+                               remote_addr.to_string() + "#" + std::to_string(++s_session_id) +
+                               ".queue.length";
+    _message_count_counter =
+        perf_counters::instance().get_global_counter(_net.node()->full_name(),
+                                                     "network",
+                                                     counter_name.c_str(),
+                                                     COUNTER_TYPE_NUMBER,
+                                                     "messages waiting to be sent in the session",
+                                                     true);
+
     if (!is_client) {
         on_rpc_session_connected.execute(this);
     }
@@ -533,6 +569,28 @@ uint32_t network::get_local_ipv4()
 connection_oriented_network::connection_oriented_network(rpc_engine *srv, network *inner_provider)
     : network(srv, inner_provider)
 {
+    _client_session_count_per_server = (int)dsn_config_get_value_uint64(
+        "network",
+        "client_session_count_per_server",
+        1,
+        "how many client sessions (i.e., connections) are used for sending to a remote server, "
+        "the last one is reserved for the rpc calls with rpc_call_is_bulk when more than one");
+    _client_session_count_per_server = std::max(1, std::min(_client_session_count_per_server, 64));
+}
+
+int connection_oriented_network::get_client_session_index(message_ex *msg) const
+{
+    int count = _client_session_count_per_server;
+    if (count == 1) {
+        return 0;
+    }
+
+    // the session is selected by the rpc code and thread hash only, so that the messages
+    // of the same thread hash (e.g., pipelined writes to one partition) are kept in order
+    if (task_spec::get(msg->rpc_code())->rpc_call_is_bulk) {
+        return count - 1;
+    }
+    return (int)((uint32_t)msg->header->client.thread_hash % (count - 1));
 }
 
 void connection_oriented_network::inject_drop_message(message_ex *msg, bool is_send)
@@ -547,7 +605,7 @@ void connection_oriented_network::inject_drop_message(message_ex *msg, bool is_s
         utils::auto_read_lock l(_clients_lock);
         auto it = _clients.find(msg->to_address);
         if (it != _clients.end()) {
-            s = it->second;
+            s = it->second[get_client_session_index(msg)];
         }
     }
 
@@ -560,13 +618,14 @@ void connection_oriented_network::send_message(message_ex *request)
 {
     rpc_session_ptr client = nullptr;
     auto &to = request->to_address;
+    int index = get_client_session_index(request);
 
     // TODO: thread-local client ptr cache
     {
         utils::auto_read_lock l(_clients_lock);
         auto it = _clients.find(to);
         if (it != _clients.end()) {
-            client = it->second;
+            client = it->second[index];
         }
     }
 
@@ -575,11 +634,16 @@ void connection_oriented_network::send_message(message_ex *request)
     if (nullptr == client.get()) {
         utils::auto_write_lock l(_clients_lock);
         auto it = _clients.find(to);
-        if (it != _clients.end()) {
-            client = it->second;
-        } else {
+        if (it == _clients.end()) {
+            it = _clients
+                     .insert(client_sessions::value_type(
+                         to, client_session_pool(_client_session_count_per_server)))
+                     .first;
+        }
+        client = it->second[index];
+        if (nullptr == client.get()) {
             client = create_client_session(to);
-            _clients.insert(client_sessions::value_type(to, client));
+            it->second[index] = client;
             new_client = true;
         }
         scount = (int)_clients.size();
@@ -587,8 +651,9 @@ void connection_oriented_network::send_message(message_ex *request)
 
     // init connection if necessary
     if (new_client) {
-        ddebug("client session created, remote_server = %s, current_count = %d",
+        ddebug("client session created, remote_server = %s, index = %d, current_count = %d",
                client->remote_address().to_string(),
+               index,
                scount);
         client->connect();
     }
@@ -650,7 +715,14 @@ rpc_session_ptr connection_oriented_network::get_client_session(::dsn::rpc_addre
 {
     utils::auto_read_lock l(_clients_lock);
     auto it = _clients.find(ep);
-    return it != _clients.end() ? it->second : nullptr;
+    if (it != _clients.end()) {
+        for (auto &s : it->second) {
+            if (s != nullptr) {
+                return s;
+            }
+        }
+    }
+    return nullptr;
 }
 
 void connection_oriented_network::on_client_session_connected(rpc_session_ptr &s)
@@ -660,8 +732,13 @@ void connection_oriented_network::on_client_session_connected(rpc_session_ptr &s
     {
         utils::auto_read_lock l(_clients_lock);
         auto it = _clients.find(s->remote_address());
-        if (it != _clients.end() && it->second.get() == s.get()) {
-            r = true;
+        if (it != _clients.end()) {
+            for (auto &p : it->second) {
+                if (p.get() == s.get()) {
+                    r = true;
+                    break;
+                }
+            }
         }
         scount = (int)_clients.size();
     }
@@ -680,9 +757,18 @@ void connection_oriented_network::on_client_session_disconnected(rpc_session_ptr
     {
         utils::auto_write_lock l(_clients_lock);
         auto it = _clients.find(s->remote_address());
-        if (it != _clients.end() && it->second.get() == s.get()) {
-            _clients.erase(it);
-            r = true;
+        if (it != _clients.end()) {
+            bool empty = true;
+            for (auto &p : it->second) {
+                if (p.get() == s.get()) {
+                    p = nullptr;
+                    r = true;
+                }
+                empty = empty && (p == nullptr);
+            }
+            if (empty) {
+                _clients.erase(it);
+            }
         }
         scount = (int)_clients.size();
     }
@@ -53,12 +53,27 @@ partition_resolver_simple::partition_resolver_simple(rpc_address meta_server, co
 void partition_resolver_simple::resolve(uint64_t partition_hash,
                                         std::function<void(resolve_result &&)> &&callback,
                                         int timeout_ms)
+{
+    resolve(partition_hash, std::move(callback), timeout_ms, false);
+}
+
+void partition_resolver_simple::resolve_read(uint64_t partition_hash,
+                                             std::function<void(resolve_result &&)> &&callback,
+                                             int timeout_ms)
+{
+    resolve(partition_hash, std::move(callback), timeout_ms, true);
+}
+
+void partition_resolver_simple::resolve(uint64_t partition_hash,
+                                        std::function<void(resolve_result &&)> &&callback,
+                                        int timeout_ms,
+                                        bool read_any)
 {
     int idx = -1;
     if (_app_partition_count != -1) {
         idx = get_partition_index(_app_partition_count, partition_hash);
         rpc_address target;
-        if (ERR_OK == get_address(idx, target)) {
+        if (ERR_OK == get_address(idx, read_any, target)) {
             callback(resolve_result{ERR_OK, target, {_app_id, idx}});
             return;
         }
@@ -71,6 +86,7 @@ void partition_resolver_simple::resolve(uint64_t partition_hash,
     rc->timeout_timer = nullptr;
     rc->timeout_ms = timeout_ms;
     rc->timeout_ts_us = now_us() + timeout_ms * 1000;
+    rc->read_any = read_any;
     rc->completed = false;
 
     call(std::move(rc), false);
@@ -83,6 +99,8 @@ void partition_resolver_simple::on_access_failure(int partition_index, error_cod
         &&
         err != ERR_NOT_ENOUGH_MEMBER // primary won't change and we only r/w on primary in this
                                      // provider
+        &&
+        err != ERR_STALE_READ // the secondary is still valid though lagging behind
         ) {
         ddebug("clear partition configuration cache %d.%d due to access failure %s",
                _app_id,
@@ -149,7 +167,7 @@ void partition_resolver_simple::call(request_context_ptr &&request, bool from_me
     if (-1 != pindex) {
         // fill target address if possible
         rpc_address addr;
-        auto err = get_address(pindex, addr);
+        auto err = get_address(pindex, request->read_any, addr);
 
         // target address known
         if (err == ERR_OK) {
@@ -387,7 +405,7 @@ void partition_resolver_simple::handle_pending_requests(std::deque<request_conte
     for (auto &req : reqs) {
         if (err == ERR_OK) {
             rpc_address addr;
-            err = get_address(req->partition_index, addr);
+            err = get_address(req->partition_index, req->read_any, addr);
             if (err == ERR_OK) {
                 end_request(std::move(req), err, addr);
             } else {
@@ -405,10 +423,21 @@ void partition_resolver_simple::handle_pending_requests(std::deque<request_conte
 }
 
 /*search in cache*/
-rpc_address partition_resolver_simple::get_address(const partition_configuration &config) const
+rpc_address partition_resolver_simple::get_address(const partition_configuration &config,
+                                                   bool read_any) const
 {
     if (_app_is_stateful) {
-        return config.primary;
+        if (!read_any || config.primary.is_invalid() || config.secondaries.empty()) {
+            return config.primary;
+        }
+
+        // bounded-staleness read, spread among the primary and the secondaries
+        int r = dsn_random32(0, static_cast<uint32_t>(config.secondaries.size()));
+        if (r == static_cast<int>(config.secondaries.size())) {
+            return config.primary;
+        } else {
+            return config.secondaries[r];
+        }
     } else {
         if (config.last_drops.size() == 0) {
             return rpc_address();
@@ -416,35 +445,14 @@ rpc_address partition_resolver_simple::get_address(const partition_configuration
             return config.last_drops[dsn_random32(0, config.last_drops.size() - 1)];
         }
     }
-
-    // if (is_write || semantic == read_semantic::ReadLastUpdate)
-    //    return config.primary;
-
-    //// readsnapshot or readoutdated, using random
-    // else
-    //{
-    //    bool has_primary = false;
-    //    int N = static_cast<int>(config.secondaries.size());
-    //    if (!config.primary.is_invalid())
-    //    {
-    //        N++;
-    //        has_primary = true;
-    //    }
-
-    //    if (0 == N) return config.primary;
-
-    //    int r = random32(0, 1000) % N;
-    //    if (has_primary && r == N - 1)
-    //        return config.primary;
-    //    else
-    //        return config.secondaries[r];
-    //}
 }
 
 // ERR_OBJECT_NOT_FOUND  not in cache.
 // ERR_IO_PENDING        in cache but invalid, remove from cache.
 // ERR_OK                in cache and valid
-error_code partition_resolver_simple::get_address(int partition_index, /*out*/ rpc_address &addr)
+error_code partition_resolver_simple::get_address(int partition_index,
+                                                  bool read_any,
+                                                  /*out*/ rpc_address &addr)
 {
     // partition_configuration config;
     {
@@ -452,7 +460,7 @@ error_code partition_resolver_simple::get_address(int partition_index, /*out*/ r
         auto it = _config_cache.find(partition_index);
         if (it != _config_cache.end()) {
             // config = it->second->config;
-            addr = get_address(it->second->config);
+            addr = get_address(it->second->config, read_any);
             if (addr.is_invalid()) {
                 return ERR_IO_PENDING;
             } else {
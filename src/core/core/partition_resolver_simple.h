@@ -52,6 +52,10 @@ public:
                          std::function<void(resolve_result &&)> &&callback,
                          int timeout_ms) override;
 
+    virtual void resolve_read(uint64_t partition_hash,
+                              std::function<void(resolve_result &&)> &&callback,
+                              int timeout_ms) override;
+
     virtual void on_access_failure(int partition_index, error_code err) override;
 
     virtual int get_partition_index(int partition_count, uint64_t partition_hash) override;
@@ -79,6 +83,7 @@ private:
         callback_t callback;
         int timeout_ms;         // init timeout
         uint64_t timeout_ts_us; // timeout at this timing point
+        bool read_any;          // whether secondaries can be the target
 
         service::zlock lock;    // [
         task_ptr timeout_timer; // when partition config is unknown at the first place
@@ -101,8 +106,12 @@ private:
     task_ptr _query_config_task;
 
     // local routines
-    rpc_address get_address(const partition_configuration &config) const;
-    error_code get_address(int partition_index, /*out*/ rpc_address &addr);
+    void resolve(uint64_t partition_hash,
+                 std::function<void(resolve_result &&)> &&callback,
+                 int timeout_ms,
+                 bool read_any);
+    rpc_address get_address(const partition_configuration &config, bool read_any) const;
+    error_code get_address(int partition_index, bool read_any, /*out*/ rpc_address &addr);
     void handle_pending_requests(std::deque<request_context_ptr> &reqs, error_code err);
     void clear_all_pending_requests();
 
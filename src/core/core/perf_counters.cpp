@@ -53,8 +53,9 @@ perf_counters::perf_counters(void)
 
     ::dsn::command_manager::instance().register_command(
         {"counter.value"},
-        "counter.value - get current value of a specific counter",
-        "counter.value app-name*section-name*counter-name",
+        "counter.value - get current value of a specific counter, for histogram counters the "
+        "buckets are dumped, and the histograms of all the counters given are merged",
+        "counter.value app-name*section-name*counter-name [app-name*section-name*counter-name...]",
         &perf_counters::get_counter_value);
 
     ::dsn::command_manager::instance().register_command(
@@ -209,6 +210,27 @@ struct value_resp
     DEFINE_JSON_SERIALIZATION(val, time, counter_name)
 };
 
+struct histogram_bucket
+{
+    uint64_t lower;
+    uint64_t upper;
+    uint64_t count;
+    DEFINE_JSON_SERIALIZATION(lower, upper, count)
+};
+
+struct histogram_resp
+{
+    uint64_t count;
+    double mean;
+    uint64_t min;
+    uint64_t max;
+    std::map<std::string, uint64_t> percentiles;
+    std::vector<histogram_bucket> buckets;
+    uint64_t time;
+    std::string counter_name;
+    DEFINE_JSON_SERIALIZATION(count, mean, min, max, percentiles, buckets, time, counter_name)
+};
+
 struct sample_resp
 {
     uint64_t val;
@@ -264,6 +286,9 @@ std::string perf_counters::get_counter_value(const std::vector<std::string> &arg
     perf_counters &c = perf_counters::instance();
     auto counter = c.get_counter(args[0].c_str());
 
+    if (counter && counter->type() == COUNTER_TYPE_HISTOGRAM) {
+        return get_histogram_value(args);
+    }
     if (counter) {
         if (counter->type() != COUNTER_TYPE_NUMBER_PERCENTILES) {
             value = counter->get_value();
@@ -275,6 +300,39 @@ std::string perf_counters::get_counter_value(const std::vector<std::string> &arg
     return ss.str();
 }
 
+std::string perf_counters::get_histogram_value(const std::vector<std::string> &args)
+{
+    perf_counters &c = perf_counters::instance();
+    histogram_snapshot snapshot;
+    std::string names;
+    for (const std::string &name : args) {
+        auto counter = c.get_counter(name.c_str());
+        if (counter && counter->get_histogram(snapshot)) {
+            names += names.empty() ? name : ("," + name);
+        }
+    }
+
+    histogram_resp resp;
+    resp.count = snapshot.count();
+    resp.mean = snapshot.mean();
+    resp.min = snapshot.min();
+    resp.max = snapshot.max();
+    resp.percentiles["p50"] = snapshot.percentile(50);
+    resp.percentiles["p90"] = snapshot.percentile(90);
+    resp.percentiles["p95"] = snapshot.percentile(95);
+    resp.percentiles["p99"] = snapshot.percentile(99);
+    resp.percentiles["p999"] = snapshot.percentile(99.9);
+    snapshot.for_each_bucket([&resp](uint64_t lower, uint64_t upper, uint64_t count) {
+        resp.buckets.push_back({lower, upper, count});
+    });
+    resp.time = dsn_now_ns();
+    resp.counter_name = std::move(names);
+
+    std::stringstream ss;
+    resp.encode_json_state(ss);
+    return ss.str();
+}
+
 std::string perf_counters::get_counter_sample(const std::vector<std::string> &args)
 {
     std::stringstream ss;
@@ -741,6 +741,12 @@ void rpc_engine::call_uri(rpc_address addr, message_ex *request, rpc_response_ta
                         err != ERR_HANDLER_NOT_FOUND && err != ERR_APP_NOT_EXIST) {
                         auto resolver = req2->server_address.uri_address()->get_resolver();
                         if (nullptr != resolver) {
+                            // the secondary lags too far behind, retry on the primary
+                            if (err == ERR_STALE_READ) {
+                                req2->header->context.u.parameter_type = MSG_PARAM_NONE;
+                                req2->header->context.u.parameter = 0;
+                            }
+
                             resolver->on_access_failure(req2->header->gpid.u.partition_index, err);
 
                             // still got time, retry
@@ -786,34 +792,51 @@ void rpc_engine::call_uri(rpc_address addr, message_ex *request, rpc_response_ta
                 dsn_now_ms() + hdr.client.timeout_ms);
         }
 
-        resolver->resolve(hdr.client.partition_hash,
-                          [=](dist::partition_resolver::resolve_result &&result) mutable {
-                              if (result.err == ERR_OK) {
-                                  // update gpid when necessary
-                                  auto &hdr2 = request->header;
-                                  if (hdr2->gpid.value != result.pid.value) {
-                                      dassert(hdr2->gpid.value == 0, "inconsistent gpid");
-                                      hdr2->gpid = result.pid;
-
-                                      // update thread hash if not assigned by applications
-                                      if (hdr2->client.thread_hash == 0) {
-                                          hdr2->client.thread_hash =
-                                              dsn_gpid_to_thread_hash(result.pid);
-                                      }
-                                  }
-
-                                  call_address(result.address, request, call);
-                              } else {
-                                  if (call != nullptr) {
-                                      call->enqueue(result.err, nullptr);
-                                  } else {
-                                      // as ref_count for request may be zero
-                                      request->add_ref();
-                                      request->release_ref();
-                                  }
-                              }
-                          },
-                          hdr.client.timeout_ms);
+        std::function<void(dist::partition_resolver::resolve_result &&)> on_resolved =
+            [=](dist::partition_resolver::resolve_result &&result) mutable {
+                if (result.err == ERR_OK) {
+                    // update gpid when necessary
+                    auto &hdr2 = request->header;
+                    if (hdr2->gpid.value != result.pid.value) {
+                        dassert(hdr2->gpid.value == 0, "inconsistent gpid");
+                        hdr2->gpid = result.pid;
+
+                        // update thread hash if not assigned by applications
+                        if (hdr2->client.thread_hash == 0) {
+                            hdr2->client.thread_hash = dsn_gpid_to_thread_hash(result.pid);
+                        }
+                    }
+
+                    call_address(result.address, request, call);
+                } else {
+                    if (call != nullptr) {
+                        call->enqueue(result.err, nullptr);
+                    } else {
+                        // as ref_count for request may be zero
+                        request->add_ref();
+                        request->release_ref();
+                    }
+                }
+            };
+
+        // reads may be served by secondaries with bounded staleness, either specified
+        // per request or configured per app on the resolver (only for the first try,
+        // as it is cleared when the read is rejected as stale)
+        bool is_read = !task_spec::get(request->local_rpc_code)->rpc_request_is_write_operation;
+        auto &ctx = hdr.context.u;
+        if (is_read && ctx.parameter_type == MSG_PARAM_NONE && request->send_retry_count == 0 &&
+            resolver->get_read_staleness() >= 0) {
+            ctx.parameter_type = MSG_PARAM_READ_STALENESS;
+            ctx.parameter = static_cast<uint64_t>(resolver->get_read_staleness());
+        }
+
+        if (is_read && ctx.parameter_type == MSG_PARAM_READ_STALENESS) {
+            resolver->resolve_read(
+                hdr.client.partition_hash, std::move(on_resolved), hdr.client.timeout_ms);
+        } else {
+            resolver->resolve(
+                hdr.client.partition_hash, std::move(on_resolved), hdr.client.timeout_ms);
+        }
     }
 }
 
@@ -930,6 +953,20 @@ void rpc_engine::reply(message_ex *response, error_code err)
         return;
     }
 
+    // only the original session may send the file segment directly
+    if (response->file_seg.size > 0 &&
+        (s == nullptr || response->header->context.u.is_forwarded ||
+         !s->can_send_file_segment(response))) {
+        // the body is incomplete then, which must not be taken as a successful reply
+        error_code load_err = response->load_file_segment();
+        if (load_err != ERR_OK && err == ERR_OK) {
+            derror("rpc reply %s fails as loading its file segment failed, trace_id = %016" PRIx64,
+                   response->header->rpc_name,
+                   response->header->trace_id);
+            err = ERR_FILE_OPERATION_FAILED;
+        }
+    }
+
     strncpy(response->header->server.error_name,
             err.to_string(),
             sizeof(response->header->server.error_name));
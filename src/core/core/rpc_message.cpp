@@ -527,13 +527,74 @@ void message_ex::write_append(const blob &data)
 
     int size = data.length();
     if (size > 0) {
+        // _rw_offset always tracks the length of the last buffer, as expected by
+        // write_next and write_commit when more data is written after the appended one
         this->_rw_index++;
-        this->_rw_offset += size;
+        this->_rw_offset = size;
         this->buffers.push_back(data);
         this->header->body_length += size;
     }
 }
 
+void message_ex::attach_file_segment(int fd,
+                                     uint64_t offset,
+                                     uint32_t size,
+                                     std::shared_ptr<void> holder)
+{
+    dassert(!this->_is_read && this->_rw_committed,
+            "there are pending msg write not committed"
+            ", please invoke dsn_msg_write_next and dsn_msg_write_commit in pairs");
+    dassert(file_seg.size == 0, "only one file segment can be attached to a message");
+
+    if (size > 0) {
+        file_seg.fd = fd;
+        file_seg.offset = offset;
+        file_seg.size = size;
+        file_seg.holder = std::move(holder);
+        this->header->body_length += size;
+    }
+}
+
+error_code message_ex::load_file_segment()
+{
+    if (file_seg.size == 0)
+        return ERR_OK;
+
+    std::shared_ptr<char> buffer(::dsn::utils::make_shared_array<char>(file_seg.size));
+    error_code err = ERR_OK;
+    uint32_t done = 0;
+#ifdef _WIN32
+    memset(buffer.get(), 0, file_seg.size);
+    err = ERR_NOT_IMPLEMENTED;
+#else
+    while (done < file_seg.size) {
+        auto sz = ::pread(file_seg.fd,
+                          buffer.get() + done,
+                          file_seg.size - done,
+                          (off_t)(file_seg.offset + done));
+        if (sz <= 0) {
+            derror("read file segment failed, fd = %d, offset = %" PRIu64 ", size = %u, err = %s",
+                   file_seg.fd,
+                   file_seg.offset + done,
+                   file_seg.size - done,
+                   sz == 0 ? "end of file" : strerror(errno));
+            // the body length is already announced, so the rest is filled with zero
+            memset(buffer.get() + done, 0, file_seg.size - done);
+            err = ERR_FILE_OPERATION_FAILED;
+            break;
+        }
+        done += (uint32_t)sz;
+    }
+#endif
+
+    // body_length already counts the segment
+    this->_rw_index++;
+    this->_rw_offset = (int)file_seg.size;
+    this->buffers.push_back(blob(buffer, (int)file_seg.size));
+    file_seg = file_segment();
+    return err;
+}
+
 bool message_ex::read_next(void **ptr, size_t *size)
 {
     // printf("%p %s %d\n", this, __FUNCTION__, utils::get_current_tid());
@@ -96,6 +96,20 @@ DSN_API bool dsn_task_is_running_inside(dsn_task_t t)
     return ::dsn::task::get_current_task() == (::dsn::task *)(t);
 }
 
+DSN_API bool dsn_task_shares_current_worker(dsn::task_code code, int hash)
+{
+    // tls may not be set on threads outside rDSN, e.g., the ones used by aio or network
+    if (nullptr == ::dsn::task::get_current_worker2())
+        return false;
+
+    ::dsn::task *current = ::dsn::task::get_current_task();
+    if (nullptr == current)
+        return false;
+
+    auto pool = current->node()->computation()->get_pool(::dsn::task_spec::get(code)->pool_code);
+    return pool != nullptr && pool->shared_same_worker_with_current_task(hash);
+}
+
 DSN_API const char *dsn_config_get_value_string(const char *section,
                                                 const char *key,
                                                 const char *default_value,
@@ -1070,7 +1084,12 @@ bool run(const char *config_file,
         "tls_trans_memory_KB",
         1024, // 1 MB
         "thread local transient memory buffer size (KB), default is 1024");
-    ::dsn::tls_trans_mem_init(tls_trans_memory_KB * 1024);
+    auto tls_trans_memory_max_cached_blocks = (size_t)dsn_all.config->get_value<int>(
+        "core",
+        "tls_trans_memory_max_cached_blocks",
+        64,
+        "max count of recycled transient memory blocks cached for reuse, default is 64");
+    ::dsn::tls_trans_mem_init(tls_trans_memory_KB * 1024, tls_trans_memory_max_cached_blocks);
     dsn_all.memory = ::dsn::utils::factory_store<::dsn::memory_provider>::create(
         spec.tools_memory_factory_name.c_str(), ::dsn::PROVIDER_TYPE_MAIN);
 
@@ -1102,6 +1121,7 @@ bool run(const char *config_file,
 
     // init runtime
     ::dsn::service_engine::fast_instance().init_after_toollets();
+    ::dsn::tls_trans_mem_init_perf_counters();
 
     dsn_all.engine_ready = true;
 
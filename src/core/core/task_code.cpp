@@ -37,10 +37,15 @@ task_code::task_code(const char *name) : _internal_code(task_code_mgr::instance(
 task_code::task_code(const char *name,
                      dsn_task_type_t tt,
                      dsn_task_priority_t pri,
-                     dsn::threadpool_code pool)
+                     dsn::threadpool_code pool,
+                     bool is_bulk_rpc)
     : task_code(name)
 {
     task_spec::register_task_code(*this, tt, pri, pool);
+    if (is_bulk_rpc) {
+        // the default of its own section, see task_spec::init()
+        task_spec::get(code())->rpc_call_is_bulk = true;
+    }
 }
 
 const char *task_code::to_string() const
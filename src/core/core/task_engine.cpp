@@ -164,17 +164,22 @@ void task_worker_pool::enqueue(task *t)
 }
 
 bool task_worker_pool::shared_same_worker_with_current_task(task *tsk) const
+{
+    return shared_same_worker_with_current_task(tsk->hash());
+}
+
+bool task_worker_pool::shared_same_worker_with_current_task(int hash) const
 {
     task *current = task::get_current_task();
     if (nullptr != current) {
-        if (current->spec().pool_code != tsk->code())
+        if (current->node() != _node || current->spec().pool_code != _spec.pool_code)
             return false;
         else if (_workers.size() == 1)
             return true;
         else if (_spec.partitioned) {
             unsigned int sz = static_cast<unsigned int>(_workers.size());
             return static_cast<unsigned int>(current->hash()) % sz ==
-                   static_cast<unsigned int>(tsk->hash()) % sz;
+                   static_cast<unsigned int>(hash) % sz;
         } else {
             return false;
         }
@@ -71,6 +71,7 @@ public:
     // inquery
     const threadpool_spec &spec() const { return _spec; }
     bool shared_same_worker_with_current_task(task *task) const;
+    bool shared_same_worker_with_current_task(int hash) const;
     task_engine *engine() const { return _owner; }
     service_node *node() const { return _node; }
     void get_runtime_info(const std::string &indent,
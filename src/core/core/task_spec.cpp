@@ -112,6 +112,7 @@ task_spec::task_spec(int code,
       rpc_call_header_format(NET_HDR_DSN),
       rpc_call_channel(RPC_CHANNEL_TCP),
       rpc_message_crc_required(false),
+      rpc_call_is_bulk(false),
       on_task_create((std::string(name) + std::string(".create")).c_str()),
       on_task_enqueue((std::string(name) + std::string(".enqueue")).c_str()),
       on_task_begin((std::string(name) + std::string(".begin")).c_str()),
@@ -171,7 +172,13 @@ bool task_spec::init()
         task_spec *spec = task_spec::get(code);
         dassert(spec != nullptr, "task_spec cannot be null");
 
-        if (!read_config(section_name.c_str(), *spec, &default_spec))
+        // rpc_call_is_bulk declared with the task code (DEFINE_TASK_CODE_RPC_BULK)
+        // takes the place of the default one
+        bool default_bulk = default_spec.rpc_call_is_bulk;
+        default_spec.rpc_call_is_bulk = default_bulk || spec->rpc_call_is_bulk;
+        bool ok = read_config(section_name.c_str(), *spec, &default_spec);
+        default_spec.rpc_call_is_bulk = default_bulk;
+        if (!ok)
             return false;
 
         if (code == TASK_CODE_EXEC_INLINED) {
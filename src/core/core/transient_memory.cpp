@@ -34,32 +34,257 @@
  */
 
 #include "transient_memory.h"
+#include <dsn/tool-api/perf_counters.h>
+#include <atomic>
+#include <mutex>
+#include <vector>
 
 namespace dsn {
 __thread tls_transient_memory_t tls_trans_memory;
 
 static size_t tls_trans_mem_default_block_bytes = 1024 * 1024; // 1 MB
+static size_t tls_trans_mem_max_cached_blocks = 64;
 
-void tls_trans_mem_init(size_t default_per_block_bytes)
+//
+// every block is laid out as [trans_block_header][data], and tls_trans_memory.block
+// points to the data part with a deleter which recycles the whole block.
+//
+// objects from tls_trans_malloc do not copy the shared_ptr, instead they share one
+// reference (holder) through a biased counter: refs starts at BIAS, the owner thread
+// counts the allocations in tls_trans_memory.malloc_count without atomics, and folds
+// (malloc_count - BIAS) into refs when the block is retired. so each object only costs
+// one atomic decrement on free, and whoever drops refs to zero releases the holder.
+//
+struct trans_block_header
+{
+    std::atomic<int64_t> refs;
+    std::shared_ptr<char> holder;
+    size_t capacity;
+};
+
+static const int64_t TRANS_BLOCK_REF_BIAS = 1LL << 48;
+static const size_t TRANS_BLOCK_HEADER_SIZE = (sizeof(trans_block_header) + 15) & ~(size_t)15;
+static const uint32_t TRANS_OBJECT_MAGIC = 0xdeadbeef;
+
+// prefix of each tls_trans_malloc object
+struct trans_object_prefix
+{
+    uint32_t magic;
+    uint32_t offset; // from the block header to the object
+};
+
+static std::atomic<int64_t> s_blocks_in_use(0);
+static std::atomic<int64_t> s_blocks_cached(0);
+static std::atomic<int64_t> s_blocks_created(0);
+static std::atomic<int64_t> s_blocks_reused(0);
+static std::atomic<int64_t> s_wasted_bytes(0);
+
+static perf_counter_ptr s_pc_blocks_in_use;
+static perf_counter_ptr s_pc_blocks_cached;
+static perf_counter_ptr s_pc_blocks_created;
+static perf_counter_ptr s_pc_wasted_bytes;
+static std::atomic<bool> s_pc_ready(false);
+
+// never destroyed, as blocks may be recycled during static destruction
+static std::mutex &block_pool_lock()
+{
+    static std::mutex *lock = new std::mutex();
+    return *lock;
+}
+
+static std::vector<trans_block_header *> &block_pool()
+{
+    static std::vector<trans_block_header *> *pool = new std::vector<trans_block_header *>();
+    return *pool;
+}
+
+static inline char *block_data(trans_block_header *hdr)
+{
+    return (char *)hdr + TRANS_BLOCK_HEADER_SIZE;
+}
+
+static void update_perf_counters()
+{
+    if (!s_pc_ready.load(std::memory_order_acquire))
+        return;
+
+    s_pc_blocks_in_use->set((uint64_t)s_blocks_in_use.load(std::memory_order_relaxed));
+    s_pc_blocks_cached->set((uint64_t)s_blocks_cached.load(std::memory_order_relaxed));
+}
+
+static void free_block(trans_block_header *hdr)
+{
+    hdr->~trans_block_header();
+    ::free(hdr);
+}
+
+static void recycle_block(trans_block_header *hdr)
+{
+    s_blocks_in_use.fetch_sub(1, std::memory_order_relaxed);
+
+    // only blocks of the default size are worth caching, larger ones are rare
+    if (hdr->capacity != tls_trans_mem_default_block_bytes) {
+        free_block(hdr);
+    } else if (tls_trans_memory.spare == nullptr) {
+        tls_trans_memory.spare = hdr;
+        s_blocks_cached.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        bool cached = false;
+        {
+            std::lock_guard<std::mutex> l(block_pool_lock());
+            if (block_pool().size() < tls_trans_mem_max_cached_blocks) {
+                block_pool().push_back(hdr);
+                cached = true;
+            }
+        }
+
+        if (cached)
+            s_blocks_cached.fetch_add(1, std::memory_order_relaxed);
+        else
+            free_block(hdr);
+    }
+
+    update_perf_counters();
+}
+
+struct trans_block_deleter
+{
+    void operator()(char *data)
+    {
+        recycle_block((trans_block_header *)(data - TRANS_BLOCK_HEADER_SIZE));
+    }
+};
+
+static trans_block_header *acquire_block(size_t capacity)
+{
+    trans_block_header *hdr = nullptr;
+    if (capacity == tls_trans_mem_default_block_bytes) {
+        if (tls_trans_memory.spare != nullptr) {
+            hdr = tls_trans_memory.spare;
+            tls_trans_memory.spare = nullptr;
+        } else {
+            std::lock_guard<std::mutex> l(block_pool_lock());
+            if (!block_pool().empty()) {
+                hdr = block_pool().back();
+                block_pool().pop_back();
+            }
+        }
+
+        // the default size may be changed by tls_trans_mem_init after caching
+        if (hdr != nullptr && hdr->capacity != capacity) {
+            s_blocks_cached.fetch_sub(1, std::memory_order_relaxed);
+            free_block(hdr);
+            hdr = nullptr;
+        }
+    }
+
+    if (hdr != nullptr) {
+        s_blocks_cached.fetch_sub(1, std::memory_order_relaxed);
+        s_blocks_reused.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        void *mem = ::malloc(TRANS_BLOCK_HEADER_SIZE + capacity);
+        dassert(mem != nullptr,
+                "malloc transient block failed, size = %" PRIu64,
+                (uint64_t)capacity);
+        hdr = new (mem) trans_block_header();
+        hdr->capacity = capacity;
+        s_blocks_created.fetch_add(1, std::memory_order_relaxed);
+        if (s_pc_ready.load(std::memory_order_acquire))
+            s_pc_blocks_created->increment();
+    }
+
+    hdr->refs.store(TRANS_BLOCK_REF_BIAS, std::memory_order_relaxed);
+    s_blocks_in_use.fetch_add(1, std::memory_order_relaxed);
+    update_perf_counters();
+    return hdr;
+}
+
+static inline trans_block_header *current_block()
+{
+    return (trans_block_header *)(tls_trans_memory.block->get() - TRANS_BLOCK_HEADER_SIZE);
+}
+
+static inline void release_holder(trans_block_header *hdr)
+{
+    // swap out first, as dropping the last reference may recycle the header itself
+    std::shared_ptr<char> holder;
+    holder.swap(hdr->holder);
+}
+
+static void retire_current_block()
+{
+    trans_block_header *hdr = current_block();
+    int64_t count = tls_trans_memory.malloc_count;
+    if (count > 0) {
+        tls_trans_memory.malloc_count = 0;
+        if (hdr->refs.fetch_add(count - TRANS_BLOCK_REF_BIAS, std::memory_order_acq_rel) ==
+            TRANS_BLOCK_REF_BIAS - count)
+            release_holder(hdr);
+    }
+
+    s_wasted_bytes.fetch_add((int64_t)tls_trans_memory.remain_bytes, std::memory_order_relaxed);
+    if (s_pc_ready.load(std::memory_order_acquire))
+        s_pc_wasted_bytes->add((uint64_t)tls_trans_memory.remain_bytes);
+
+    tls_trans_memory.block->reset();
+}
+
+void tls_trans_mem_init(size_t default_per_block_bytes, size_t max_cached_blocks)
 {
     tls_trans_mem_default_block_bytes = default_per_block_bytes;
+    tls_trans_mem_max_cached_blocks = max_cached_blocks;
+}
+
+void tls_trans_mem_init_perf_counters()
+{
+    if (s_pc_ready.load(std::memory_order_acquire))
+        return;
+
+    auto get_counter = [](const char *name, dsn_perf_counter_type_t type, const char *dsptr) {
+        return perf_counters::instance().get_global_counter(
+            "core", "memory", name, type, dsptr, true);
+    };
+    s_pc_blocks_in_use = get_counter(
+        "transient.block.in.use", COUNTER_TYPE_NUMBER, "transient memory blocks in use");
+    s_pc_blocks_cached = get_counter(
+        "transient.block.cached", COUNTER_TYPE_NUMBER, "transient memory blocks cached for reuse");
+    s_pc_blocks_created = get_counter("transient.block.created",
+                                      COUNTER_TYPE_RATE,
+                                      "transient memory blocks allocated from system per second");
+    s_pc_wasted_bytes =
+        get_counter("transient.wasted.bytes",
+                    COUNTER_TYPE_RATE,
+                    "unused tail bytes of retired transient memory blocks per second");
+    s_pc_ready.store(true, std::memory_order_release);
+    update_perf_counters();
+}
+
+void tls_trans_mem_get_stats(/*out*/ trans_mem_stats &stats)
+{
+    stats.blocks_in_use = s_blocks_in_use.load(std::memory_order_relaxed);
+    stats.blocks_cached = s_blocks_cached.load(std::memory_order_relaxed);
+    stats.blocks_created = s_blocks_created.load(std::memory_order_relaxed);
+    stats.blocks_reused = s_blocks_reused.load(std::memory_order_relaxed);
+    stats.wasted_bytes = s_wasted_bytes.load(std::memory_order_relaxed);
 }
 
 void tls_trans_mem_alloc(size_t min_size)
 {
     // release last buffer if necessary
     if (tls_trans_memory.magic == 0xdeadbeef) {
-        tls_trans_memory.block->reset();
+        retire_current_block();
     } else {
         tls_trans_memory.magic = 0xdeadbeef;
         tls_trans_memory.block = new (tls_trans_memory.block_ptr_buffer) std::shared_ptr<char>();
         tls_trans_memory.committed = true;
+        tls_trans_memory.malloc_count = 0;
     }
 
     tls_trans_memory.remain_bytes =
         (min_size > tls_trans_mem_default_block_bytes ? min_size
                                                       : tls_trans_mem_default_block_bytes);
-    *tls_trans_memory.block = ::dsn::utils::make_shared_array<char>(tls_trans_memory.remain_bytes);
+    trans_block_header *hdr = acquire_block(tls_trans_memory.remain_bytes);
+    tls_trans_memory.block->reset(block_data(hdr), trans_block_deleter());
     tls_trans_memory.next = tls_trans_memory.block->get();
 }
 
@@ -107,29 +332,36 @@ blob tls_trans_mem_alloc_blob(size_t sz)
 
 void *tls_trans_malloc(size_t sz)
 {
-    sz += sizeof(std::shared_ptr<char>) + sizeof(uint32_t);
+    // objects are 8-byte aligned, reserve the worst case padding
+    sz += sizeof(trans_object_prefix);
     void *ptr;
     size_t sz2;
-    tls_trans_mem_next(&ptr, &sz2, sz);
+    tls_trans_mem_next(&ptr, &sz2, sz + 7);
 
-    // add ref
-    new (ptr) std::shared_ptr<char>(*::dsn::tls_trans_memory.block);
+    size_t padding = (8 - ((uintptr_t)ptr & 7)) & 7;
+    trans_block_header *hdr = current_block();
+    if (tls_trans_memory.malloc_count++ == 0)
+        hdr->holder = *tls_trans_memory.block;
 
-    // add magic
-    *(uint32_t *)((char *)(ptr) + sizeof(std::shared_ptr<char>)) = 0xdeadbeef;
+    auto prefix = (trans_object_prefix *)((char *)ptr + padding);
+    size_t offset = (char *)(prefix + 1) - (char *)hdr;
+    dassert(offset <= UINT32_MAX, "transient memory block is too large");
+    prefix->magic = TRANS_OBJECT_MAGIC;
+    prefix->offset = (uint32_t)offset;
 
-    tls_trans_mem_commit(sz);
+    tls_trans_mem_commit(padding + sz);
 
-    return (void *)((char *)(ptr) + sizeof(std::shared_ptr<char>) + sizeof(uint32_t));
+    return (void *)(prefix + 1);
 }
 
 void tls_trans_free(void *ptr)
 {
-    ptr = (void *)((char *)ptr - sizeof(uint32_t));
-    dassert(*(uint32_t *)(ptr) == 0xdeadbeef, "invalid transient memory block");
+    auto prefix = (trans_object_prefix *)ptr - 1;
+    dassert(prefix->magic == TRANS_OBJECT_MAGIC, "invalid transient memory block");
 
-    ptr = (void *)((char *)ptr - sizeof(std::shared_ptr<char>));
-    ((std::shared_ptr<char> *)(ptr))->~shared_ptr<char>();
+    auto hdr = (trans_block_header *)((char *)ptr - prefix->offset);
+    if (hdr->refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        release_holder(hdr);
 }
 }
 
@@ -41,6 +41,8 @@
 #include <dsn/service_api_c.h>
 
 namespace dsn {
+struct trans_block_header;
+
 typedef struct tls_transient_memory_t
 {
     unsigned int magic;
@@ -49,10 +51,27 @@ typedef struct tls_transient_memory_t
     std::shared_ptr<char> *block;
     char *next;
     bool committed;
+
+    // number of tls_trans_malloc objects carved from the current block, counted
+    // without atomics and folded into the block's shared refcount on retirement
+    int64_t malloc_count;
+    // a recycled block kept by this thread to avoid the global pool lock
+    trans_block_header *spare;
 } tls_transient_memory_t;
 
+typedef struct trans_mem_stats
+{
+    int64_t blocks_in_use;  // blocks still referenced by the threads or by objects/blobs
+    int64_t blocks_cached;  // recycled blocks waiting for reuse
+    int64_t blocks_created; // blocks ever allocated from the system
+    int64_t blocks_reused;  // block requests served by recycled blocks
+    int64_t wasted_bytes;   // unused tail bytes of the retired blocks
+} trans_mem_stats;
+
 extern __thread tls_transient_memory_t tls_trans_memory;
-extern void tls_trans_mem_init(size_t default_per_block_bytes);
+extern void tls_trans_mem_init(size_t default_per_block_bytes, size_t max_cached_blocks = 64);
+extern void tls_trans_mem_init_perf_counters();
+extern void tls_trans_mem_get_stats(/*out*/ trans_mem_stats &stats);
 extern void tls_trans_mem_alloc(size_t min_size);
 
 extern void tls_trans_mem_next(void **ptr, size_t *sz, size_t min_size);
@@ -48,6 +48,7 @@ void uri_resolver_manager::setup_resolvers()
     // [uri-resolver.%resolver-address%]
     // factory = %uri-resolver-factory%
     // arguments = %uri-resolver-arguments%
+    // read_staleness = %app1:staleness1,app2:staleness2%
 
     std::vector<std::string> sections;
     get_main_config()->get_all_sections(sections);
@@ -72,8 +73,14 @@ void uri_resolver_manager::setup_resolvers()
             "partition-resolver factory name which creates the concrete partition-resolver object");
         auto arguments =
             dsn_config_get_value_string(s.c_str(), "arguments", "", "uri-resolver ctor arguments");
+        auto read_staleness = dsn_config_get_value_string(
+            s.c_str(),
+            "read_staleness",
+            "",
+            "apps whose reads can be served by secondaries by default, with the max staleness "
+            "in decrees, e.g., app1:10,app2:100");
 
-        auto resolver = new uri_resolver(resolver_addr.c_str(), factory, arguments);
+        auto resolver = new uri_resolver(resolver_addr.c_str(), factory, arguments, read_staleness);
         _resolvers.emplace(resolver_addr, std::shared_ptr<uri_resolver>(resolver));
 
         dinfo("initialize uri-resolver %s", resolver_addr.c_str());
@@ -163,7 +170,10 @@ std::pair<std::string, std::string> rpc_uri_address::get_uri_components()
 
 //---------------------------------------------------------------
 
-uri_resolver::uri_resolver(const char *name, const char *factory, const char *arguments)
+uri_resolver::uri_resolver(const char *name,
+                           const char *factory,
+                           const char *arguments,
+                           const char *read_staleness)
     : _name(name), _factory(factory), _arguments(arguments)
 {
     _meta_server.assign_group(dsn_group_build(name));
@@ -178,6 +188,16 @@ uri_resolver::uri_resolver(const char *name, const char *factory, const char *ar
             dsn_group_add(_meta_server.group_handle(), ep.c_addr());
         }
     }
+
+    args.clear();
+    utils::split_args(read_staleness, args, ',');
+    for (auto &arg : args) {
+        // app:staleness
+        auto pos1 = arg.find_last_of(':');
+        if (pos1 != std::string::npos) {
+            _apps_read_staleness[arg.substr(0, pos1)] = atoll(arg.substr(pos1 + 1).c_str());
+        }
+    }
 }
 
 uri_resolver::~uri_resolver() { dsn_group_destroy(_meta_server.group_handle()); }
@@ -201,6 +221,11 @@ dist::partition_resolver_ptr uri_resolver::get_app_resolver(const char *app)
         rv = utils::factory_store<dist::partition_resolver>::create(
             _factory.c_str(), ::dsn::PROVIDER_TYPE_MAIN, _meta_server, app);
 
+        auto sit = _apps_read_staleness.find(app);
+        if (sit != _apps_read_staleness.end()) {
+            rv->set_read_staleness(sit->second);
+        }
+
         service::zauto_write_lock l(_apps_lock);
         auto it = _apps.find(app);
         if (it == _apps.end()) {
@@ -92,8 +92,13 @@ public:
     * \param factory   factory for creating partition_resolver
     * \param arguments end-point list which composes the meta-server group,
     *                  e.g., host1:port1,host2:port2,host3:port3
+    * \param read_staleness apps whose reads may be served by secondaries by default,
+    *                  e.g., app1:staleness1,app2:staleness2 (see MSG_PARAM_READ_STALENESS)
     */
-    uri_resolver(const char *name, const char *factory, const char *arguments);
+    uri_resolver(const char *name,
+                 const char *factory,
+                 const char *arguments,
+                 const char *read_staleness = "");
 
     ~uri_resolver();
 
@@ -109,6 +114,8 @@ private:
     std::unordered_map<std::string, dist::partition_resolver_ptr>
         _apps; ///< app-path to app-resolver map
     service::zrwlock_nr _apps_lock;
+    std::unordered_map<std::string, int64_t>
+        _apps_read_staleness; ///< app-path to default max read staleness
 
     rpc_address _meta_server;
     std::string _name;
@@ -35,6 +35,7 @@
 
 #include <dsn/utility/utils.h>
 #include <dsn/utility/singleton.h>
+#include <dsn/utility/rcu_snapshot.h>
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <random>
@@ -55,6 +56,14 @@ namespace dsn {
 namespace utils {
 
 __thread tls_tid s_tid;
+__thread int s_rcu_reader_index;
+
+int get_rcu_reader_index_internal()
+{
+    static std::atomic<int> s_next_index(0);
+    return s_next_index.fetch_add(1);
+}
+
 int get_current_tid_internal()
 {
 #if defined(_WIN32)
@@ -96,7 +96,10 @@ void aio_testcase(uint64_t block_size, size_t concurrency, bool is_write, bool r
               << " throughput = "
               << double(total_size_mb) * 1000000 /
                      std::chrono::duration_cast<std::chrono::microseconds>(toc - tic).count()
-              << " mB/s" << std::endl;
+              << " mB/s iops = "
+              << double(total_size_bytes / block_size) * 1000000 /
+                     std::chrono::duration_cast<std::chrono::microseconds>(toc - tic).count()
+              << std::endl;
 }
 TEST(core, aio_perf_test)
 {
@@ -112,3 +115,15 @@ TEST(core, aio_perf_test)
         }
     }
 }
+
+// sweep the number of requests in flight, while the provider's queue depth stays as
+// configured in [tools.hpc_aio_provider] queue_depth (256 in config-test.ini). requests
+// beyond the queue depth wait in the provider, rerun with a smaller one to compare
+TEST(core, aio_queue_depth_perf_test)
+{
+    for (auto is_write : {true, false}) {
+        for (auto concurrency : {1, 4, 16, 64, 128, 256}) {
+            aio_testcase(4096, concurrency, is_write, true);
+        }
+    }
+}
@@ -0,0 +1,89 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015 Microsoft Corporation
+ *
+ * -=- Robust Distributed System Nucleus (rDSN) -=-
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * Description:
+ *     crc performance test
+ *
+ * Revision history:
+ *     xxxx-xx-xx, author, first version
+ *     xxxx-xx-xx, author, fix bug about xxx
+ */
+
+#include <gtest/gtest.h>
+#include <dsn/service_api_c.h>
+#include <dsn/utility/crc.h>
+#include <iostream>
+#include <vector>
+
+template <typename TIMPL, typename TCRC>
+void crc_test(const TIMPL &impl, const std::vector<char> &buffer, size_t block_size)
+{
+    // crc over about 256MB of data in blocks of the given size
+    size_t rounds = (256 << 20) / block_size;
+    size_t blocks = buffer.size() / block_size;
+    TCRC crc = 0;
+
+    uint64_t nts_start = dsn_now_ns();
+    for (size_t i = 0; i < rounds; i++) {
+        crc = impl.calc(buffer.data() + (i % blocks) * block_size, block_size, crc);
+    }
+    uint64_t nts = dsn_now_ns();
+
+    std::cout << impl.name << "\t\t " << block_size << "\t\t "
+              << static_cast<double>(rounds * block_size) / (1024 * 1024) / (nts - nts_start) *
+                     1000000000
+              << "MB/s"
+              << "\t\t (crc = " << std::hex << crc << std::dec << ")" << std::endl;
+}
+
+template <typename TIMPL, typename TCRC>
+void crc_impls_test(const std::vector<TIMPL> &impls)
+{
+    std::vector<char> buffer(4 << 20);
+    for (auto &c : buffer) {
+        c = (char)dsn_random32(0, 255);
+    }
+
+    std::cout << "impl\t\t block_size\t\t speed" << std::endl;
+
+    auto block_sizes = {64, 512, 4096, 65536, 1048576};
+    for (auto &impl : impls) {
+        for (int block_size : block_sizes) {
+            crc_test<TIMPL, TCRC>(impl, buffer, block_size);
+        }
+    }
+}
+
+TEST(core, crc32_perf_test)
+{
+    crc_impls_test<dsn::utils::crc32_impl, uint32_t>(dsn::utils::crc32_impls());
+}
+
+TEST(core, crc64_perf_test)
+{
+    crc_impls_test<dsn::utils::crc64_impl, uint64_t>(dsn::utils::crc64_impls());
+}
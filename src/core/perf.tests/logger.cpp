@@ -46,6 +46,7 @@
 #include "test_utils.h"
 #include "../tools/hpc/hpc_logger.h"
 #include "../tools/hpc/hpc_tail_logger.h"
+#include "../tools/hpc/hpc_binary_logger.h"
 #include "../tools/common/simple_logger.h"
 
 using namespace ::dsn;
@@ -59,6 +60,15 @@ void logv(dsn::logging_provider *logger, const char *fmt, ...)
     va_end(ap);
 }
 
+// records dropped by the logger rather than written, which must not count in the speed
+template <typename TLOGGER>
+uint64_t dropped_count(TLOGGER &)
+{
+    return 0;
+}
+
+uint64_t dropped_count(dsn::tools::hpc_binary_logger &logger) { return logger.dropped_count(); }
+
 template <typename TLOGGER>
 void logger_test(int thread_count, int record_count)
 {
@@ -84,24 +94,26 @@ void logger_test(int thread_count, int record_count)
     }
     threads.clear();
 
+    // the records are only written when flushed
+    logger.flush();
     nts = dsn_now_ns();
+    uint64_t dropped = dropped_count(logger);
+    uint64_t written = static_cast<uint64_t>(thread_count) * record_count - dropped;
 
     // one sample log
     size_t size_per_log = strlen("13:11:02.678 (1446037862678885017 1d50) unknown.io-thrd.07504: "
                                  "this is a logging test for log 0000000000 @ thread 000000000") +
                           1;
 
-    std::cout << thread_count << "\t\t\t " << record_count << "\t\t\t "
-              << static_cast<double>(thread_count * record_count) * size_per_log / (1024 * 1024) /
-                     (nts - nts_start) * 1000000000
+    std::cout << thread_count << "\t\t\t " << record_count << "\t\t\t " << dropped << "\t\t\t "
+              << static_cast<double>(written) * size_per_log / (1024 * 1024) / (nts - nts_start) *
+                     1000000000
               << "MB/s" << std::endl;
-
-    // logger.flush();
 }
 
 TEST(core, simple_logger_test)
 {
-    std::cout << "thread_count\t\t record_count\t\t speed" << std::endl;
+    std::cout << "thread_count\t\t record_count\t\t dropped_count\t\t speed" << std::endl;
 
     auto threads_count = {1, 2, 5, 10};
     for (int i : threads_count) {
@@ -111,7 +123,7 @@ TEST(core, simple_logger_test)
 
 TEST(core, hpc_logger_test)
 {
-    std::cout << "thread_count\t\t record_count\t\t speed" << std::endl;
+    std::cout << "thread_count\t\t record_count\t\t dropped_count\t\t speed" << std::endl;
 
     auto threads_count = {1, 2, 5, 10};
     for (int i : threads_count)
@@ -120,10 +132,19 @@ TEST(core, hpc_logger_test)
 
 TEST(core, hpc_tail_logger_test)
 {
-    std::cout << "thread_count\t\t record_count\t\t speed" << std::endl;
+    std::cout << "thread_count\t\t record_count\t\t dropped_count\t\t speed" << std::endl;
 
     auto threads_count = {1, 2, 5, 10};
     for (int i : threads_count) {
         logger_test<dsn::tools::hpc_tail_logger>(i, 10000);
     }
 }
+
+TEST(core, hpc_binary_logger_test)
+{
+    std::cout << "thread_count\t\t record_count\t\t dropped_count\t\t speed" << std::endl;
+
+    auto threads_count = {1, 2, 5, 10};
+    for (int i : threads_count)
+        logger_test<dsn::tools::hpc_binary_logger>(i, 100000);
+}
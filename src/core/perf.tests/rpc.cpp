@@ -77,6 +77,46 @@ TEST(core, rpc_perf_test)
     }
 }
 
+// multiple sessions spread over the looper shards (see [network] hpc_looper_shard_count)
+TEST(core, rpc_perf_test_multi_server)
+{
+    std::vector<rpc_address> servers = {rpc_address("localhost", 20201),
+                                        rpc_address("localhost", 20202),
+                                        rpc_address("localhost", 20203)};
+
+    for (auto concurrency : {1000, 10000}) {
+        std::atomic_int remain_concurrency;
+        remain_concurrency = concurrency;
+        size_t total_query_count = 1000000;
+        std::chrono::steady_clock clock;
+        auto tic = clock.now();
+        for (auto remain_query_count = total_query_count; remain_query_count--;) {
+            while (true) {
+                if (remain_concurrency.fetch_sub(1, std::memory_order_relaxed) <= 0) {
+                    remain_concurrency.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    break;
+                }
+            }
+            rpc::call(servers[remain_query_count % servers.size()],
+                      RPC_TEST_HASH,
+                      0,
+                      nullptr,
+                      [&remain_concurrency](error_code ec, const std::string &) {
+                          remain_concurrency.fetch_add(1, std::memory_order_relaxed);
+                      });
+        }
+        while (remain_concurrency != concurrency) {
+            ;
+        }
+        auto toc = clock.now();
+        auto time_us = std::chrono::duration_cast<std::chrono::microseconds>(toc - tic).count();
+        std::cout << "rpc perf test (multi-server): concurrency = " << concurrency
+                  << " throughput = " << total_query_count * 1000000llu / time_us << "call/sec"
+                  << std::endl;
+    }
+}
+
 TEST(core, rpc_perf_test_sync)
 {
     rpc_address localhost("localhost", 20101);
@@ -42,6 +42,8 @@
 #include "test_utils.h"
 #include <mutex>
 #include <condition_variable>
+#include <atomic>
+#include <thread>
 
 // worker = 1
 DEFINE_THREAD_POOL_CODE(THREAD_POOL_TEST_TASK_QUEUE_1);
@@ -50,6 +52,18 @@ DEFINE_THREAD_POOL_CODE(THREAD_POOL_TEST_TASK_QUEUE_2);
 DEFINE_TASK_CODE(LPC_TEST_TASK_QUEUE_1, TASK_PRIORITY_HIGH, THREAD_POOL_TEST_TASK_QUEUE_1)
 DEFINE_TASK_CODE(LPC_TEST_TASK_QUEUE_2, TASK_PRIORITY_HIGH, THREAD_POOL_TEST_TASK_QUEUE_2)
 
+// shared pools with worker = 4, each with a different queue provider
+DEFINE_THREAD_POOL_CODE(THREAD_POOL_TEST_TASK_QUEUE_HPC)
+DEFINE_THREAD_POOL_CODE(THREAD_POOL_TEST_TASK_QUEUE_CONCURRENT)
+DEFINE_THREAD_POOL_CODE(THREAD_POOL_TEST_TASK_QUEUE_WORK_STEALING)
+DEFINE_TASK_CODE(LPC_TEST_TASK_QUEUE_HPC, TASK_PRIORITY_COMMON, THREAD_POOL_TEST_TASK_QUEUE_HPC)
+DEFINE_TASK_CODE(LPC_TEST_TASK_QUEUE_CONCURRENT,
+                 TASK_PRIORITY_COMMON,
+                 THREAD_POOL_TEST_TASK_QUEUE_CONCURRENT)
+DEFINE_TASK_CODE(LPC_TEST_TASK_QUEUE_WORK_STEALING,
+                 TASK_PRIORITY_COMMON,
+                 THREAD_POOL_TEST_TASK_QUEUE_WORK_STEALING)
+
 struct auto_timer
 {
     std::string prefix;
@@ -203,4 +217,101 @@ TEST(core, task_queue_perf_test)
     external_blocking(enqueue_time / 10);
     self_iterating(enqueue_time);
     tic_tock_iterating(enqueue_time / 10);
-}
\ No newline at end of file
+}
+
+struct countdown_context
+{
+    std::mutex mut;
+    std::condition_variable cv;
+    bool done = false;
+    std::atomic<int> left;
+    dsn::task_code code;
+    int fanout;
+};
+void countdown_cb(void *ctx)
+{
+    auto context = reinterpret_cast<countdown_context *>(ctx);
+    if (--context->left == 0) {
+        std::lock_guard<std::mutex> _(context->mut);
+        context->done = true;
+        context->cv.notify_one();
+    }
+}
+void fanout_cb(void *ctx)
+{
+    // enqueue from inside the pool, so the local queue of the worker is used
+    auto context = reinterpret_cast<countdown_context *>(ctx);
+    for (int i = 0; i < context->fanout; i++) {
+        (new task_c(context->code, countdown_cb, ctx, nullptr))->enqueue();
+    }
+    countdown_cb(ctx);
+}
+void wait_countdown(countdown_context &ctx)
+{
+    std::unique_lock<std::mutex> _lk(ctx.mut);
+    ctx.cv.wait(_lk, [&] { return ctx.done; });
+}
+
+void multi_producer_flooding(dsn::task_code code,
+                             const std::string &name,
+                             int producer_count,
+                             const int enqueue_time)
+{
+    countdown_context ctx;
+    ctx.left = enqueue_time;
+    ctx.code = code;
+    ctx.fanout = 0;
+
+    std::vector<std::vector<task_c *>> tsks(producer_count);
+    for (int i = 0; i < enqueue_time; i++) {
+        tsks[i % producer_count].push_back(new task_c(code, countdown_cb, &ctx, nullptr));
+    }
+    {
+        auto_timer t(name + " multi-producer flooding test:", enqueue_time);
+        std::vector<std::thread> producers;
+        for (int i = 0; i < producer_count; i++) {
+            producers.emplace_back([&tsks, i]() {
+                for (auto tsk : tsks[i]) {
+                    tsk->enqueue();
+                }
+            });
+        }
+        for (auto &p : producers) {
+            p.join();
+        }
+        wait_countdown(ctx);
+    }
+}
+
+void in_pool_fanout(dsn::task_code code, const std::string &name, const int enqueue_time)
+{
+    const int fanout = 100;
+    const int root_count = enqueue_time / (fanout + 1);
+
+    countdown_context ctx;
+    ctx.left = root_count * (fanout + 1);
+    ctx.code = code;
+    ctx.fanout = fanout;
+    {
+        auto_timer t(name + " in-pool fan-out test:", root_count * (fanout + 1));
+        for (int i = 0; i < root_count; i++) {
+            (new task_c(code, fanout_cb, &ctx, nullptr))->enqueue();
+        }
+        wait_countdown(ctx);
+    }
+}
+
+TEST(core, shared_task_queue_perf_test)
+{
+    const int enqueue_time = 4000000;
+    std::vector<std::pair<dsn::task_code, std::string>> queues = {
+        {LPC_TEST_TASK_QUEUE_HPC, "hpc_task_queue"},
+        {LPC_TEST_TASK_QUEUE_CONCURRENT, "hpc_concurrent_task_queue"},
+        {LPC_TEST_TASK_QUEUE_WORK_STEALING, "hpc_work_stealing_task_queue"}};
+
+    for (auto &q : queues) {
+        multi_producer_flooding(q.first, q.second, 1, enqueue_time);
+        multi_producer_flooding(q.first, q.second, 4, enqueue_time);
+        in_pool_fanout(q.first, q.second, enqueue_time);
+    }
+}
@@ -0,0 +1,173 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015 Microsoft Corporation
+ *
+ * -=- Robust Distributed System Nucleus (rDSN) -=-
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * Description:
+ *     Disk IO performance test
+ *
+ * Revision history:
+ *     2016-01-05, Tianyi Wang, first version
+ */
+
+#include <dsn/service_api_cpp.h>
+#include <gtest/gtest.h>
+#include "../tools/hpc/timer_wheel.h"
+#include "test_utils.h"
+#include <map>
+#include <mutex>
+#include <condition_variable>
+
+DEFINE_TASK_CODE(LPC_TEST_TIMER, TASK_PRIORITY_COMMON, THREAD_POOL_TEST_SERVER)
+
+struct fake_timer
+{
+    fake_timer *next = nullptr;
+};
+
+// compare the timer bookkeeping cost of the timing wheel and the std::map buckets
+// used previously by io_looper, with timer_count outstanding timers such as rpc timeouts
+static void timer_bookkeeping_perf(const int timer_count)
+{
+    std::chrono::steady_clock clock;
+    std::vector<fake_timer> timers(timer_count);
+    std::vector<uint64_t> delays(timer_count);
+    for (auto &d : delays) {
+        d = dsn_random64(1000, 10000);
+    }
+
+    const uint64_t start_ms = dsn_now_ms();
+    const uint64_t end_ms = start_ms + 10000;
+    {
+        dsn::tools::timer_wheel<fake_timer> wheel;
+        auto tic = clock.now();
+        for (int i = 0; i < timer_count; i++) {
+            wheel.add(&timers[i], start_ms + delays[i], start_ms);
+        }
+        auto toc = clock.now();
+
+        int fired = 0;
+        for (uint64_t now = start_ms; now <= end_ms; now++) {
+            wheel.advance(now, [&fired](fake_timer *t) { fired++; });
+        }
+        auto toc2 = clock.now();
+        EXPECT_EQ(timer_count, fired);
+
+        std::cout << "timer_wheel: add cost = "
+                  << std::chrono::duration_cast<std::chrono::nanoseconds>(toc - tic).count() /
+                         timer_count
+                  << " ns/timer, fire cost = "
+                  << std::chrono::duration_cast<std::chrono::nanoseconds>(toc2 - toc).count() /
+                         timer_count
+                  << " ns/timer" << std::endl;
+    }
+
+    {
+        std::map<uint64_t, slist<fake_timer>> buckets;
+        auto tic = clock.now();
+        for (int i = 0; i < timer_count; i++) {
+            auto pr = buckets.insert(std::map<uint64_t, slist<fake_timer>>::value_type(
+                start_ms + delays[i], slist<fake_timer>()));
+            pr.first->second.add(&timers[i]);
+        }
+        auto toc = clock.now();
+
+        int fired = 0;
+        for (uint64_t now = start_ms; now <= end_ms; now++) {
+            while (buckets.size() > 0 && buckets.begin()->first <= now) {
+                auto t = buckets.begin()->second.pop_all();
+                buckets.erase(buckets.begin());
+                while (t) {
+                    auto next = t->next;
+                    t->next = nullptr;
+                    fired++;
+                    t = next;
+                }
+            }
+        }
+        auto toc2 = clock.now();
+        EXPECT_EQ(timer_count, fired);
+
+        std::cout << "std::map buckets: add cost = "
+                  << std::chrono::duration_cast<std::chrono::nanoseconds>(toc - tic).count() /
+                         timer_count
+                  << " ns/timer, fire cost = "
+                  << std::chrono::duration_cast<std::chrono::nanoseconds>(toc2 - toc).count() /
+                         timer_count
+                  << " ns/timer" << std::endl;
+    }
+}
+
+struct timer_countdown
+{
+    std::mutex mut;
+    std::condition_variable cv;
+    bool done = false;
+    std::atomic<int> left;
+};
+
+static void timer_countdown_cb(void *ctx)
+{
+    auto context = reinterpret_cast<timer_countdown *>(ctx);
+    if (--context->left == 0) {
+        std::lock_guard<std::mutex> _(context->mut);
+        context->done = true;
+        context->cv.notify_one();
+    }
+}
+
+// end-to-end cost of registering timer_count delayed tasks through the timer service
+static void timer_service_perf(const int timer_count)
+{
+    std::chrono::steady_clock clock;
+    timer_countdown ctx;
+    ctx.left = timer_count;
+
+    std::vector<task_c *> tsks;
+    for (int i = 0; i < timer_count; i++) {
+        auto tsk = new task_c(LPC_TEST_TIMER, timer_countdown_cb, &ctx, nullptr);
+        tsk->set_delay(static_cast<int>(dsn_random32(1000, 5000)));
+        tsks.push_back(tsk);
+    }
+
+    auto tic = clock.now();
+    for (auto tsk : tsks) {
+        tsk->enqueue();
+    }
+    auto toc = clock.now();
+    std::cout << "timer service: add cost = "
+              << std::chrono::duration_cast<std::chrono::nanoseconds>(toc - tic).count() /
+                     timer_count
+              << " ns/timer with " << timer_count << " outstanding timers" << std::endl;
+
+    std::unique_lock<std::mutex> _lk(ctx.mut);
+    ctx.cv.wait(_lk, [&] { return ctx.done; });
+}
+
+TEST(core, timer_perf_test)
+{
+    timer_bookkeeping_perf(1000000);
+    timer_service_perf(1000000);
+}
@@ -143,6 +143,77 @@ TEST(core, aio)
     utils::filesystem::remove_path("tmp");
 }
 
+TEST(core, aio_batched_vector_write)
+{
+    // if in dsn_mimic_app() and disk_io_mode == IOE_PER_QUEUE
+    if (task::get_current_disk() == nullptr)
+        return;
+
+    // contiguous plain and vectored writes are batched into one write
+    const int buffer_count = 4, buffer_size = 100, round = 50;
+    std::vector<std::string> contents;
+    for (int i = 0; i < round * buffer_count; i++) {
+        contents.push_back(std::string(buffer_size, (char)('a' + i % 26)));
+    }
+
+    auto fp = dsn_file_open("tmp_vec", O_RDWR | O_CREAT | O_BINARY, 0666);
+    ASSERT_TRUE(fp != nullptr);
+
+    std::list<task_ptr> tasks;
+    std::vector<dsn_file_buffer_t> buffers(round * buffer_count);
+    uint64_t offset = 0;
+    for (int i = 0; i < round; i++) {
+        if (i % 2 == 0) {
+            for (int j = 0; j < buffer_count; j++) {
+                auto &b = buffers[i * buffer_count + j];
+                b.buffer = (void *)contents[i * buffer_count + j].data();
+                b.size = buffer_size;
+            }
+            tasks.push_back(::dsn::file::write_vector(fp,
+                                                      &buffers[i * buffer_count],
+                                                      buffer_count,
+                                                      offset,
+                                                      LPC_AIO_TEST,
+                                                      nullptr,
+                                                      dsn::empty_callback));
+            offset += buffer_count * buffer_size;
+        } else {
+            for (int j = 0; j < buffer_count; j++) {
+                tasks.push_back(::dsn::file::write(fp,
+                                                   contents[i * buffer_count + j].data(),
+                                                   buffer_size,
+                                                   offset,
+                                                   LPC_AIO_TEST,
+                                                   nullptr,
+                                                   dsn::empty_callback));
+                offset += buffer_size;
+            }
+        }
+    }
+    for (auto &t : tasks) {
+        t->wait();
+        EXPECT_EQ(ERR_OK, t->error());
+    }
+    EXPECT_EQ(ERR_OK, dsn_file_close(fp));
+
+    std::string expected;
+    for (auto &c : contents) {
+        expected.append(c);
+    }
+
+    fp = dsn_file_open("tmp_vec", O_RDONLY | O_BINARY, 0);
+    ASSERT_TRUE(fp != nullptr);
+    std::string actual(expected.length(), '\0');
+    auto t = ::dsn::file::read(
+        fp, &actual[0], (int)actual.length(), 0, LPC_AIO_TEST, nullptr, dsn::empty_callback);
+    t->wait();
+    EXPECT_EQ(actual.length(), t->io_size());
+    EXPECT_EQ(expected, actual);
+    EXPECT_EQ(ERR_OK, dsn_file_close(fp));
+
+    utils::filesystem::remove_path("tmp_vec");
+}
+
 TEST(core, aio_share)
 {
     // if in dsn_mimic_app() and disk_io_mode == IOE_PER_QUEUE
@@ -0,0 +1,170 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015 Microsoft Corporation
+ *
+ * -=- Robust Distributed System Nucleus (rDSN) -=-
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * Description:
+ *     Unit-test for coroutine.
+ *
+ * Revision history:
+ *     xxxx-xx-xx, author, first version
+ *     xxxx-xx-xx, author, fix bug about xxx
+ */
+
+#include <gtest/gtest.h>
+#include <dsn/service_api_cpp.h>
+#include <dsn/cpp/coroutine.h>
+#include <dsn/tool-api/task.h>
+#include <dsn/tool_api.h>
+#include <thread>
+#include "test_utils.h"
+
+DEFINE_THREAD_POOL_CODE(THREAD_POOL_FOR_TEST_2)
+DEFINE_TASK_CODE(LPC_TEST_COROUTINE, TASK_PRIORITY_COMMON, THREAD_POOL_FOR_TEST_2)
+
+using namespace dsn;
+
+class test_coroutine : public coroutine
+{
+public:
+    test_coroutine(utils::notify_event *done)
+        : _done(done), worker(nullptr), resumed_inline(false), delay_ms(0), echo_err(ERR_UNKNOWN)
+    {
+    }
+
+    utils::notify_event *_done;
+    task_worker *worker;
+    bool resumed_inline;
+    uint64_t delay_ms;
+    error_code echo_err;
+    std::string echo;
+
+    void run() override
+    {
+        DSN_CO_BEGIN
+        DSN_CO_AWAIT(await_task(LPC_TEST_COROUTINE, 1));
+        worker = task::get_current_worker();
+
+        // the same worker, no task is needed
+        DSN_CO_AWAIT(resumed_inline = await_task(LPC_TEST_COROUTINE, 1));
+        EXPECT_EQ(worker, task::get_current_worker());
+
+        delay_ms = dsn_now_ms();
+        DSN_CO_AWAIT(await_task(LPC_TEST_COROUTINE, 2, std::chrono::milliseconds(100)));
+        delay_ms = dsn_now_ms() - delay_ms;
+
+        DSN_CO_AWAIT(await_rpc(rpc_address("localhost", 20101),
+                               RPC_TEST_STRING_COMMAND,
+                               std::string("echo hello coroutine")));
+        echo_err = co_err;
+        unmarshall_response(echo);
+
+        _done->notify();
+        DSN_CO_END
+    }
+};
+
+class delayed_coroutine : public coroutine
+{
+public:
+    delayed_coroutine(bool *resumed) : _resumed(resumed) {}
+    ~delayed_coroutine() { *_resumed = false; }
+
+    bool *_resumed;
+
+    void run() override
+    {
+        DSN_CO_BEGIN
+        *_resumed = true;
+        DSN_CO_AWAIT(await_task(LPC_TEST_COROUTINE, 0, std::chrono::seconds(10)));
+        dassert(false, "cancelled coroutine must not be resumed");
+        DSN_CO_END
+    }
+};
+
+class running_coroutine : public coroutine
+{
+public:
+    running_coroutine(bool *resumed) : _resumed(resumed) {}
+
+    bool *_resumed;
+    utils::notify_event running;
+    utils::notify_event proceed;
+
+    void run() override
+    {
+        DSN_CO_BEGIN
+        DSN_CO_AWAIT(await_task(LPC_TEST_COROUTINE, 0));
+        running.notify();
+        proceed.wait();
+        DSN_CO_AWAIT(await_task(LPC_TEST_COROUTINE, 1, std::chrono::milliseconds(10)));
+        *_resumed = true;
+        DSN_CO_END
+    }
+};
+
+TEST(core, coroutine)
+{
+    utils::notify_event done;
+    test_coroutine *co = new test_coroutine(&done);
+    task_ptr t = co->start();
+    ASSERT_TRUE(done.wait_for(10000));
+
+    EXPECT_NE(nullptr, co->worker);
+    EXPECT_TRUE(co->resumed_inline);
+    EXPECT_GE(co->delay_ms, 100u);
+    EXPECT_EQ(ERR_OK, co->echo_err);
+    EXPECT_EQ("hello coroutine", co->echo);
+
+    // cancelled while waiting, the coroutine is released except the handle held here
+    bool alive = false;
+    t = (new delayed_coroutine(&alive))->start();
+    EXPECT_TRUE(alive);
+    bool finished = false;
+    EXPECT_TRUE(t->cancel(false, &finished));
+    EXPECT_TRUE(finished);
+    EXPECT_EQ(1, t->get_count());
+    t = nullptr;
+    EXPECT_FALSE(alive);
+
+    // cancelled on another thread while the body is running, the cancellation does not
+    // take effect and the coroutine goes on to complete
+    if (dsn::tools::get_current_tool()->name() != "simulator") {
+        bool resumed = false;
+        running_coroutine *rco = new running_coroutine(&resumed);
+        t = rco->start();
+        ASSERT_TRUE(rco->running.wait_for(10000));
+        finished = true;
+        EXPECT_FALSE(t->cancel(false, &finished));
+        EXPECT_FALSE(finished);
+        rco->proceed.notify();
+        for (int i = 0; i < 500 && !rco->is_done(); i++) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        EXPECT_TRUE(rco->is_done());
+        EXPECT_TRUE(resumed);
+        t = nullptr;
+    }
+}
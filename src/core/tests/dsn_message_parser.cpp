@@ -0,0 +1,178 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015 Microsoft Corporation
+ *
+ * -=- Robust Distributed System Nucleus (rDSN) -=-
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * Description:
+ *     Unit-test for dsn_message_parser, especially the compact header.
+ *
+ * Revision history:
+ *     xxxx-xx-xx, author, first version
+ *     xxxx-xx-xx, author, fix bug about xxx
+ */
+
+#include <dsn/tool-api/rpc_message.h>
+#include <dsn/tool-api/message_parser.h>
+#include <dsn/utility/crc.h>
+#include <gtest/gtest.h>
+#include "../tools/common/dsn_message_parser.h"
+
+using namespace ::dsn;
+
+DEFINE_TASK_CODE_RPC(RPC_CODE_FOR_COMPACT_HEADER_TEST,
+                     TASK_PRIORITY_COMMON,
+                     ::dsn::THREAD_POOL_DEFAULT)
+
+static message_ex *create_test_request(const char *data)
+{
+    message_ex *request = message_ex::create_request(RPC_CODE_FOR_COMPACT_HEADER_TEST, 100, -1, 2);
+    request->header->from_address = rpc_address("127.0.0.1", 8080);
+    request->header->trace_id = 123456789;
+    request->header->gpid.u.app_id = 3;
+    request->header->gpid.u.partition_index = 7;
+
+    void *ptr;
+    size_t sz;
+    size_t data_size = strlen(data);
+    request->write_next(&ptr, &sz, data_size);
+    memcpy(ptr, data, data_size);
+    request->write_commit(data_size);
+    return request;
+}
+
+static void expect_same_header(const message_header &l, const message_header &r)
+{
+    EXPECT_EQ(l.body_length, r.body_length);
+    EXPECT_EQ(l.body_crc32, r.body_crc32);
+    EXPECT_EQ(l.id, r.id);
+    EXPECT_EQ(l.trace_id, r.trace_id);
+    EXPECT_STREQ(l.rpc_name, r.rpc_name);
+    EXPECT_EQ(l.gpid.value, r.gpid.value);
+    EXPECT_EQ(l.context.context, r.context.context);
+    EXPECT_EQ(l.from_address, r.from_address);
+    EXPECT_EQ(l.client.timeout_ms, r.client.timeout_ms);
+    EXPECT_EQ(l.client.thread_hash, r.client.thread_hash);
+    EXPECT_EQ(l.client.partition_hash, r.client.partition_hash);
+}
+
+TEST(core, dsn_message_parser_compact_header)
+{
+    message_ex *request = create_test_request("hello");
+    message_ex *response = request->create_response();
+    strcpy(response->header->server.error_name, ERR_NOT_ENOUGH_MEMBER.to_string());
+    response->header->server.error_code.local_code = ERR_NOT_ENOUGH_MEMBER;
+    response->header->body_crc32 = 0x12345678;
+
+    char buffer[dsn_message_parser::COMPACT_HEADER_MAX_LENGTH];
+    for (message_ex *msg : {request, response}) {
+        for (bool with_names : {true, false}) {
+            int length =
+                dsn_message_parser::encode_compact_header(*msg->header, with_names, buffer);
+            ASSERT_GT(length, (int)dsn_message_parser::COMPACT_HEADER_PREFIX_LENGTH);
+            ASSERT_LT(length, (int)sizeof(message_header) / 2);
+
+            message_header hdr;
+            ASSERT_TRUE(dsn_message_parser::decode_compact_header(buffer, length, hdr));
+            expect_same_header(*msg->header, hdr);
+            if (!msg->header->context.u.is_request) {
+                EXPECT_STREQ(ERR_NOT_ENOUGH_MEMBER.to_string(), hdr.server.error_name);
+            }
+            if (!with_names) {
+                EXPECT_EQ(msg->header->rpc_code.local_code, hdr.rpc_code.local_code);
+            }
+
+            // truncated
+            ASSERT_FALSE(dsn_message_parser::decode_compact_header(buffer, length - 1, hdr));
+        }
+    }
+
+    request->add_ref();
+    request->release_ref();
+    response->add_ref();
+    response->release_ref();
+}
+
+TEST(core, dsn_message_parser_receive)
+{
+    const char *data = "compact header payload";
+    message_ex *request = create_test_request(data);
+
+    // no compact header without a session
+    dsn_message_parser sender;
+    sender.prepare_on_send(request);
+    EXPECT_EQ(dsn_message_parser::COMPACT_HEADER_VERSION, request->header->hdr_version);
+    EXPECT_EQ(0u, request->compact_header.length());
+    EXPECT_EQ((int)request->buffers.size(), sender.get_buffer_count_on_send(request));
+
+    // a compact message followed by a full one
+    char compact[dsn_message_parser::COMPACT_HEADER_MAX_LENGTH];
+    int compact_length = dsn_message_parser::encode_compact_header(*request->header, true, compact);
+    ASSERT_GT(compact_length, 0);
+    std::string stream(compact, compact_length);
+    stream.append(data);
+    for (auto &bb : request->buffers)
+        stream.append(bb.data(), bb.length());
+
+    message_reader reader(4096);
+    char *ptr = reader.read_buffer_ptr(stream.length());
+    memcpy(ptr, stream.data(), stream.length());
+    reader.mark_read(stream.length());
+
+    dsn_message_parser receiver;
+    int read_next;
+    for (int i = 0; i < 2; ++i) {
+        message_ex *msg = receiver.get_message_on_receive(&reader, read_next);
+        ASSERT_NE(nullptr, msg);
+        expect_same_header(*request->header, *msg->header);
+        EXPECT_EQ(RPC_CODE_FOR_COMPACT_HEADER_TEST, msg->rpc_code());
+
+        void *body;
+        size_t sz;
+        ASSERT_TRUE(msg->read_next(&body, &sz));
+        EXPECT_EQ(std::string(data), std::string((const char *)body, sz));
+        msg->read_commit(sz);
+
+        msg->add_ref();
+        msg->release_ref();
+    }
+    EXPECT_EQ(nullptr, receiver.get_message_on_receive(&reader, read_next));
+    EXPECT_LT(0, read_next);
+
+    // corrupted compact header
+    {
+        uint32_t bad_crc = 1;
+        memcpy(compact + 12, &bad_crc, sizeof(bad_crc));
+        ptr = reader.read_buffer_ptr(compact_length + strlen(data));
+        memcpy(ptr, compact, compact_length);
+        memcpy(ptr + compact_length, data, strlen(data));
+        reader.mark_read(compact_length + strlen(data));
+        dsn_message_parser receiver2;
+        EXPECT_EQ(nullptr, receiver2.get_message_on_receive(&reader, read_next));
+        EXPECT_EQ(-1, read_next);
+    }
+
+    request->add_ref();
+    request->release_ref();
+}
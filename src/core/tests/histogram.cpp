@@ -0,0 +1,168 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015 Microsoft Corporation
+ *
+ * -=- Robust Distributed System Nucleus (rDSN) -=-
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * Description:
+ *     Unit-test for histogram.
+ *
+ * Revision history:
+ *     xxxx-xx-xx, author, first version
+ *     xxxx-xx-xx, author, fix bug about xxx
+ */
+
+#include <dsn/utility/histogram.h>
+#include <gtest/gtest.h>
+#include <limits>
+#include <thread>
+#include <vector>
+
+using namespace dsn;
+
+TEST(core, histogram_buckets)
+{
+    std::vector<uint64_t> values = {0, 1, 15, 16, 17, 31, 32, 100, 1000, 123456789,
+                                    std::numeric_limits<uint64_t>::max()};
+    for (int shift = 0; shift < 64; ++shift) {
+        values.push_back(1ULL << shift);
+        values.push_back((1ULL << shift) - 1);
+    }
+
+    for (uint64_t v : values) {
+        int index = histogram_snapshot::bucket_index(v);
+        ASSERT_GE(index, 0);
+        ASSERT_LT(index, histogram_snapshot::bucket_count);
+        uint64_t lower = histogram_snapshot::bucket_lower_bound(index);
+        uint64_t upper = histogram_snapshot::bucket_upper_bound(index);
+        ASSERT_LE(lower, v);
+        ASSERT_GE(upper, v);
+        // the relative error is bounded by the sub buckets, except for the last bucket
+        if (v < (1ULL << histogram_snapshot::max_value_bits))
+            ASSERT_LE(upper - lower, lower / histogram_snapshot::sub_bucket_count);
+        else
+            ASSERT_EQ(histogram_snapshot::bucket_count - 1, index);
+    }
+
+    // the buckets are continuous
+    for (int i = 1; i < histogram_snapshot::bucket_count; ++i) {
+        ASSERT_EQ(histogram_snapshot::bucket_upper_bound(i - 1) + 1,
+                  histogram_snapshot::bucket_lower_bound(i));
+    }
+}
+
+TEST(core, histogram_percentile)
+{
+    histogram_snapshot s;
+    ASSERT_EQ(0u, s.percentile(99));
+    ASSERT_EQ(0u, s.min());
+
+    for (uint64_t v = 1; v <= 1000; ++v) {
+        s.record(v);
+    }
+    ASSERT_EQ(1000u, s.count());
+    ASSERT_EQ(1u, s.min());
+    ASSERT_EQ(1000u, s.max());
+    ASSERT_DOUBLE_EQ(500.5, s.mean());
+    ASSERT_EQ(1u, s.percentile(0));
+    ASSERT_EQ(1000u, s.percentile(100));
+    for (double p : {50.0, 90.0, 95.0, 99.0, 99.9, 99.99}) {
+        double expected = p * 10;
+        ASSERT_GE(s.percentile(p), expected);
+        ASSERT_LE(s.percentile(p), expected * (1 + 1.0 / histogram_snapshot::sub_bucket_count));
+    }
+
+    // a single spike is never lost
+    s.record(1000000);
+    ASSERT_EQ(1000000u, s.percentile(100));
+    ASSERT_EQ(1000000u, s.max());
+}
+
+TEST(core, histogram_merge)
+{
+    histogram h1, h2;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 8; ++i) {
+        threads.emplace_back([&h1, &h2, i]() {
+            for (uint64_t v = i; v < 8000; v += 8) {
+                h1.record(v);
+                h2.record(v + 8000);
+            }
+        });
+    }
+    for (auto &t : threads) {
+        t.join();
+    }
+
+    histogram_snapshot s1, s2, merged;
+    h1.merge_to(s1);
+    h2.merge_to(s2);
+    ASSERT_EQ(8000u, s1.count());
+    ASSERT_EQ(8000u, s2.count());
+    ASSERT_EQ(7999u, s1.max());
+    ASSERT_EQ(8000u, s2.min());
+
+    h1.merge_to(merged);
+    h2.merge_to(merged);
+    ASSERT_EQ(16000u, merged.count());
+    ASSERT_EQ(0u, merged.min());
+    ASSERT_EQ(15999u, merged.max());
+    ASSERT_DOUBLE_EQ(7999.5, merged.mean());
+
+    s1.merge(s2);
+    ASSERT_EQ(merged.count(), s1.count());
+    ASSERT_EQ(merged.sum(), s1.sum());
+    ASSERT_EQ(merged.percentile(50), s1.percentile(50));
+    ASSERT_EQ(merged.percentile(99.9), s1.percentile(99.9));
+}
+
+TEST(core, histogram_reset)
+{
+    histogram h;
+    for (uint64_t v = 1; v <= 100; ++v) {
+        h.record(v);
+    }
+    h.record(1ULL << 50);
+
+    histogram_snapshot s;
+    h.merge_and_reset(s);
+    ASSERT_EQ(101u, s.count());
+    ASSERT_EQ(1u, s.min());
+    ASSERT_EQ(1ULL << 50, s.max());
+    ASSERT_EQ(1ULL << 50, s.percentile(100));
+
+    // only the values recorded after the reset are read
+    for (uint64_t v = 1000; v < 1010; ++v) {
+        h.record(v);
+    }
+    histogram_snapshot window;
+    h.merge_and_reset(window);
+    ASSERT_EQ(10u, window.count());
+    ASSERT_EQ(1000u, window.min());
+    ASSERT_EQ(1009u, window.max());
+
+    histogram_snapshot empty;
+    h.merge_to(empty);
+    ASSERT_EQ(0u, empty.count());
+}
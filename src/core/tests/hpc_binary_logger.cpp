@@ -0,0 +1,140 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015 Microsoft Corporation
+ *
+ * -=- Robust Distributed System Nucleus (rDSN) -=-
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * Description:
+ *     Unit-test for hpc binary logger.
+ *
+ * Revision history:
+ *     xxxx-xx-xx, author, first version
+ *     xxxx-xx-xx, author, fix bug about xxx
+ */
+
+#include <sstream>
+#include <vector>
+#include <string>
+#include <gtest/gtest.h>
+#include <dsn/service_api_cpp.h>
+#include <dsn/utility/filesystem.h>
+
+#include "../tools/hpc/hpc_binary_logger.h"
+
+using namespace dsn;
+using namespace dsn::tools;
+
+static void binary_log_print(logging_provider *logger, const char *fmt, ...)
+{
+    va_list vl;
+    va_start(vl, fmt);
+    logger->dsn_logv(__FILE__, __FUNCTION__, __LINE__, LOG_LEVEL_INFORMATION, fmt, vl);
+    va_end(vl);
+}
+
+static std::string expected_body(const char *fmt, ...)
+{
+    char buffer[1024];
+    va_list vl;
+    va_start(vl, fmt);
+    vsnprintf(buffer, sizeof(buffer), fmt, vl);
+    va_end(vl);
+    return std::string(": ") + buffer;
+}
+
+static bool ends_with(const std::string &line, const std::string &suffix)
+{
+    return line.length() >= suffix.length() &&
+           line.compare(line.length() - suffix.length(), suffix.length(), suffix) == 0;
+}
+
+// binary_output is enabled in config-test.ini
+TEST(tools_hpc, binary_logger)
+{
+    const std::string dir = "./binary_logger_test";
+    utils::filesystem::remove_path(dir);
+    ASSERT_TRUE(utils::filesystem::create_directory(dir));
+
+    const char *all_fmt = "int %d, i64 %" PRId64 ", hex %08x, double %.2f, str [%-6s], [%.*s], "
+                          "char %c, %%, size %zu, ptr %p";
+    std::vector<std::string> expected;
+    {
+        hpc_binary_logger logger(dir.c_str());
+
+        binary_log_print(&logger, "%s", "test_print");
+        expected.push_back(expected_body("%s", "test_print"));
+
+        binary_log_print(
+            &logger, all_fmt, -3, (int64_t)1 << 40, 255, 3.14159, "ab", 3, "abcdef", 'z',
+            (size_t)7, (void *)nullptr);
+        expected.push_back(expected_body(
+            all_fmt, -3, (int64_t)1 << 40, 255, 3.14159, "ab", 3, "abcdef", 'z', (size_t)7,
+            (void *)nullptr));
+
+        // the same address is reused by a different format
+        char fmt[32];
+        strcpy(fmt, "first %d");
+        binary_log_print(&logger, fmt, 1);
+        expected.push_back(expected_body("first %d", 1));
+        strcpy(fmt, "second %s");
+        binary_log_print(&logger, fmt, "2");
+        expected.push_back(expected_body("second %s", "2"));
+
+        // formats not supported by the encoder are formatted in place
+        binary_log_print(&logger, "long double %.1Lf", (long double)1.5);
+        expected.push_back(expected_body("long double %.1Lf", (long double)1.5));
+
+        // from another thread, with its own ring
+        std::thread t([&logger]() { binary_log_print(&logger, "thread %d", 42); });
+        t.join();
+        expected.push_back(expected_body("thread %d", 42));
+
+        logger.flush();
+        EXPECT_EQ(0, logger.dropped_count());
+    }
+
+    std::vector<std::string> files;
+    ASSERT_TRUE(utils::filesystem::get_subfiles(dir, files, false));
+    ASSERT_EQ(1u, files.size());
+    ASSERT_TRUE(ends_with(files[0], ".bin"));
+
+    std::stringstream os;
+    ASSERT_EQ(ERR_OK, hpc_binary_logger::decode_file(files[0].c_str(), os));
+
+    std::vector<std::string> lines;
+    std::string line;
+    while (std::getline(os, line))
+        lines.push_back(line);
+    ASSERT_EQ(expected.size(), lines.size());
+    for (size_t i = 0; i < lines.size(); ++i) {
+        EXPECT_EQ('I', lines[i][0]);
+        EXPECT_TRUE(ends_with(lines[i], expected[i])) << lines[i] << " vs " << expected[i];
+    }
+
+    std::stringstream bad;
+    EXPECT_EQ(ERR_FILE_OPERATION_FAILED,
+              hpc_binary_logger::decode_file((dir + "/not_exist.bin").c_str(), bad));
+
+    utils::filesystem::remove_path(dir);
+}
@@ -222,3 +222,42 @@ TEST(tools_common, sim_net_provider)
 
     TEST_PORT++;
 }
+
+class session_pool_network : public sim_network_provider
+{
+public:
+    session_pool_network(int count) : sim_network_provider(task::get_current_rpc(), nullptr)
+    {
+        _client_session_count_per_server = count;
+    }
+    using connection_oriented_network::get_client_session_index;
+};
+
+TEST(tools_common, client_session_index)
+{
+    auto index_of = [](session_pool_network &net, int thread_hash, int body_size, bool bulk) {
+        task_spec::get(RPC_TEST_NETPROVIDER.code())->rpc_call_is_bulk = bulk;
+        message_ex *msg = message_ex::create_request(RPC_TEST_NETPROVIDER, 0, thread_hash);
+        ::dsn::marshall(msg, std::string(body_size, 'x'));
+        int index = net.get_client_session_index(msg);
+        delete msg;
+        task_spec::get(RPC_TEST_NETPROVIDER.code())->rpc_call_is_bulk = false;
+        return index;
+    };
+
+    // one session per server as before
+    session_pool_network single(1);
+    ASSERT_EQ(0, index_of(single, 3, 10, false));
+    ASSERT_EQ(0, index_of(single, 3, 10, true));
+
+    // messages are spread by thread hash over all but the last session, which is reserved
+    // for the bulk rpc calls, and the message size does not matter
+    session_pool_network pooled(4);
+    ASSERT_EQ(0, index_of(pooled, 0, 10, false));
+    ASSERT_EQ(1, index_of(pooled, 1, 10, false));
+    ASSERT_EQ(1, index_of(pooled, 4, 10, false));
+    ASSERT_EQ(1, index_of(pooled, 1, 4096, false));
+    ASSERT_EQ(1, index_of(pooled, 4, 1024 * 1024, false));
+    ASSERT_EQ(3, index_of(pooled, 0, 10, true));
+    ASSERT_EQ(3, index_of(pooled, 1, 4096, true));
+}
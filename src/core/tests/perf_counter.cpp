@@ -121,6 +121,24 @@ static void test_perf_counter(perf_counter::factory f)
         for (int i = 0; i != COUNTER_PERCENTILE_COUNT; ++i)
             ddebug("%lf", counter->get_percentile((dsn_perf_counter_percentile_type_t)i));
     }
+
+    counter = f("", "", "", dsn_perf_counter_type_t::COUNTER_TYPE_HISTOGRAM, "");
+    std::vector<thread_ptr> set_threads;
+    for (int i = 0; i < 10; ++i) {
+        set_threads.emplace_back(new std::thread([counter, i]() {
+            for (uint64_t v = i; v < 10000; v += 10)
+                counter->set(v);
+        }));
+    }
+    for (unsigned int i = 0; i != set_threads.size(); ++i)
+        set_threads[i]->join();
+
+    histogram_snapshot snapshot;
+    ASSERT_TRUE(counter->get_histogram(snapshot));
+    ASSERT_EQ(10000u, snapshot.count());
+    ASSERT_EQ(9999u, snapshot.max());
+    ASSERT_DOUBLE_EQ(4999.5, counter->get_value());
+    ASSERT_NEAR(9900, counter->get_percentile(COUNTER_PERCENTILE_99), 9900.0 / 16);
 }
 
 TEST(tools_common, simple_perf_counter) { test_perf_counter(simple_perf_counter_factory); }
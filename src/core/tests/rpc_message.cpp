@@ -37,6 +37,10 @@
 #include <dsn/utility/crc.h>
 #include <../core/transient_memory.h>
 #include <gtest/gtest.h>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 
 using namespace ::dsn;
 
@@ -147,6 +151,53 @@ TEST(core, message_ex)
         request->release_ref();
     }
 
+    { // write append, a shared payload is attached to multiple requests without copy
+        const char *head = "head";
+        const char *tail = "tail";
+        std::string payload(4096, 'x');
+        blob shared(payload.data(), 0, (int)payload.size());
+
+        std::vector<message_ex *> requests;
+        for (int i = 0; i < 2; i++) {
+            message_ex *request = message_ex::create_request(RPC_CODE_FOR_TEST, 100, 1);
+            void *ptr;
+            size_t sz;
+
+            request->write_next(&ptr, &sz, strlen(head));
+            memcpy(ptr, head, strlen(head));
+            request->write_commit(strlen(head));
+
+            request->write_append(shared);
+
+            request->write_next(&ptr, &sz, strlen(tail));
+            memcpy(ptr, tail, strlen(tail));
+            request->write_commit(strlen(tail));
+
+            // header and head share one buffer when allocated adjacently from tls memory
+            size_t count = request->buffers.size();
+            ASSERT_LE(3u, count);
+            ASSERT_EQ(shared.data(), request->buffers[count - 2].data());
+            ASSERT_EQ((int)strlen(tail), request->buffers[count - 1].length());
+            ASSERT_EQ(strlen(head) + payload.size() + strlen(tail), request->body_size());
+            requests.push_back(request);
+        }
+
+        for (message_ex *request : requests) {
+            message_ex *receive = request->copy(true, true);
+            void *ptr;
+            size_t sz;
+            ASSERT_TRUE(receive->read_next(&ptr, &sz));
+            ASSERT_EQ(std::string(head) + payload + tail, std::string((const char *)ptr, sz));
+            receive->read_commit(sz);
+
+            receive->add_ref();
+            receive->release_ref();
+
+            request->add_ref();
+            request->release_ref();
+        }
+    }
+
     { // read
         message_ex *request = message_ex::create_request(RPC_CODE_FOR_TEST, 100, 1);
         const char *data = "adaoihfeuifgggggisdosghkbvjhzxvdafdiofgeof";
@@ -244,3 +295,52 @@ TEST(core, message_ex)
         dsn_msg_release_ref(request);
     }
 }
+
+#ifndef _WIN32
+TEST(core, message_ex_file_segment)
+{
+    const char *file_name = "message_ex_file_segment.tmp";
+    std::string content("0123456789abcdefghijklmnopqrstuvwxyz");
+    int fd = ::open(file_name, O_RDWR | O_CREAT | O_TRUNC, 0666);
+    ASSERT_LE(0, fd);
+    ASSERT_EQ((ssize_t)content.size(), ::write(fd, content.data(), content.size()));
+
+    message_ex *request = message_ex::create_request(RPC_CODE_FOR_TEST, 100, 1);
+    const char *data = "header";
+    void *ptr;
+    size_t sz;
+    request->write_next(&ptr, &sz, strlen(data));
+    memcpy(ptr, data, strlen(data));
+    request->write_commit(strlen(data));
+
+    // the segment is released after the message is gone
+    int released = 0;
+    std::shared_ptr<void> holder(nullptr, [&released](void *) { ++released; });
+    request->attach_file_segment(fd, 10, 16, holder);
+    holder = nullptr;
+    ASSERT_EQ(strlen(data) + 16, request->body_size());
+    ASSERT_EQ(16u, request->file_seg.size);
+    ASSERT_EQ(0, released);
+
+    size_t buffer_count = request->buffers.size();
+    ASSERT_EQ(ERR_OK, request->load_file_segment());
+    ASSERT_EQ(0u, request->file_seg.size);
+    ASSERT_EQ(1, released);
+    ASSERT_EQ(strlen(data) + 16, request->body_size());
+    ASSERT_EQ(buffer_count + 1, request->buffers.size());
+    const blob &bb = request->buffers.back();
+    ASSERT_EQ(content.substr(10, 16), std::string(bb.data(), bb.length()));
+
+    // the range exceeds the file, and the missing part is filled with zero
+    request->attach_file_segment(fd, content.size() - 4, 8, nullptr);
+    ASSERT_EQ(ERR_FILE_OPERATION_FAILED, request->load_file_segment());
+    const blob &bb2 = request->buffers.back();
+    ASSERT_EQ(content.substr(content.size() - 4) + std::string(4, '\0'),
+              std::string(bb2.data(), bb2.length()));
+
+    request->add_ref();
+    request->release_ref();
+    ::close(fd);
+    ::remove(file_name);
+}
+#endif
@@ -40,6 +40,8 @@
 #include <dsn/utility/utils.h>
 #include <dsn/utility/filesystem.h>
 #include <gtest/gtest.h>
+#include <fstream>
+#include <sstream>
 #include <thread>
 #include "../core/service_engine.h"
 
@@ -389,6 +391,75 @@ TEST(core, dsn_nfs)
         dsn_task_release_ref(t);
     }
 
+    { // resume copying nfs_test_file1 from the offset in its resume record
+        std::ifstream src("nfs_test_file1", std::ios::binary);
+        std::stringstream src_content;
+        src_content << src.rdbuf();
+        std::string content = src_content.str();
+        ASSERT_LT(16u, content.size());
+
+        time_t mtime;
+        ASSERT_TRUE(utils::filesystem::last_write_time("nfs_test_file1", mtime));
+        std::string source_address = rpc_address("localhost", 20101).to_std_string();
+        std::string source_path = utils::filesystem::path_combine(".", "nfs_test_file1");
+
+        // the prefix before the recorded offset is kept with a marker byte which is
+        // not in the source, while the broken tail after it should be copied again
+        uint64_t offset = content.size() / 2;
+        std::string marked = content;
+        marked[0] = (char)~content[0];
+
+        auto copy_with_record = [&](int64_t recorded_mtime) {
+            {
+                std::ofstream os("nfs_test_dir/nfs_test_file1",
+                                 std::ios::binary | std::ios::trunc);
+                os << marked.substr(0, offset) << std::string(content.size() - offset, '\0');
+            }
+            {
+                std::ofstream os("nfs_test_dir/nfs_test_file1.nfs_resume");
+                os << source_address << std::endl
+                   << source_path << std::endl
+                   << content.size() << " " << recorded_mtime << " " << offset << std::endl;
+            }
+
+            const char *files[] = {"nfs_test_file1", nullptr};
+
+            aio_result r;
+            dsn_task_t t =
+                dsn_file_create_aio_task(LPC_AIO_TEST_NFS,
+                                         [](dsn::error_code err, size_t sz, void *param) {
+                                             aio_result *r = (aio_result *)param;
+                                             r->err = err;
+                                             r->sz = sz;
+                                         },
+                                         &r,
+                                         0);
+            dsn_task_add_ref(t);
+            ASSERT_NE(nullptr, t);
+            dsn_file_copy_remote_files(
+                dsn_address_build("localhost", 20101), ".", files, "nfs_test_dir", true, false, t);
+            ASSERT_TRUE(dsn_task_wait_timeout(t, 20000));
+            ASSERT_EQ(ERR_OK, r.err);
+            dsn_task_release_ref(t);
+            ASSERT_FALSE(
+                utils::filesystem::file_exists("nfs_test_dir/nfs_test_file1.nfs_resume"));
+        };
+        auto copied_content = []() {
+            std::ifstream dst("nfs_test_dir/nfs_test_file1", std::ios::binary);
+            std::stringstream dst_content;
+            dst_content << dst.rdbuf();
+            return dst_content.str();
+        };
+
+        // resumed from the recorded offset, so the marker before it survives
+        copy_with_record((int64_t)mtime);
+        ASSERT_EQ(marked, copied_content());
+
+        // the record of another version of the source file is ignored
+        copy_with_record((int64_t)mtime + 1);
+        ASSERT_EQ(content, copied_content());
+    }
+
     { // copy nfs_test_dir nfs_test_dir_copy
         ASSERT_FALSE(utils::filesystem::directory_exists("nfs_test_dir_copy"));
 
@@ -0,0 +1,140 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015 Microsoft Corporation
+ *
+ * -=- Robust Distributed System Nucleus (rDSN) -=-
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "../tools/hpc/timer_wheel.h"
+#include <gtest/gtest.h>
+#include <cstdlib>
+#include <vector>
+
+using namespace ::dsn::tools;
+
+struct wheel_item
+{
+    uint64_t expire_ms;
+    uint64_t fired_ms;
+};
+
+TEST(tools_hpc, timer_wheel)
+{
+    timer_wheel<wheel_item> w;
+    ASSERT_TRUE(w.empty());
+
+    const uint64_t start = 1000000007;
+    std::vector<wheel_item> items;
+    for (uint64_t d : {0, 1, 2, 255, 256, 257, 1000, 16383, 16384, 100000, 2000000, 70000000}) {
+        items.push_back(wheel_item{start + d, 0});
+    }
+    // an already expired item
+    items.push_back(wheel_item{start - 100, 0});
+
+    for (auto &it : items) {
+        w.add(&it, it.expire_ms, start);
+    }
+    ASSERT_EQ(items.size(), w.size());
+
+    // nothing fires before it expires, and everything fires when it expires
+    uint64_t now = start;
+    size_t fired = 0;
+    while (fired < items.size()) {
+        w.advance(now, [&](wheel_item *it) {
+            ASSERT_LE(it->expire_ms, now);
+            ASSERT_EQ(0u, it->fired_ms);
+            it->fired_ms = now;
+            fired++;
+        });
+        now += (now - start < 20000 ? 1 : 997);
+    }
+    ASSERT_TRUE(w.empty());
+
+    for (auto &it : items) {
+        if (it.expire_ms - start < 20000 || it.expire_ms < start)
+            ASSERT_EQ(std::max(it.expire_ms, start), it.fired_ms);
+        else
+            ASSERT_GT(it.fired_ms + 997, it.expire_ms);
+    }
+
+    // adding into an empty wheel after a long idle period
+    wheel_item late{now + 5000, 0};
+    w.add(&late, late.expire_ms, now);
+    w.advance(now + 4999, [&](wheel_item *it) { ASSERT_TRUE(false); });
+    w.advance(now + 5000, [&](wheel_item *it) { it->fired_ms = now + 5000; });
+    ASSERT_EQ(late.expire_ms, late.fired_ms);
+    ASSERT_TRUE(w.empty());
+}
+
+TEST(tools_hpc, timer_wheel_random)
+{
+    timer_wheel<wheel_item> w;
+    const uint64_t start = 12345678;
+    std::vector<wheel_item> items(100000);
+    for (auto &it : items) {
+        it.expire_ms = start + rand() % 100000;
+        it.fired_ms = 0;
+        w.add(&it, it.expire_ms, start);
+    }
+
+    for (uint64_t now = start; now <= start + 100000; now += 3) {
+        w.advance(now, [&](wheel_item *it) {
+            ASSERT_LE(it->expire_ms, now);
+            ASSERT_GT(it->expire_ms + 3, now);
+            it->fired_ms = now;
+        });
+    }
+    ASSERT_TRUE(w.empty());
+    for (auto &it : items) {
+        ASSERT_NE(0u, it.fired_ms);
+    }
+}
+
+TEST(tools_hpc, timer_wheel_next_expire)
+{
+    timer_wheel<wheel_item> w;
+    ASSERT_EQ(UINT64_MAX, w.next_expire_ms());
+
+    const uint64_t start = 7654321;
+    std::vector<wheel_item> items(10000);
+    for (auto &it : items) {
+        it.expire_ms = start + rand() % 1000000;
+        it.fired_ms = 0;
+        w.add(&it, it.expire_ms, start);
+    }
+
+    // jumping from one wakeup to the next fires every item on time
+    uint64_t now = start;
+    while (!w.empty()) {
+        w.advance(now, [&](wheel_item *it) {
+            ASSERT_EQ(it->expire_ms, now);
+            it->fired_ms = now;
+        });
+        uint64_t next = w.next_expire_ms();
+        ASSERT_GT(next, now);
+        now = next;
+    }
+    ASSERT_EQ(UINT64_MAX, w.next_expire_ms());
+    for (auto &it : items) {
+        ASSERT_EQ(it.expire_ms, it.fired_ms);
+    }
+}
@@ -106,3 +106,46 @@ TEST(core, transient_memory)
 
     tls_trans_mem_init(1024 * 1024); // restore
 }
+
+TEST(core, transient_memory_recycle)
+{
+    tls_trans_mem_init(4096);
+
+    tls_trans_mem_alloc(100);
+    char *first = tls_trans_memory.block->get();
+
+    // objects are 8-byte aligned and keep the block alive after it is retired
+    void *a = tls_trans_malloc(10);
+    void *b = tls_trans_malloc(13);
+    ASSERT_EQ(0u, (uintptr_t)a & 7);
+    ASSERT_EQ(0u, (uintptr_t)b & 7);
+    ASSERT_LE((char *)a + 10, (char *)b);
+    memset(a, 'a', 10);
+    memset(b, 'b', 13);
+
+    tls_trans_mem_alloc(100);
+    ASSERT_NE(first, tls_trans_memory.block->get());
+    ASSERT_EQ('a', ((char *)a)[9]);
+    ASSERT_EQ('b', ((char *)b)[12]);
+
+    // the first block is recycled once all its objects are freed, and reused next
+    tls_trans_free(a);
+    tls_trans_free(b);
+    tls_trans_mem_alloc(100);
+    ASSERT_EQ(first, tls_trans_memory.block->get());
+    ASSERT_EQ(4096u, tls_trans_memory.remain_bytes);
+
+    // blob holders also keep the block alive
+    blob bb = tls_trans_mem_alloc_blob(100);
+    ASSERT_EQ(first, bb.data());
+    tls_trans_mem_alloc(100);
+    ASSERT_NE(first, tls_trans_memory.block->get());
+
+    trans_mem_stats stats;
+    tls_trans_mem_get_stats(stats);
+    ASSERT_GE(stats.blocks_in_use, 2);
+    ASSERT_GE(stats.blocks_reused, 1);
+    ASSERT_GE(stats.wasted_bytes, 4096 - 100);
+
+    tls_trans_mem_init(1024 * 1024); // restore
+}
@@ -40,8 +40,11 @@
 #include <dsn/utility/link.h>
 #include <dsn/utility/crc.h>
 #include <dsn/utility/autoref_ptr.h>
+#include <dsn/utility/rcu_snapshot.h>
 #include <dsn/c/api_layer1.h>
 #include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
 
 using namespace ::dsn;
 using namespace ::dsn::utils;
@@ -69,6 +72,92 @@ TEST(core, crc)
     EXPECT_TRUE(c3 == c4);
 }
 
+TEST(core, crc_check_value)
+{
+    // the standard check values of crc-32c and of the crc-64 polynomial used here
+    const char *data = "123456789";
+    for (auto &impl : dsn::utils::crc32_impls()) {
+        EXPECT_EQ(0xe3069283u, impl.calc(data, 9, 0)) << impl.name;
+    }
+    for (auto &impl : dsn::utils::crc64_impls()) {
+        EXPECT_EQ(0xae8b14860a799888ull, impl.calc(data, 9, 0)) << impl.name;
+    }
+}
+
+TEST(core, crc_impls_equivalence)
+{
+    std::vector<char> buffer(100000);
+    for (auto &c : buffer) {
+        c = (char)dsn_random32(0, 255);
+    }
+
+    auto &impls32 = dsn::utils::crc32_impls();
+    auto &impls64 = dsn::utils::crc64_impls();
+    ASSERT_STREQ("table", impls32.front().name);
+    ASSERT_STREQ("table", impls64.front().name);
+
+    for (int i = 0; i < 2000; i++) {
+        // all the small sizes, then random sizes and alignments
+        size_t offset = dsn_random32(0, 15);
+        size_t size = i < 300 ? i : dsn_random32(0, (uint32_t)(buffer.size() - offset));
+        const char *ptr = buffer.data() + offset;
+
+        uint32_t init32 = dsn_random32(0, UINT32_MAX);
+        uint32_t ref32 = impls32.front().calc(ptr, size, init32);
+        for (auto &impl : impls32) {
+            ASSERT_EQ(ref32, impl.calc(ptr, size, init32)) << impl.name << ", size = " << size;
+        }
+        ASSERT_EQ(ref32, dsn::utils::crc32_calc(ptr, size, init32));
+
+        uint64_t init64 = dsn_random64(0, UINT64_MAX);
+        uint64_t ref64 = impls64.front().calc(ptr, size, init64);
+        for (auto &impl : impls64) {
+            ASSERT_EQ(ref64, impl.calc(ptr, size, init64)) << impl.name << ", size = " << size;
+        }
+        ASSERT_EQ(ref64, dsn::utils::crc64_calc(ptr, size, init64));
+    }
+}
+
+TEST(core, crc_concat)
+{
+    std::vector<char> buffer(10000);
+    for (auto &c : buffer) {
+        c = (char)dsn_random32(0, 255);
+    }
+
+    for (int i = 0; i < 200; i++) {
+        size_t size = dsn_random32(0, (uint32_t)buffer.size());
+        size_t x_size = dsn_random32(0, (uint32_t)size);
+        size_t y_size = size - x_size;
+        const char *x = buffer.data();
+        const char *y = buffer.data() + x_size;
+
+        // independent initial values
+        uint32_t xy_init = dsn_random32(0, UINT32_MAX);
+        uint32_t x_init = dsn_random32(0, UINT32_MAX);
+        uint32_t y_init = dsn_random32(0, UINT32_MAX);
+        uint32_t x_final = dsn::utils::crc32_calc(x, x_size, x_init);
+        uint32_t y_final = dsn::utils::crc32_calc(y, y_size, y_init);
+        EXPECT_EQ(dsn::utils::crc32_calc(x, size, xy_init),
+                  dsn::utils::crc32_concat(
+                      xy_init, x_init, x_final, x_size, y_init, y_final, y_size));
+
+        // chained
+        y_final = dsn::utils::crc32_calc(y, y_size, x_final);
+        EXPECT_EQ(dsn::utils::crc32_calc(x, size, x_init),
+                  dsn::utils::crc32_concat(
+                      x_init, x_init, x_final, x_size, x_final, y_final, y_size));
+
+        uint64_t x_init64 = dsn_random64(0, UINT64_MAX);
+        uint64_t y_init64 = dsn_random64(0, UINT64_MAX);
+        uint64_t x_final64 = dsn::utils::crc64_calc(x, x_size, x_init64);
+        uint64_t y_final64 = dsn::utils::crc64_calc(y, y_size, y_init64);
+        EXPECT_EQ(dsn::utils::crc64_calc(x, size, 0),
+                  dsn::utils::crc64_concat(
+                      0, x_init64, x_final64, x_size, y_init64, y_final64, y_size));
+    }
+}
+
 TEST(core, binary_io)
 {
     int value = 0xdeadbeef;
@@ -208,3 +297,58 @@ TEST(core, ref_ptr)
     z = std::move(foo_ptr());
     EXPECT_TRUE(count == 0);
 }
+
+TEST(core, rcu_snapshot)
+{
+    typedef std::map<int, int> int_map;
+    dsn::utils::rcu_snapshot<int_map> snapshot;
+    EXPECT_TRUE(snapshot.get()->empty());
+
+    // the old snapshot is released after publish if not held by any reader
+    std::shared_ptr<const int_map> v(new int_map{{1, 1}});
+    std::weak_ptr<const int_map> w = v;
+    snapshot.publish(std::move(v));
+    EXPECT_EQ(1, snapshot.read([](const int_map &m) { return m.at(1); }));
+    auto held = snapshot.get();
+    snapshot.publish(std::shared_ptr<const int_map>(new int_map{{1, 2}}));
+    EXPECT_FALSE(w.expired());
+    EXPECT_EQ(1, held->at(1));
+    held.reset();
+    EXPECT_TRUE(w.expired());
+
+    // readers always see a consistent snapshot: all the values equal to the version
+    std::atomic<bool> stopped(false);
+    std::atomic<int> errors(0);
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 4; i++) {
+        readers.emplace_back([&]() {
+            while (!stopped.load()) {
+                bool ok = snapshot.read([](const int_map &m) {
+                    for (auto &kv : m) {
+                        if (kv.second != m.begin()->second)
+                            return false;
+                    }
+                    return true;
+                });
+                if (!ok)
+                    errors++;
+                std::this_thread::yield();
+            }
+        });
+    }
+
+    for (int version = 0; version < 200; version++) {
+        std::shared_ptr<int_map> m(new int_map());
+        for (int k = 0; k < 16; k++) {
+            (*m)[k] = version;
+        }
+        snapshot.publish(std::move(m));
+    }
+
+    stopped.store(true);
+    for (auto &t : readers) {
+        t.join();
+    }
+    EXPECT_EQ(0, errors.load());
+    EXPECT_EQ(199, snapshot.read([](const int_map &m) { return m.at(15); }));
+}
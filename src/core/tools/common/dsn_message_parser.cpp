@@ -36,9 +36,318 @@
 #include "dsn_message_parser.h"
 #include <dsn/service_api_c.h>
 #include <dsn/utility/crc.h>
+#include <dsn/utility/utils.h>
 
 namespace dsn {
-void dsn_message_parser::reset() { _header_checked = false; }
+
+//
+// compact header layout:
+//   fixed prefix (COMPACT_HEADER_PREFIX_LENGTH bytes):
+//     hdr_type ("RDSC", 4) | hdr_length (2) | flags (1) | reserved (1) |
+//     body_length (4) | hdr_crc32 (4, computed with hdr_crc32 = CRC_INVALID)
+//   followed by:
+//     [body_crc32 (4)] | id | trace_id | rpc_code or rpc_name | context |
+//     gpid.app_id | gpid.partition_index | from_address |
+//     client.timeout_ms | client.thread_hash | client.partition_hash |
+//     [error_code or error_name (responses only)]
+//   all integers but crcs and ipv4 are varint-encoded, and signed ones are zigzag-encoded.
+//
+const uint32_t dsn_message_parser::COMPACT_HEADER_VERSION;
+const uint32_t dsn_message_parser::COMPACT_HEADER_PREFIX_LENGTH;
+const uint32_t dsn_message_parser::COMPACT_HEADER_MAX_LENGTH;
+const uint32_t dsn_message_parser::COMPACT_HEADER_MAX_BODY_LENGTH;
+
+enum compact_header_flag
+{
+    CHF_WITH_NAMES = 0x1,
+    CHF_BODY_CRC = 0x2
+};
+
+static inline char *write_varint(char *p, uint64_t v)
+{
+    while (v >= 0x80) {
+        *p++ = (char)(v | 0x80);
+        v >>= 7;
+    }
+    *p++ = (char)v;
+    return p;
+}
+
+static inline char *write_fixed32(char *p, uint32_t v)
+{
+    memcpy(p, &v, sizeof(v));
+    return p + sizeof(v);
+}
+
+static inline char *write_string(char *p, const char *str, size_t max_length)
+{
+    size_t len = strnlen(str, max_length);
+    p = write_varint(p, len);
+    memcpy(p, str, len);
+    return p + len;
+}
+
+static inline uint64_t zigzag_encode(int32_t v) { return (uint32_t)((v << 1) ^ (v >> 31)); }
+
+static inline int32_t zigzag_decode(uint64_t v)
+{
+    return (int32_t)((uint32_t)(v >> 1) ^ -(uint32_t)(v & 1));
+}
+
+class compact_header_reader
+{
+public:
+    compact_header_reader(const char *begin, const char *end) : _p(begin), _end(end), _ok(true)
+    {
+    }
+
+    bool ok() const { return _ok && _p == _end; }
+
+    uint64_t read_varint()
+    {
+        uint64_t v = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            if (_p >= _end)
+                break;
+            uint8_t b = (uint8_t)*_p++;
+            v |= (uint64_t)(b & 0x7f) << shift;
+            if ((b & 0x80) == 0)
+                return v;
+        }
+        _ok = false;
+        return 0;
+    }
+
+    uint32_t read_fixed32()
+    {
+        uint32_t v = 0;
+        if (_end - _p >= (ptrdiff_t)sizeof(v)) {
+            memcpy(&v, _p, sizeof(v));
+            _p += sizeof(v);
+        } else {
+            _ok = false;
+        }
+        return v;
+    }
+
+    void read_string(char *str, size_t capacity)
+    {
+        uint64_t len = read_varint();
+        if (_ok && len < capacity && (uint64_t)(_end - _p) >= len) {
+            memcpy(str, _p, len);
+            str[len] = '\0';
+            _p += len;
+        } else {
+            _ok = false;
+        }
+    }
+
+private:
+    const char *_p;
+    const char *_end;
+    bool _ok;
+};
+
+/*static*/ int
+dsn_message_parser::encode_compact_header(const message_header &hdr, bool with_names, char *buffer)
+{
+    dsn_address_t from = hdr.from_address.c_addr();
+    if (from.u.v4.type != HOST_TYPE_IPV4 && from.u.v4.type != HOST_TYPE_INVALID) {
+        // only ipv4 addresses are meaningful to the peer
+        return 0;
+    }
+
+    uint8_t flags = 0;
+    char *p = buffer + COMPACT_HEADER_PREFIX_LENGTH;
+    if (with_names)
+        flags |= CHF_WITH_NAMES;
+    if (hdr.body_crc32 != CRC_INVALID) {
+        flags |= CHF_BODY_CRC;
+        p = write_fixed32(p, hdr.body_crc32);
+    }
+
+    p = write_varint(p, hdr.id);
+    p = write_varint(p, hdr.trace_id);
+    if (with_names)
+        p = write_string(p, hdr.rpc_name, sizeof(hdr.rpc_name) - 1);
+    else
+        p = write_varint(p, hdr.rpc_code.local_code);
+    p = write_varint(p, hdr.context.context);
+    p = write_varint(p, (uint32_t)hdr.gpid.u.app_id);
+    p = write_varint(p, (uint32_t)hdr.gpid.u.partition_index);
+    p = write_varint(p, from.u.v4.type);
+    if (from.u.v4.type == HOST_TYPE_IPV4) {
+        p = write_fixed32(p, (uint32_t)from.u.v4.ip);
+        p = write_varint(p, from.u.v4.port);
+    }
+    p = write_varint(p, zigzag_encode(hdr.client.timeout_ms));
+    p = write_varint(p, zigzag_encode(hdr.client.thread_hash));
+    p = write_varint(p, hdr.client.partition_hash);
+    if (!hdr.context.u.is_request) {
+        if (with_names)
+            p = write_string(p, hdr.server.error_name, sizeof(hdr.server.error_name) - 1);
+        else
+            p = write_varint(p, hdr.server.error_code.local_code);
+    }
+
+    uint16_t hdr_length = (uint16_t)(p - buffer);
+    dassert(hdr_length <= COMPACT_HEADER_MAX_LENGTH, "compact header is too long");
+    memcpy(buffer, "RDSC", 4);
+    memcpy(buffer + 4, &hdr_length, sizeof(hdr_length));
+    buffer[6] = (char)flags;
+    buffer[7] = 0;
+    write_fixed32(buffer + 8, hdr.body_length);
+    write_fixed32(buffer + 12, CRC_INVALID);
+    return hdr_length;
+}
+
+/*static*/ bool
+dsn_message_parser::decode_compact_header(const char *buffer, int length, message_header &hdr)
+{
+    if (length < (int)COMPACT_HEADER_PREFIX_LENGTH || length > (int)COMPACT_HEADER_MAX_LENGTH ||
+        memcmp(buffer, "RDSC", 4) != 0)
+        return false;
+
+    uint32_t crc32;
+    memcpy(&crc32, buffer + 12, sizeof(crc32));
+    if (crc32 != CRC_INVALID) {
+        char copy[COMPACT_HEADER_MAX_LENGTH];
+        memcpy(copy, buffer, length);
+        write_fixed32(copy + 12, CRC_INVALID);
+        if (crc32 != dsn::utils::crc32_calc(copy, length, 0)) {
+            derror("dsn compact message header crc check failed");
+            return false;
+        }
+    }
+
+    uint8_t flags = (uint8_t)buffer[6];
+    memset(&hdr, 0, sizeof(hdr));
+    hdr.hdr_type = *(uint32_t *)"RDSN";
+    hdr.hdr_version = COMPACT_HEADER_VERSION;
+    hdr.hdr_length = sizeof(message_header);
+    hdr.hdr_crc32 = CRC_INVALID;
+    memcpy(&hdr.body_length, buffer + 8, sizeof(hdr.body_length));
+
+    compact_header_reader reader(buffer + COMPACT_HEADER_PREFIX_LENGTH, buffer + length);
+    hdr.body_crc32 = (flags & CHF_BODY_CRC) ? reader.read_fixed32() : CRC_INVALID;
+    hdr.id = reader.read_varint();
+    hdr.trace_id = reader.read_varint();
+    if (flags & CHF_WITH_NAMES) {
+        // local_hash is left 0 so that the code is resolved by name
+        reader.read_string(hdr.rpc_name, sizeof(hdr.rpc_name));
+    } else {
+        uint64_t code = reader.read_varint();
+        if (code > (uint64_t)task_code::max())
+            return false;
+        hdr.rpc_code.local_code = (uint32_t)code;
+        hdr.rpc_code.local_hash = message_ex::s_local_hash;
+        strncpy(hdr.rpc_name, task_code((int)code).to_string(), sizeof(hdr.rpc_name) - 1);
+    }
+    hdr.context.context = reader.read_varint();
+    hdr.gpid.u.app_id = (int32_t)reader.read_varint();
+    hdr.gpid.u.partition_index = (int32_t)reader.read_varint();
+    uint64_t addr_type = reader.read_varint();
+    if (addr_type == HOST_TYPE_IPV4) {
+        uint32_t ip = reader.read_fixed32();
+        uint16_t port = (uint16_t)reader.read_varint();
+        hdr.from_address = rpc_address(ip, port);
+    } else if (addr_type != HOST_TYPE_INVALID) {
+        return false;
+    }
+    hdr.client.timeout_ms = zigzag_decode(reader.read_varint());
+    hdr.client.thread_hash = zigzag_decode(reader.read_varint());
+    hdr.client.partition_hash = reader.read_varint();
+    if (!hdr.context.u.is_request) {
+        if (flags & CHF_WITH_NAMES) {
+            reader.read_string(hdr.server.error_name, sizeof(hdr.server.error_name));
+        } else {
+            uint64_t code = reader.read_varint();
+            if (code > (uint64_t)error_code::max())
+                return false;
+            hdr.server.error_code.local_code = (uint32_t)code;
+            hdr.server.error_code.local_hash = message_ex::s_local_hash;
+            strncpy(hdr.server.error_name,
+                    error_code((int)code).to_string(),
+                    sizeof(hdr.server.error_name) - 1);
+        }
+    }
+    return reader.ok();
+}
+
+void dsn_message_parser::reset()
+{
+    _header_checked = false;
+    _peer_compact = false;
+    _peer_hash = 0;
+}
+
+message_ex *dsn_message_parser::get_compact_message_on_receive(message_reader *reader,
+                                                               /*out*/ int &read_next)
+{
+    dsn::blob &buf = reader->_buffer;
+    const char *buf_ptr = buf.data();
+    unsigned int buf_len = reader->_buffer_occupied;
+
+    if (buf_len < COMPACT_HEADER_PREFIX_LENGTH) {
+        read_next = COMPACT_HEADER_PREFIX_LENGTH - buf_len;
+        return nullptr;
+    }
+
+    uint16_t hdr_length;
+    uint32_t body_length;
+    memcpy(&hdr_length, buf_ptr + 4, sizeof(hdr_length));
+    memcpy(&body_length, buf_ptr + 8, sizeof(body_length));
+    if (hdr_length < COMPACT_HEADER_PREFIX_LENGTH || hdr_length > COMPACT_HEADER_MAX_LENGTH ||
+        body_length > COMPACT_HEADER_MAX_BODY_LENGTH) {
+        derror("dsn compact message header check failed, hdr_length = %u, body_length = %u",
+               hdr_length,
+               body_length);
+        read_next = -1;
+        return nullptr;
+    }
+
+    unsigned int msg_sz = hdr_length + body_length;
+    if (buf_len < msg_sz) {
+        read_next = msg_sz - buf_len;
+        return nullptr;
+    }
+
+    // rebuild message_header ahead of the body, as expected by message_ex
+    unsigned int total_length = sizeof(message_header) + body_length;
+    std::shared_ptr<char> data(dsn::utils::make_shared_array<char>(total_length));
+    message_header *header = (message_header *)data.get();
+    if (!decode_compact_header(buf_ptr, hdr_length, *header)) {
+        derror("dsn compact message header check failed");
+        read_next = -1;
+        return nullptr;
+    }
+    memcpy(data.get() + sizeof(message_header), buf_ptr + hdr_length, body_length);
+
+    message_ex *msg = message_ex::create_receive_message(blob(data, total_length));
+    if (!is_right_body(msg)) {
+        derror("dsn message body check failed, id = %" PRIu64 ", trace_id = %016" PRIx64
+               ", rpc_name = %s, from_addr = %s",
+               header->id,
+               header->trace_id,
+               header->rpc_name,
+               header->from_address.to_string());
+        delete msg;
+        read_next = -1;
+        return nullptr;
+    }
+
+    _peer_compact = true;
+    if (header->rpc_code.local_hash != 0)
+        _peer_hash = header->rpc_code.local_hash;
+
+    reader->_buffer = buf.range(msg_sz);
+    reader->_buffer_occupied -= msg_sz;
+    read_next = (reader->_buffer_occupied >= COMPACT_HEADER_PREFIX_LENGTH
+                     ? 0
+                     : COMPACT_HEADER_PREFIX_LENGTH - reader->_buffer_occupied);
+    msg->hdr_format = NET_HDR_DSN;
+    return msg;
+}
 
 message_ex *dsn_message_parser::get_message_on_receive(message_reader *reader,
                                                        /*out*/ int &read_next)
@@ -49,6 +358,10 @@ message_ex *dsn_message_parser::get_message_on_receive(message_reader *reader,
     char *buf_ptr = (char *)buf.data();
     unsigned int buf_len = reader->_buffer_occupied;
 
+    if (buf_len >= sizeof(uint32_t) && memcmp(buf_ptr, "RDSC", 4) == 0) {
+        return get_compact_message_on_receive(reader, read_next);
+    }
+
     if (buf_len >= sizeof(message_header)) {
         if (!_header_checked) {
             if (!is_right_header(buf_ptr)) {
@@ -77,6 +390,11 @@ message_ex *dsn_message_parser::get_message_on_receive(message_reader *reader,
                 read_next = -1;
                 return nullptr;
             } else {
+                if (msg->header->hdr_version >= COMPACT_HEADER_VERSION) {
+                    _peer_hash = msg->header->rpc_code.local_hash;
+                    _peer_compact = true;
+                }
+
                 reader->_buffer = buf.range(msg_sz);
                 reader->_buffer_occupied -= msg_sz;
                 _header_checked = false;
@@ -109,12 +427,18 @@ void dsn_message_parser::prepare_on_send(message_ex *msg)
     for (int i = 0; i <= i_max; i++) {
         len += (size_t)buffers[i].length();
     }
-    dassert(len == (size_t)header->body_length + sizeof(message_header), "data length is wrong");
+    dassert(len + msg->file_seg.size == (size_t)header->body_length + sizeof(message_header),
+            "data length is wrong");
 #endif
 
-    if (task_spec::get(msg->local_rpc_code)->rpc_message_crc_required) {
-        // compute data crc if necessary (only once for the first time)
-        if (header->body_crc32 == CRC_INVALID) {
+    // announce that we understand the compact header
+    header->hdr_version = COMPACT_HEADER_VERSION;
+
+    bool crc_required = task_spec::get(msg->local_rpc_code)->rpc_message_crc_required;
+    if (crc_required) {
+        // compute data crc if necessary (only once for the first time),
+        // which is skipped when the body is partly sent from a file segment
+        if (header->body_crc32 == CRC_INVALID && msg->file_seg.size == 0) {
             int i_max = (int)buffers.size() - 1;
             uint32_t crc32 = 0;
             size_t len = 0;
@@ -145,16 +469,59 @@ void dsn_message_parser::prepare_on_send(message_ex *msg)
         header->hdr_crc32 = CRC_INVALID;
         header->hdr_crc32 = dsn::utils::crc32_calc(header, sizeof(message_header), 0);
     }
+
+    // only on sessions, as a udp parser is shared by all the peers. the header of a resent
+    // message may have been changed, so it is always rebuilt, while the old one is still kept
+    // by the session sending it until on_send_completed. it is built aside and assigned to
+    // the message once, instead of resetting it first and assigning it again later
+    blob compact_header;
+    if (msg->io_session != nullptr && _peer_compact &&
+        header->body_length <= COMPACT_HEADER_MAX_BODY_LENGTH) {
+        bool with_names =
+            (message_ex::s_local_hash == 0 || _peer_hash != message_ex::s_local_hash);
+        std::shared_ptr<char> buffer(
+            static_cast<char *>(dsn_transient_malloc(COMPACT_HEADER_MAX_LENGTH)),
+            [](char *c) { dsn_transient_free(c); });
+        int length = encode_compact_header(*header, with_names, buffer.get());
+        if (length > 0) {
+            if (crc_required) {
+                uint32_t crc32 = dsn::utils::crc32_calc(buffer.get(), length, 0);
+                write_fixed32(buffer.get() + 12, crc32);
+            }
+            compact_header.assign(std::move(buffer), 0, length);
+        }
+    }
+    msg->compact_header = std::move(compact_header);
 }
 
 int dsn_message_parser::get_buffer_count_on_send(message_ex *msg)
 {
-    return (int)msg->buffers.size();
+    return (int)msg->buffers.size() + (msg->compact_header.length() > 0 ? 1 : 0);
 }
 
 int dsn_message_parser::get_buffers_on_send(message_ex *msg, /*out*/ send_buf *buffers)
 {
     int i = 0;
+    if (msg->compact_header.length() > 0) {
+        // send the compact header instead of the message_header ahead of buffers[0]
+        buffers[i].buf = (void *)msg->compact_header.data();
+        buffers[i].sz = msg->compact_header.length();
+        ++i;
+
+        auto &first = msg->buffers[0];
+        if (first.length() > sizeof(message_header)) {
+            buffers[i].buf = (void *)(first.data() + sizeof(message_header));
+            buffers[i].sz = first.length() - sizeof(message_header);
+            ++i;
+        }
+        for (size_t j = 1; j < msg->buffers.size(); ++j) {
+            buffers[i].buf = (void *)msg->buffers[j].data();
+            buffers[i].sz = msg->buffers[j].length();
+            ++i;
+        }
+        return i;
+    }
+
     for (auto &buf : msg->buffers) {
         buffers[i].buf = (void *)buf.data();
         buffers[i].sz = buf.length();
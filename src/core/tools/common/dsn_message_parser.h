@@ -38,12 +38,37 @@
 #include <dsn/tool-api/message_parser.h>
 #include <dsn/tool-api/rpc_message.h>
 #include <dsn/utility/ports.h>
+#include <atomic>
 
 namespace dsn {
+
+//
+// besides the fixed-size message_header ("RDSN"), messages may be sent with a compact
+// header ("RDSC") whose fields are varint-encoded, and whose rpc/error codes are sent as
+// numbers only when the local_hash of both sides are the same (or as names otherwise).
+//
+// a peer announces that it understands the compact header by sending message_header with
+// hdr_version >= COMPACT_HEADER_VERSION, so compact headers are only sent on a session
+// after such a message (or a compact one) is received from the peer.
+//
 class dsn_message_parser : public message_parser
 {
 public:
-    dsn_message_parser() : _header_checked(false) {}
+    static const uint32_t COMPACT_HEADER_VERSION = 1;
+    static const uint32_t COMPACT_HEADER_PREFIX_LENGTH = 16;
+    static const uint32_t COMPACT_HEADER_MAX_LENGTH = 256;
+    // larger messages are sent with message_header, as the receiver has to copy
+    // the body to put the decoded header ahead of it
+    static const uint32_t COMPACT_HEADER_MAX_BODY_LENGTH = 16 * 1024;
+
+    // return the encoded length, which is at most COMPACT_HEADER_MAX_LENGTH
+    static int encode_compact_header(const message_header &hdr, bool with_names, char *buffer);
+
+    // return false if the compact header is corrupted
+    static bool decode_compact_header(const char *buffer, int length, message_header &hdr);
+
+public:
+    dsn_message_parser() : _header_checked(false), _peer_compact(false), _peer_hash(0) {}
     virtual ~dsn_message_parser() {}
 
     virtual void reset() override;
@@ -58,11 +83,17 @@ public:
     virtual int get_buffers_on_send(message_ex *msg, /*out*/ send_buf *buffers) override;
 
 private:
+    message_ex *get_compact_message_on_receive(message_reader *reader, /*out*/ int &read_next);
+
     static bool is_right_header(char *hdr);
 
     static bool is_right_body(message_ex *msg);
 
 private:
     bool _header_checked;
+
+    // what we know about the peer, updated on receive and used on send
+    std::atomic<bool> _peer_compact;
+    std::atomic<uint32_t> _peer_hash;
 };
 }
@@ -175,11 +175,26 @@ error_code native_linux_aio_provider::aio_internal(aio_task *aio_tsk,
                       aio->file_offset);
         break;
     case AIO_Write:
-        io_prep_pwrite(&aio->cb,
-                       static_cast<int>((ssize_t)aio->file),
-                       aio->buffer,
-                       aio->buffer_size,
-                       aio->file_offset);
+        if (!aio_tsk->_unmerged_write_buffers.empty()) {
+            aio->iovs.clear();
+            for (auto &buffer : aio_tsk->_unmerged_write_buffers) {
+                struct iovec iov;
+                iov.iov_base = buffer.buffer;
+                iov.iov_len = static_cast<size_t>(buffer.size);
+                aio->iovs.push_back(iov);
+            }
+            io_prep_pwritev(&aio->cb,
+                            static_cast<int>((ssize_t)aio->file),
+                            aio->iovs.data(),
+                            static_cast<int>(aio->iovs.size()),
+                            aio->file_offset);
+        } else {
+            io_prep_pwrite(&aio->cb,
+                           static_cast<int>((ssize_t)aio->file),
+                           aio->buffer,
+                           aio->buffer_size,
+                           aio->file_offset);
+        }
         break;
     default:
         derror("unknown aio type %u", static_cast<int>(aio->type));
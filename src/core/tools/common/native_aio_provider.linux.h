@@ -46,6 +46,7 @@
 #include <fcntl.h>    /* O_RDWR */
 #include <string.h>   /* memset() */
 #include <inttypes.h> /* uint64_t */
+#include <sys/uio.h>  /* struct iovec */
 
 namespace dsn {
 namespace tools {
@@ -61,12 +62,14 @@ public:
     virtual error_code flush(dsn_handle_t fh) override;
     virtual void aio(aio_task *aio) override;
     virtual disk_aio *prepare_aio_context(aio_task *tsk) override;
+    virtual bool support_write_vec() const override { return true; }
 
     virtual void start(io_modifer &ctx) override;
 
     struct linux_disk_aio_context : public disk_aio
     {
         struct iocb cb;
+        std::vector<struct iovec> iovs; // for vectored write
         aio_task *tsk;
         native_linux_aio_provider *this_;
         utils::notify_event *evt;
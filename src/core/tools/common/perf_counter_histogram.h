@@ -0,0 +1,109 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015 Microsoft Corporation
+ *
+ * -=- Robust Distributed System Nucleus (rDSN) -=-
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * Description:
+ *     histogram perf counter shared by all the perf counter providers
+ *
+ * Revision history:
+ *     xxxx-xx-xx, author, first version
+ *     xxxx-xx-xx, author, fix bug about xxx
+ */
+
+#pragma once
+
+#include <dsn/tool_api.h>
+#include <dsn/utility/histogram.h>
+
+namespace dsn {
+namespace tools {
+
+// -----------   HISTOGRAM perf counter ---------------------------------
+// unlike NUMBER_PERCENTILES, all the values set are counted rather than the latest samples,
+// and the percentiles are computed from the buckets on read instead of by a timer. The
+// counter is cumulative, i.e., the percentiles read cover all the values set since it is
+// created (see histogram::merge_and_reset() for reading a window instead)
+class perf_counter_histogram : public perf_counter
+{
+public:
+    perf_counter_histogram(const char *app,
+                           const char *section,
+                           const char *name,
+                           dsn_perf_counter_type_t type,
+                           const char *dsptr)
+        : perf_counter(app, section, name, type, dsptr), _latest_sample(0)
+    {
+    }
+    ~perf_counter_histogram(void) {}
+
+    virtual void increment() { dassert(false, "invalid execution flow"); }
+    virtual void decrement() { dassert(false, "invalid execution flow"); }
+    virtual void add(uint64_t val) { dassert(false, "invalid execution flow"); }
+    virtual void set(uint64_t val)
+    {
+        _histogram.record(val);
+        _latest_sample.store(val, std::memory_order_relaxed);
+    }
+
+    // the mean of all the values set
+    virtual double get_value()
+    {
+        histogram_snapshot snapshot;
+        _histogram.merge_to(snapshot);
+        return snapshot.mean();
+    }
+    virtual uint64_t get_integer_value() { return (uint64_t)get_value(); }
+
+    virtual double get_percentile(dsn_perf_counter_percentile_type_t type)
+    {
+        static const double percents[COUNTER_PERCENTILE_COUNT] = {50, 90, 95, 99, 99.9};
+        if ((type < 0) || (type >= COUNTER_PERCENTILE_COUNT)) {
+            dassert(false, "send a wrong counter percentile type");
+            return 0.0;
+        }
+
+        histogram_snapshot snapshot;
+        _histogram.merge_to(snapshot);
+        return (double)snapshot.percentile(percents[type]);
+    }
+
+    virtual uint64_t get_latest_sample() const override
+    {
+        return _latest_sample.load(std::memory_order_relaxed);
+    }
+
+    virtual bool get_histogram(/*out*/ histogram_snapshot &snapshot) const override
+    {
+        _histogram.merge_to(snapshot);
+        return true;
+    }
+
+private:
+    histogram _histogram;
+    std::atomic<uint64_t> _latest_sample;
+};
+}
+}
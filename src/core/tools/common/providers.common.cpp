@@ -70,7 +70,7 @@ void register_common_providers()
     register_component_provider<simple_task_queue>("dsn::tools::simple_task_queue");
     register_component_provider<simple_timer_service>("dsn::tools::simple_timer_service");
 
-    register_message_header_parser<dsn_message_parser>(NET_HDR_DSN, {"RDSN"});
+    register_message_header_parser<dsn_message_parser>(NET_HDR_DSN, {"RDSN", "RDSC"});
     register_message_header_parser<thrift_message_parser>(NET_HDR_THRIFT, {"THFT"});
     register_message_header_parser<http_message_parser>(NET_HDR_HTTP,
                                                         {"GET ", "POST", "OPTI", "HTTP"});
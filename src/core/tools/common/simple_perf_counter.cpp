@@ -42,6 +42,7 @@
  */
 
 #include "simple_perf_counter.h"
+#include "perf_counter_histogram.h"
 #include "shared_io_service.h"
 
 namespace dsn {
@@ -419,6 +420,8 @@ perf_counter *simple_perf_counter_factory(const char *app,
         return new perf_counter_rate(app, section, name, type, dsptr);
     else if (type == dsn_perf_counter_type_t::COUNTER_TYPE_NUMBER_PERCENTILES)
         return new perf_counter_number_percentile(app, section, name, type, dsptr);
+    else if (type == dsn_perf_counter_type_t::COUNTER_TYPE_HISTOGRAM)
+        return new perf_counter_histogram(app, section, name, type, dsptr);
     else {
         dassert(false, "invalid type(%d)", type);
         return nullptr;
@@ -38,6 +38,7 @@
  */
 
 #include "simple_perf_counter_v2_atomic.h"
+#include "perf_counter_histogram.h"
 #include "shared_io_service.h"
 
 namespace dsn {
@@ -483,6 +484,8 @@ perf_counter *simple_perf_counter_v2_atomic_factory(const char *app,
         return new perf_counter_rate_v2_atomic(app, section, name, type, dsptr);
     else if (type == dsn_perf_counter_type_t::COUNTER_TYPE_NUMBER_PERCENTILES)
         return new perf_counter_number_percentile_v2_atomic(app, section, name, type, dsptr);
+    else if (type == dsn_perf_counter_type_t::COUNTER_TYPE_HISTOGRAM)
+        return new perf_counter_histogram(app, section, name, type, dsptr);
     else {
         dassert(false, "invalid type(%d)", type);
         return nullptr;
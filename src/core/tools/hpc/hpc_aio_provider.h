@@ -60,6 +60,9 @@ public:
     virtual error_code flush(dsn_handle_t fh) override;
     virtual void aio(aio_task *aio) override;
     virtual disk_aio *prepare_aio_context(aio_task *tsk) override;
+#ifdef __linux__
+    virtual bool support_write_vec() const override { return true; }
+#endif
 
     virtual void start(io_modifer &ctx) override;
 
@@ -71,10 +74,32 @@ private:
     io_loop_callback _callback;
 
 #ifdef __linux__
+    // an io context with its own queue depth, files under dir are bound to it
+    struct aio_context
+    {
+        std::string dir; // empty for the default context
+        int queue_depth;
+        io_context_t ctx;
+        int event_fd;
+        io_loop_callback callback;
+
+        ::dsn::utils::ex_lock_nr_spin lock;
+        std::vector<struct iocb *> pending; // waiting for io_submit
+        int inflight;                       // submitted but not reaped yet
+        bool is_submitting;
+    };
+
+    aio_context *create_context(const std::string &dir, int queue_depth);
+    aio_context *get_context(int fd);
+    void submit(aio_context *ctx, struct iocb *io);
+    void submit_pending(aio_context *ctx);
+    void harvest(aio_context *ctx);
     void complete_aio(struct iocb *io, int bytes, int err);
 
-    io_context_t _ctx;
-    int _event_fd;
+    std::vector<aio_context *> _contexts; // _contexts[0] is the default context
+    ::dsn::utils::ex_lock_nr_spin _fd_contexts_lock;
+    std::unordered_map<int, aio_context *> _fd_contexts; // fd => non-default context
+    int _max_batch_size;                                 // for io_submit and io_getevents
 #elif defined(__APPLE__) || defined(__FreeBSD__)
     void complete_aio(struct aiocb *io, int bytes, int err);
 #endif
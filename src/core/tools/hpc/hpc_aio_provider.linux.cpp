@@ -42,8 +42,11 @@
 #include <sys/stat.h>
 #include <aio.h>
 #include <sys/eventfd.h>
+#include <sys/uio.h>
 #include <stdio.h>
 #include "mix_all_io_looper.h"
+#include <dsn/utility/filesystem.h>
+#include <dsn/utility/strings.h>
 
 namespace dsn {
 namespace tools {
@@ -51,6 +54,7 @@ namespace tools {
 struct linux_disk_aio_context : public disk_aio
 {
     struct iocb cb;
+    std::vector<struct iovec> iovs; // for vectored write
     aio_task *tsk;
     hpc_aio_provider *this_;
     utils::notify_event *evt;
@@ -61,10 +65,69 @@ struct linux_disk_aio_context : public disk_aio
 hpc_aio_provider::hpc_aio_provider(disk_engine *disk, aio_provider *inner_provider)
     : aio_provider(disk, inner_provider)
 {
-    _callback = [this](int native_error, uint32_t io_size, uintptr_t lolp_or_events) {
+    _looper = nullptr;
+
+    int queue_depth =
+        (int)dsn_config_get_value_uint64("tools.hpc_aio_provider",
+                                         "queue_depth",
+                                         128,
+                                         "max number of concurrent aio requests (io_setup)");
+    _max_batch_size =
+        (int)dsn_config_get_value_uint64("tools.hpc_aio_provider",
+                                         "max_batch_size",
+                                         32,
+                                         "max number of requests submitted or reaped per syscall");
+    dassert(queue_depth > 0 && _max_batch_size > 0,
+            "invalid queue_depth %d or max_batch_size %d",
+            queue_depth,
+            _max_batch_size);
+
+    _contexts.push_back(create_context("", queue_depth));
+
+    // e.g., /home/work/ssd1:256,/home/work/ssd2:64
+    const char *dir_depths = dsn_config_get_value_string(
+        "tools.hpc_aio_provider",
+        "data_dir_queue_depths",
+        "",
+        "per data directory queue depths, in the format of 'dir1:depth1,dir2:depth2', "
+        "files under these dirs use separate io contexts");
+    std::vector<std::string> items;
+    utils::split_args(dir_depths, items, ',');
+    for (auto &item : items) {
+        auto pos = item.find_last_of(':');
+        dassert(pos != std::string::npos && pos > 0,
+                "invalid data_dir_queue_depths item '%s'",
+                item.c_str());
+
+        std::string dir;
+        bool ok = utils::filesystem::get_absolute_path(item.substr(0, pos), dir);
+        dassert(ok, "invalid data dir '%s'", item.c_str());
+        int depth = atoi(item.substr(pos + 1).c_str());
+        dassert(depth > 0, "invalid queue depth in '%s'", item.c_str());
+
+        _contexts.push_back(create_context(dir, depth));
+    }
+}
+
+hpc_aio_provider::aio_context *hpc_aio_provider::create_context(const std::string &dir,
+                                                                 int queue_depth)
+{
+    auto c = new aio_context();
+    c->dir = dir;
+    c->queue_depth = queue_depth;
+    c->inflight = 0;
+    c->is_submitting = false;
+    c->pending.reserve(queue_depth);
+
+    memset(&c->ctx, 0, sizeof(c->ctx));
+    auto ret = io_setup(queue_depth, &c->ctx);
+    dassert(ret == 0, "io_setup error, err = %s", strerror(-ret));
+
+    c->event_fd = eventfd(0, EFD_NONBLOCK);
+    c->callback = [this, c](int native_error, uint32_t io_size, uintptr_t lolp_or_events) {
         int64_t finished_aio = 0;
 
-        if (read(_event_fd, &finished_aio, sizeof(finished_aio)) != sizeof(finished_aio)) {
+        if (read(c->event_fd, &finished_aio, sizeof(finished_aio)) != sizeof(finished_aio)) {
             if (errno == EAGAIN || errno == EWOULDBLOCK)
                 return;
 
@@ -73,53 +136,70 @@ hpc_aio_provider::hpc_aio_provider(disk_engine *disk, aio_provider *inner_provid
                     strerror(errno));
         }
 
-        struct io_event events[1];
-        int ret;
-
-        while (finished_aio-- > 0) {
-            struct timespec tms;
-            tms.tv_sec = 0;
-            tms.tv_nsec = 0;
-
-            ret = io_getevents(_ctx, 1, 1, events, &tms);
-            dassert(ret == 1,
-                    "aio must return 1 event as we already got "
-                    "notification from eventfd");
-
-            struct iocb *io = events[0].obj;
-            complete_aio(io, static_cast<int>(events[0].res), static_cast<int>(events[0].res2));
-        }
+        harvest(c);
     };
-
-    memset(&_ctx, 0, sizeof(_ctx));
-    auto ret = io_setup(128, &_ctx); // 128 concurrent events
-    dassert(ret == 0, "io_setup error, err = %s", strerror(-ret));
-
-    _event_fd = eventfd(0, EFD_NONBLOCK);
-    _looper = nullptr;
+    return c;
 }
 
 void hpc_aio_provider::start(io_modifer &ctx)
 {
     _looper = get_io_looper(node(), ctx.queue, ctx.mode);
-    _looper->bind_io_handle((dsn_handle_t)(intptr_t)_event_fd, &_callback, EPOLLIN | EPOLLET);
+    for (auto c : _contexts) {
+        _looper->bind_io_handle(
+            (dsn_handle_t)(intptr_t)c->event_fd, &c->callback, EPOLLIN | EPOLLET);
+    }
 }
 
 hpc_aio_provider::~hpc_aio_provider()
 {
-    auto ret = io_destroy(_ctx);
-    dassert(ret == 0, "io_destroy error, err = %s", strerror(-ret));
+    for (auto c : _contexts) {
+        auto ret = io_destroy(c->ctx);
+        dassert(ret == 0, "io_destroy error, err = %s", strerror(-ret));
+
+        ::close(c->event_fd);
+        delete c;
+    }
+    _contexts.clear();
+}
 
-    ::close(_event_fd);
+hpc_aio_provider::aio_context *hpc_aio_provider::get_context(int fd)
+{
+    if (_contexts.size() > 1) {
+        utils::auto_lock<utils::ex_lock_nr_spin> l(_fd_contexts_lock);
+        auto it = _fd_contexts.find(fd);
+        if (it != _fd_contexts.end())
+            return it->second;
+    }
+    return _contexts[0];
 }
 
 dsn_handle_t hpc_aio_provider::open(const char *file_name, int oflag, int pmode)
 {
-    return (dsn_handle_t)(uintptr_t)::open(file_name, oflag, pmode);
+    int fd = ::open(file_name, oflag, pmode);
+    if (fd != -1 && _contexts.size() > 1) {
+        std::string path;
+        if (utils::filesystem::get_absolute_path(file_name, path)) {
+            for (size_t i = 1; i < _contexts.size(); i++) {
+                auto &dir = _contexts[i]->dir;
+                if (path.compare(0, dir.length(), dir) == 0 &&
+                    (path.length() == dir.length() || path[dir.length()] == '/')) {
+                    utils::auto_lock<utils::ex_lock_nr_spin> l(_fd_contexts_lock);
+                    _fd_contexts[fd] = _contexts[i];
+                    break;
+                }
+            }
+        }
+    }
+    return (dsn_handle_t)(uintptr_t)fd;
 }
 
 error_code hpc_aio_provider::close(dsn_handle_t fh)
 {
+    if (fh != DSN_INVALID_FILE_HANDLE && _contexts.size() > 1) {
+        utils::auto_lock<utils::ex_lock_nr_spin> l(_fd_contexts_lock);
+        _fd_contexts.erase((int)(uintptr_t)(fh));
+    }
+
     if (fh == DSN_INVALID_FILE_HANDLE || ::close((int)(uintptr_t)(fh)) == 0) {
         return ERR_OK;
     } else {
@@ -153,9 +233,7 @@ error_code hpc_aio_provider::aio_internal(aio_task *aio_tsk,
                                           bool async,
                                           /*out*/ uint32_t *pbytes /*= nullptr*/)
 {
-    struct iocb *cbs[1];
     linux_disk_aio_context *aio;
-    int ret;
 
     aio = (linux_disk_aio_context *)aio_tsk->aio();
 
@@ -172,11 +250,26 @@ error_code hpc_aio_provider::aio_internal(aio_task *aio_tsk,
                       aio->file_offset);
         break;
     case AIO_Write:
-        io_prep_pwrite(&aio->cb,
-                       static_cast<int>((ssize_t)aio->file),
-                       aio->buffer,
-                       aio->buffer_size,
-                       aio->file_offset);
+        if (!aio_tsk->_unmerged_write_buffers.empty()) {
+            aio->iovs.clear();
+            for (auto &buffer : aio_tsk->_unmerged_write_buffers) {
+                struct iovec iov;
+                iov.iov_base = buffer.buffer;
+                iov.iov_len = static_cast<size_t>(buffer.size);
+                aio->iovs.push_back(iov);
+            }
+            io_prep_pwritev(&aio->cb,
+                            static_cast<int>((ssize_t)aio->file),
+                            aio->iovs.data(),
+                            static_cast<int>(aio->iovs.size()),
+                            aio->file_offset);
+        } else {
+            io_prep_pwrite(&aio->cb,
+                           static_cast<int>((ssize_t)aio->file),
+                           aio->buffer,
+                           aio->buffer_size,
+                           aio->file_offset);
+        }
         break;
     default:
         derror("unknown aio type %u", static_cast<int>(aio->type));
@@ -188,36 +281,136 @@ error_code hpc_aio_provider::aio_internal(aio_task *aio_tsk,
         aio->bytes = 0;
     }
 
-    cbs[0] = &aio->cb;
+    auto ctx = get_context(static_cast<int>((ssize_t)aio->file));
+    io_set_eventfd(&aio->cb, ctx->event_fd);
+
+    // the request is queued when the io context is full, and submitted
+    // later together with the other queued ones when there are free slots,
+    // submission failures are reported via complete_aio
+    submit(ctx, &aio->cb);
+
+    if (async) {
+        return ERR_IO_PENDING;
+    } else {
+        aio->evt->wait();
+        delete aio->evt;
+        aio->evt = nullptr;
+        if (pbytes != nullptr) {
+            *pbytes = aio->bytes;
+        }
+        return aio->err;
+    }
+}
+
+void hpc_aio_provider::submit(aio_context *ctx, struct iocb *io)
+{
+    {
+        utils::auto_lock<utils::ex_lock_nr_spin> l(ctx->lock);
+        ctx->pending.push_back(io);
+
+        // the current submitter will take this one
+        if (ctx->is_submitting)
+            return;
+        ctx->is_submitting = true;
+    }
 
-    io_set_eventfd(&aio->cb, _event_fd);
-    ret = io_submit(_ctx, 1, cbs);
+    submit_pending(ctx);
+}
 
-    if (ret != 1) {
-        if (ret < 0)
-            derror("io_submit error, err = %s", strerror(-ret));
-        else
-            derror("could not sumbit IOs, err = %s", strerror(-ret));
+// must be called with ctx->is_submitting set by the caller
+void hpc_aio_provider::submit_pending(aio_context *ctx)
+{
+    std::vector<struct iocb *> batch;
+    batch.reserve(_max_batch_size);
+
+    while (true) {
+        batch.clear();
+        {
+            utils::auto_lock<utils::ex_lock_nr_spin> l(ctx->lock);
+            int count = std::min(static_cast<int>(ctx->pending.size()),
+                                 std::min(ctx->queue_depth - ctx->inflight, _max_batch_size));
+            if (count <= 0) {
+                // nothing to submit, or the io context is full and harvest()
+                // will continue the submission when some requests complete
+                ctx->is_submitting = false;
+                return;
+            }
 
-        if (async) {
-            complete_io(aio_tsk, ERR_FILE_OPERATION_FAILED, 0);
-        } else {
-            delete aio->evt;
-            aio->evt = nullptr;
+            batch.assign(ctx->pending.begin(), ctx->pending.begin() + count);
+            ctx->pending.erase(ctx->pending.begin(), ctx->pending.begin() + count);
+            ctx->inflight += count;
         }
-        return ERR_FILE_OPERATION_FAILED;
-    } else {
-        if (async) {
-            return ERR_IO_PENDING;
-        } else {
-            aio->evt->wait();
-            delete aio->evt;
-            aio->evt = nullptr;
-            if (pbytes != nullptr) {
-                *pbytes = aio->bytes;
+
+        int count = static_cast<int>(batch.size());
+        int ret = io_submit(ctx->ctx, count, batch.data());
+        if (ret == count)
+            continue;
+
+        int submitted = ret > 0 ? ret : 0;
+        int err = ret < 0 ? -ret : EAGAIN;
+        {
+            utils::auto_lock<utils::ex_lock_nr_spin> l(ctx->lock);
+            ctx->inflight -= (count - submitted);
+
+            // partially accepted, retry the rest when some requests complete,
+            // or right now if they are all completed already
+            if (err == EAGAIN && (ctx->inflight > 0 || submitted > 0)) {
+                ctx->pending.insert(ctx->pending.begin(), batch.begin() + submitted, batch.end());
+                if (ctx->inflight > 0) {
+                    ctx->is_submitting = false;
+                    return;
+                }
+                continue;
             }
-            return aio->err;
         }
+
+        derror("io_submit error, err = %s", strerror(err));
+        for (int i = submitted; i < count; i++) {
+            complete_aio(batch[i], 0, err);
+        }
+    }
+}
+
+void hpc_aio_provider::harvest(aio_context *ctx)
+{
+    std::unique_ptr<struct io_event[]> events(new struct io_event[_max_batch_size]);
+    struct timespec tms;
+    tms.tv_sec = 0;
+    tms.tv_nsec = 0;
+
+    // reap all the completed events, many per syscall
+    while (true) {
+        int ret = io_getevents(ctx->ctx, 1, _max_batch_size, events.get(), &tms);
+        if (ret == -EINTR) {
+            // the eventfd count is already consumed, so the events must be reaped here
+            continue;
+        }
+        if (ret <= 0) {
+            dassert(ret == 0, "io_getevents error, err = %s", strerror(-ret));
+            break;
+        }
+
+        bool resubmit = false;
+        {
+            utils::auto_lock<utils::ex_lock_nr_spin> l(ctx->lock);
+            ctx->inflight -= ret;
+            if (!ctx->pending.empty() && !ctx->is_submitting) {
+                ctx->is_submitting = true;
+                resubmit = true;
+            }
+        }
+
+        for (int i = 0; i < ret; i++) {
+            struct iocb *io = events[i].obj;
+            complete_aio(io, static_cast<int>(events[i].res), static_cast<int>(events[i].res2));
+        }
+
+        if (resubmit) {
+            submit_pending(ctx);
+        }
+
+        if (ret < _max_batch_size)
+            break;
     }
 }
 
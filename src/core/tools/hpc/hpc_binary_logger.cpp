@@ -0,0 +1,1104 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015 Microsoft Corporation
+ *
+ * -=- Robust Distributed System Nucleus (rDSN) -=-
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * Description:
+ *     hpc_binary_logger, see hpc_binary_logger.h.
+ *
+ *     Ring layout: records are appended at head and consumed at tail, both
+ *     are monotonic byte offsets. A record never wraps around the end of the
+ *     ring; when the remaining space is not enough, a zero-sized marker is
+ *     written and the record starts at the beginning of the ring.
+ *
+ *     Binary file layout: an 8-byte magic followed by records, each of which
+ *     starts with its 8-byte aligned size. A dictionary record (which carries
+ *     a format string or a node/pool name) is written into the file before
+ *     the first log record that refers to it.
+ *
+ * Revision history:
+ *     xxxx-xx-xx, author, first version
+ *     xxxx-xx-xx, author, fix bug about xxx
+ */
+
+#include "hpc_binary_logger.h"
+#include <dsn/utility/utils.h>
+#include <dsn/utility/filesystem.h>
+#include <cstdlib>
+#include <cstring>
+#include <cinttypes>
+#include <algorithm>
+#include <sstream>
+#include <iostream>
+
+#define MAX_FILE_SIZE 30 * 1024 * 1024
+namespace dsn {
+namespace tools {
+
+static const uint32_t MAX_RECORD_BYTES = 4096;
+static const uint32_t MAX_FORMAT_COUNT = 64 * 1024;
+static const uint32_t FORMAT_CACHE_SIZE = 256;
+static const uint32_t OUT_BUFFER_BYTES = 256 * 1024;
+static const uint32_t DICTIONARY_MARKER = 0xffffffff;
+static const char s_binary_magic[8] = {'D', 'S', 'N', 'B', 'L', 'O', 'G', '1'};
+
+enum arg_kind
+{
+    ARG_NONE, // literal text
+    ARG_INT,
+    ARG_LONG,
+    ARG_LLONG,
+    ARG_SIZE,
+    ARG_INTMAX,
+    ARG_PTRDIFF,
+    ARG_DOUBLE,
+    ARG_POINTER,
+    ARG_STRING
+};
+
+static const int PRECISION_NONE = -1;
+static const int PRECISION_STAR = -2;
+
+struct format_segment
+{
+    std::string text; // literal text, or the conversion spec such as "%08" PRIx64
+    arg_kind kind;
+    int star_count; // '*' width and precision, each of which consumes an int
+    int precision;  // for "%.Ns", so that non-terminated strings are not over-read
+};
+
+struct hpc_binary_logger::format_info
+{
+    std::string fmt;
+    std::vector<format_segment> segments;
+    bool valid; // false when the format can only be handled by vsnprintf
+};
+
+struct log_record_header
+{
+    uint32_t size;   // aligned to 8 bytes, 0 for the wrap marker in the ring
+    uint32_t fmt_id; // 0 if the message is formatted on the logging thread
+    uint64_t ts;
+    uint64_t task_id;
+    int32_t tid;
+    uint32_t node_id;
+    uint32_t pool_id; // 0 if not logged in a worker thread
+    uint32_t payload_size;
+    int16_t worker_index;
+    uint8_t level;
+    uint8_t reserved[5];
+};
+static_assert(sizeof(log_record_header) == 48, "log_record_header must be packed");
+
+struct dictionary_record_header
+{
+    uint32_t size;
+    uint32_t marker; // DICTIONARY_MARKER, at the offset of log_record_header::fmt_id
+    uint32_t id;
+    uint32_t length;
+};
+
+struct hpc_binary_logger::log_ring
+{
+    char *buffer;
+    uint32_t capacity;
+    int tid;
+    char padding0[64];
+    std::atomic<uint64_t> head; // only advanced by the owner thread
+    char padding1[64];
+    std::atomic<uint64_t> tail; // only advanced by the daemon thread
+    char padding2[64];
+    std::atomic<uint64_t> dropped;
+    uint64_t reported_dropped;
+    std::atomic<bool> orphaned; // the owner thread does not write any more
+
+    log_ring(uint32_t cap, int t)
+        : capacity(cap),
+          tid(t),
+          head(0),
+          tail(0),
+          dropped(0),
+          reported_dropped(0),
+          orphaned(false)
+    {
+        buffer = (char *)malloc(capacity);
+    }
+    ~log_ring() { free(buffer); }
+
+    bool try_write(const char *record, uint32_t size)
+    {
+        uint64_t h = head.load(std::memory_order_relaxed);
+        uint64_t t = tail.load(std::memory_order_acquire);
+        uint32_t offset = static_cast<uint32_t>(h % capacity);
+        uint32_t pad = (capacity - offset < size) ? capacity - offset : 0;
+        if (h + pad + size - t > capacity)
+            return false;
+
+        if (pad != 0) {
+            // sizes are 8-byte aligned, so there is always room for the marker
+            memset(buffer + offset, 0, sizeof(uint32_t));
+            h += pad;
+            offset = 0;
+        }
+        memcpy(buffer + offset, record, size);
+        head.store(h + size, std::memory_order_release);
+        return true;
+    }
+};
+
+struct hpc_binary_logger::tls_context
+{
+    uint64_t instance_id;
+    int tid;
+    std::shared_ptr<log_ring> ring;
+    const char *cache_keys[FORMAT_CACHE_SIZE];
+    uint32_t cache_ids[FORMAT_CACHE_SIZE];
+    char scratch[MAX_RECORD_BYTES];
+
+    // the ring is left to the logger to drain and retire
+    void release_ring()
+    {
+        if (ring != nullptr) {
+            ring->orphaned.store(true, std::memory_order_release);
+            ring = nullptr;
+        }
+    }
+};
+
+static __thread hpc_binary_logger::tls_context *s_tls_context;
+
+// frees the tls context when the thread exits, s_tls_context is kept as __thread for
+// the fast path of logging
+struct tls_context_holder
+{
+    hpc_binary_logger::tls_context *ctx = nullptr;
+    ~tls_context_holder()
+    {
+        if (ctx != nullptr) {
+            ctx->release_ring();
+            delete ctx;
+            s_tls_context = nullptr;
+        }
+    }
+};
+static thread_local tls_context_holder s_tls_context_holder;
+static std::atomic<uint64_t> s_next_instance_id(1);
+
+static inline uint32_t align8(uint32_t size) { return (size + 7) & ~7u; }
+
+// split a printf format into literal text and conversions, return false for
+// the conversions which are not supported (e.g., %n, %ls, %Lf)
+static bool parse_format(const char *fmt, std::vector<format_segment> &segments)
+{
+    std::string literal;
+    const char *p = fmt;
+    while (*p) {
+        if (*p != '%') {
+            literal.push_back(*p++);
+            continue;
+        }
+        if (p[1] == '%') {
+            literal.push_back('%');
+            p += 2;
+            continue;
+        }
+        if (!literal.empty()) {
+            segments.push_back({literal, ARG_NONE, 0, PRECISION_NONE});
+            literal.clear();
+        }
+
+        const char *start = p++;
+        int stars = 0;
+        int precision = PRECISION_NONE;
+        while (*p && strchr("-+ #0'", *p))
+            ++p;
+        if (*p == '*') {
+            ++stars;
+            ++p;
+        } else {
+            while (isdigit(*p))
+                ++p;
+        }
+        if (*p == '.') {
+            ++p;
+            if (*p == '*') {
+                ++stars;
+                ++p;
+                precision = PRECISION_STAR;
+            } else {
+                precision = 0;
+                while (isdigit(*p))
+                    precision = precision * 10 + (*p++ - '0');
+            }
+        }
+
+        arg_kind int_kind = ARG_INT;
+        bool long_double = false;
+        bool wide = false;
+        if (p[0] == 'h') {
+            p += (p[1] == 'h') ? 2 : 1;
+        } else if (p[0] == 'l' && p[1] == 'l') {
+            int_kind = ARG_LLONG;
+            p += 2;
+        } else if (p[0] == 'l') {
+            int_kind = ARG_LONG;
+            wide = true;
+            ++p;
+        } else if (p[0] == 'q') {
+            int_kind = ARG_LLONG;
+            ++p;
+        } else if (p[0] == 'j') {
+            int_kind = ARG_INTMAX;
+            ++p;
+        } else if (p[0] == 'z') {
+            int_kind = ARG_SIZE;
+            ++p;
+        } else if (p[0] == 't') {
+            int_kind = ARG_PTRDIFF;
+            ++p;
+        } else if (p[0] == 'L') {
+            long_double = true;
+            ++p;
+        }
+
+        arg_kind kind;
+        switch (*p) {
+        case 'd':
+        case 'i':
+        case 'u':
+        case 'o':
+        case 'x':
+        case 'X':
+            if (long_double)
+                return false;
+            kind = int_kind;
+            break;
+        case 'c':
+            if (wide || long_double)
+                return false;
+            kind = ARG_INT;
+            break;
+        case 'e':
+        case 'E':
+        case 'f':
+        case 'F':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A':
+            if (long_double)
+                return false;
+            kind = ARG_DOUBLE;
+            break;
+        case 'p':
+            kind = ARG_POINTER;
+            break;
+        case 's':
+            if (wide || long_double)
+                return false;
+            kind = ARG_STRING;
+            break;
+        default:
+            return false;
+        }
+        ++p;
+        segments.push_back({std::string(start, p - start), kind, stars, precision});
+    }
+
+    if (!literal.empty())
+        segments.push_back({literal, ARG_NONE, 0, PRECISION_NONE});
+    return true;
+}
+
+class arg_writer
+{
+public:
+    arg_writer(char *buffer, uint32_t capacity) : _buffer(buffer), _capacity(capacity), _size(0)
+    {
+    }
+
+    template <typename T>
+    void write(const T &value)
+    {
+        write_bytes((const char *)&value, sizeof(T));
+    }
+
+    void write_bytes(const char *data, uint32_t length)
+    {
+        if (_size + length <= _capacity) {
+            memcpy(_buffer + _size, data, length);
+            _size += length;
+        }
+    }
+
+    uint32_t size() const { return _size; }
+    uint32_t remaining() const { return _capacity - _size; }
+
+private:
+    char *_buffer;
+    uint32_t _capacity;
+    uint32_t _size;
+};
+
+class arg_reader
+{
+public:
+    arg_reader(const char *buffer, uint32_t size) : _ptr(buffer), _end(buffer + size) {}
+
+    // a truncated or corrupted payload reads as zeros
+    template <typename T>
+    void read(T &value)
+    {
+        if (_ptr + sizeof(T) <= _end) {
+            memcpy(&value, _ptr, sizeof(T));
+            _ptr += sizeof(T);
+        } else {
+            memset(&value, 0, sizeof(T));
+            _ptr = _end;
+        }
+    }
+
+    void read_string(uint32_t length, std::string &str)
+    {
+        if (length > static_cast<uint32_t>(_end - _ptr))
+            length = static_cast<uint32_t>(_end - _ptr);
+        str.assign(_ptr, length);
+        _ptr += length;
+    }
+
+private:
+    const char *_ptr;
+    const char *_end;
+};
+
+static uint32_t encode_args(const std::vector<format_segment> &segments,
+                            char *payload,
+                            uint32_t capacity,
+                            va_list args)
+{
+    arg_writer writer(payload, capacity);
+    for (size_t i = 0; i < segments.size(); ++i) {
+        auto &seg = segments[i];
+        if (seg.kind == ARG_NONE)
+            continue;
+
+        int precision = seg.precision;
+        for (int s = 0; s < seg.star_count; ++s) {
+            int32_t v = va_arg(args, int);
+            writer.write(v);
+            if (seg.precision == PRECISION_STAR && s == seg.star_count - 1)
+                precision = v;
+        }
+
+        switch (seg.kind) {
+        case ARG_INT:
+            writer.write(static_cast<int64_t>(va_arg(args, int)));
+            break;
+        case ARG_LONG:
+            writer.write(static_cast<int64_t>(va_arg(args, long)));
+            break;
+        case ARG_LLONG:
+            writer.write(static_cast<int64_t>(va_arg(args, long long)));
+            break;
+        case ARG_SIZE:
+            writer.write(static_cast<int64_t>(va_arg(args, size_t)));
+            break;
+        case ARG_INTMAX:
+            writer.write(static_cast<int64_t>(va_arg(args, intmax_t)));
+            break;
+        case ARG_PTRDIFF:
+            writer.write(static_cast<int64_t>(va_arg(args, ptrdiff_t)));
+            break;
+        case ARG_DOUBLE:
+            writer.write(va_arg(args, double));
+            break;
+        case ARG_POINTER:
+            writer.write(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(va_arg(args, void *))));
+            break;
+        case ARG_STRING: {
+            const char *str = va_arg(args, const char *);
+            if (str == nullptr)
+                str = "(null)";
+            size_t len = precision >= 0 ? strnlen(str, precision) : strlen(str);
+
+            // long strings are truncated, leaving room for the remaining arguments
+            size_t reserved = (segments.size() - i) * 16;
+            size_t room = writer.remaining() > reserved ? writer.remaining() - reserved : 0;
+            if (len > room)
+                len = room;
+            writer.write(static_cast<uint32_t>(len));
+            writer.write_bytes(str, static_cast<uint32_t>(len));
+            break;
+        }
+        default:
+            break;
+        }
+    }
+    return writer.size();
+}
+
+template <typename T>
+static void append_format(std::string &out, const char *spec, T value)
+{
+    char buffer[256];
+    int wn = snprintf_p(buffer, sizeof(buffer), spec, value);
+    if (wn < 0)
+        return;
+    if (wn < static_cast<int>(sizeof(buffer))) {
+        out.append(buffer, wn);
+        return;
+    }
+
+    size_t pos = out.size();
+    out.resize(pos + wn + 1);
+    snprintf_p(&out[pos], wn + 1, spec, value);
+    out.resize(pos + wn);
+}
+
+static void format_body(const std::vector<format_segment> &segments,
+                        const char *payload,
+                        uint32_t payload_size,
+                        std::string &out)
+{
+    arg_reader reader(payload, payload_size);
+    std::string spec;
+    std::string str;
+    for (auto &seg : segments) {
+        if (seg.kind == ARG_NONE) {
+            out.append(seg.text);
+            continue;
+        }
+
+        // replace '*' with the recorded width and precision
+        spec.clear();
+        for (char c : seg.text) {
+            if (c != '*') {
+                spec.push_back(c);
+                continue;
+            }
+            int32_t v;
+            reader.read(v);
+            if (v < 0 && spec.back() == '.')
+                spec.pop_back(); // negative precision is taken as if omitted
+            else
+                spec.append(std::to_string(v));
+        }
+
+        int64_t i64;
+        switch (seg.kind) {
+        case ARG_INT:
+            reader.read(i64);
+            append_format(out, spec.c_str(), static_cast<int>(i64));
+            break;
+        case ARG_LONG:
+            reader.read(i64);
+            append_format(out, spec.c_str(), static_cast<long>(i64));
+            break;
+        case ARG_LLONG:
+            reader.read(i64);
+            append_format(out, spec.c_str(), static_cast<long long>(i64));
+            break;
+        case ARG_SIZE:
+            reader.read(i64);
+            append_format(out, spec.c_str(), static_cast<size_t>(i64));
+            break;
+        case ARG_INTMAX:
+            reader.read(i64);
+            append_format(out, spec.c_str(), static_cast<intmax_t>(i64));
+            break;
+        case ARG_PTRDIFF:
+            reader.read(i64);
+            append_format(out, spec.c_str(), static_cast<ptrdiff_t>(i64));
+            break;
+        case ARG_DOUBLE: {
+            double d;
+            reader.read(d);
+            append_format(out, spec.c_str(), d);
+            break;
+        }
+        case ARG_POINTER: {
+            uint64_t u64;
+            reader.read(u64);
+            append_format(out, spec.c_str(), reinterpret_cast<void *>(static_cast<uintptr_t>(u64)));
+            break;
+        }
+        case ARG_STRING: {
+            uint32_t len;
+            reader.read(len);
+            reader.read_string(len, str);
+            append_format(out, spec.c_str(), str.c_str());
+            break;
+        }
+        default:
+            break;
+        }
+    }
+}
+
+// same header as hpc_logger
+static void format_header(const log_record_header &h,
+                          const char *node,
+                          const char *pool,
+                          std::string &out)
+{
+    static const char s_level_char[] = "IDWEF";
+    char buffer[256];
+    char str[24];
+    ::dsn::utils::time_ms_to_string(h.ts / 1000000, str);
+    int wn = snprintf_p(buffer,
+                        sizeof(buffer),
+                        "%c%s (%" PRIu64 " %04x) ",
+                        h.level < 5 ? s_level_char[h.level] : '?',
+                        str,
+                        h.ts,
+                        h.tid);
+    out.append(buffer, std::min(wn, static_cast<int>(sizeof(buffer)) - 1));
+
+    if (h.task_id) {
+        if (h.pool_id != 0) {
+            wn = snprintf_p(buffer,
+                            sizeof(buffer),
+                            "%6s.%7s%d.%016" PRIx64 ": ",
+                            node,
+                            pool,
+                            h.worker_index,
+                            h.task_id);
+        } else {
+            wn = snprintf_p(buffer,
+                            sizeof(buffer),
+                            "%6s.%7s.%05d.%016" PRIx64 ": ",
+                            node,
+                            "io-thrd",
+                            h.tid,
+                            h.task_id);
+        }
+    } else {
+        wn = snprintf_p(buffer, sizeof(buffer), "%6s.%7s.%05d: ", node, "io-thrd", h.tid);
+    }
+    out.append(buffer, std::min(wn, static_cast<int>(sizeof(buffer)) - 1));
+}
+
+template <typename TLookup>
+static void
+format_record(const log_record_header &h, const char *payload, TLookup &&lookup, std::string &out)
+{
+    auto node = lookup(h.node_id);
+    auto pool = lookup(h.pool_id);
+    format_header(
+        h, node ? node->fmt.c_str() : "unknown", pool ? pool->fmt.c_str() : "unknown", out);
+
+    auto fi = h.fmt_id ? lookup(h.fmt_id) : nullptr;
+    if (h.fmt_id == 0)
+        out.append(payload, h.payload_size);
+    else if (fi != nullptr && fi->valid)
+        format_body(fi->segments, payload, h.payload_size, out);
+    else
+        out.append("-- cannot printf due to that log entry has error ---");
+    out.push_back('\n');
+}
+
+hpc_binary_logger::hpc_binary_logger(const char *log_dir)
+    : logging_provider(log_dir),
+      _log_dir(log_dir),
+      _dict(new std::atomic<format_info *>[MAX_FORMAT_COUNT]),
+      _dict_count(0),
+      _dropped_count(0),
+      _stop_thread(false),
+      _drain_rounds(0)
+{
+    _instance_id = s_next_instance_id++;
+    for (uint32_t i = 0; i < MAX_FORMAT_COUNT; ++i)
+        _dict[i].store(nullptr, std::memory_order_relaxed);
+
+    _per_thread_ring_bytes =
+        (int)dsn_config_get_value_uint64("tools.hpc_binary_logger",
+                                         "per_thread_ring_bytes",
+                                         256 * 1024, // 256 KB by default
+                                         "ring size for per-thread logging");
+    if (_per_thread_ring_bytes < (int)MAX_RECORD_BYTES * 4)
+        _per_thread_ring_bytes = MAX_RECORD_BYTES * 4;
+    _per_thread_ring_bytes = align8(_per_thread_ring_bytes);
+
+    _max_number_of_log_files_on_disk = dsn_config_get_value_uint64(
+        "tools.hpc_binary_logger",
+        "max_number_of_log_files_on_disk",
+        20,
+        "max number of log files reserved on disk, older logs are auto deleted");
+    _binary_output = dsn_config_get_value_bool(
+        "tools.hpc_binary_logger",
+        "binary_output",
+        false,
+        "whether to dump binary records into log.x.bin (decoded offline) instead of text");
+
+    _start_index = 0;
+    _index = 1;
+    _current_log_file_bytes = 0;
+
+    // check existing log files and decide start_index
+    const char *ext = _binary_output ? "bin" : "txt";
+    std::vector<std::string> sub_list;
+    if (!dsn::utils::filesystem::get_subfiles(_log_dir, sub_list, false)) {
+        dassert(false, "Fail to get subfiles in %s.", _log_dir.c_str());
+    }
+
+    for (auto &fpath : sub_list) {
+        auto &&name = dsn::utils::filesystem::get_file_name(fpath);
+        if (name.length() <= 5 || name.substr(0, 4) != "log.")
+            continue;
+
+        int index;
+        char suffix[8];
+        if (2 != sscanf(name.c_str(), "log.%d.%7s", &index, suffix) || index < 1 ||
+            strcmp(suffix, ext) != 0)
+            continue;
+
+        if (index > _index)
+            _index = index;
+
+        if (_start_index == 0 || index < _start_index)
+            _start_index = index;
+    }
+    sub_list.clear();
+
+    if (_start_index == 0)
+        _start_index = _index;
+    else
+        _index++;
+
+    _current_log = nullptr;
+    create_log_file();
+    _log_thread = std::thread(&hpc_binary_logger::log_thread, this);
+}
+
+hpc_binary_logger::~hpc_binary_logger(void)
+{
+    flush();
+
+    _stop_thread = true;
+    _wakeup_cond.notify_one();
+    _log_thread.join();
+
+    _current_log->close();
+    delete _current_log;
+
+    _rings.clear();
+    for (uint32_t i = 1; i <= _dict_count.load(); ++i)
+        delete _dict[i].load();
+}
+
+void hpc_binary_logger::create_log_file()
+{
+    const char *ext = _binary_output ? "bin" : "txt";
+    std::stringstream log;
+    log << _log_dir << "/log." << _index++ << "." << ext;
+    _current_log = new std::ofstream(
+        log.str().c_str(), std::ofstream::out | std::ofstream::app | std::ofstream::binary);
+    _current_log_file_bytes = 0;
+
+    if (_binary_output) {
+        // the dictionary is rewritten into every file so that each file decodes alone
+        _current_log->write(s_binary_magic, sizeof(s_binary_magic));
+        _current_log_file_bytes += sizeof(s_binary_magic);
+        _written_ids.clear();
+    }
+
+    while (_index - _start_index > _max_number_of_log_files_on_disk) {
+        std::stringstream str2;
+        str2 << "log." << _start_index++ << "." << ext;
+        auto dp = utils::filesystem::path_combine(_log_dir, str2.str());
+        if (::remove(dp.c_str()) != 0) {
+            printf("Failed to remove garbage log file %s\n", dp.c_str());
+            _start_index--;
+            break;
+        }
+    }
+}
+
+hpc_binary_logger::tls_context *hpc_binary_logger::get_tls_context()
+{
+    tls_context *ctx = s_tls_context;
+    if (ctx == nullptr) {
+        ctx = new tls_context();
+        ctx->instance_id = 0;
+        ctx->tid = ::dsn::utils::get_current_tid();
+        s_tls_context = ctx;
+        s_tls_context_holder.ctx = ctx;
+    }
+
+    if (ctx->instance_id != _instance_id) {
+        // first log of this thread in this logger
+        ctx->release_ring();
+        ctx->instance_id = _instance_id;
+        ctx->ring = std::make_shared<log_ring>(_per_thread_ring_bytes, ctx->tid);
+        memset(ctx->cache_keys, 0, sizeof(ctx->cache_keys));
+
+        std::lock_guard<std::mutex> l(_rings_lock);
+        _rings.push_back(ctx->ring);
+    }
+    return ctx;
+}
+
+const hpc_binary_logger::format_info *hpc_binary_logger::get_format(uint32_t id) const
+{
+    return id < MAX_FORMAT_COUNT ? _dict[id].load(std::memory_order_acquire) : nullptr;
+}
+
+uint32_t hpc_binary_logger::get_format_id(tls_context *ctx, const char *fmt)
+{
+    uintptr_t key = reinterpret_cast<uintptr_t>(fmt);
+    uint32_t slot = static_cast<uint32_t>((key ^ (key >> 9)) & (FORMAT_CACHE_SIZE - 1));
+    if (ctx->cache_keys[slot] == fmt) {
+        uint32_t id = ctx->cache_ids[slot];
+        // fmt may not be a literal, in which case the address can be reused
+        if (strcmp(get_format(id)->fmt.c_str(), fmt) == 0)
+            return id;
+    }
+
+    uint32_t id = register_format(fmt);
+    if (id != 0) {
+        ctx->cache_keys[slot] = fmt;
+        ctx->cache_ids[slot] = id;
+    }
+    return id;
+}
+
+uint32_t hpc_binary_logger::register_format(const char *fmt)
+{
+    std::lock_guard<std::mutex> l(_dict_lock);
+    auto it = _dict_index.find(fmt);
+    if (it != _dict_index.end())
+        return it->second;
+
+    uint32_t id = _dict_count.load(std::memory_order_relaxed) + 1;
+    if (id >= MAX_FORMAT_COUNT)
+        return 0;
+
+    format_info *fi = new format_info();
+    fi->fmt = fmt;
+    fi->valid = parse_format(fmt, fi->segments);
+    _dict[id].store(fi, std::memory_order_release);
+    _dict_count.store(id, std::memory_order_release);
+    _dict_index.emplace(fi->fmt, id);
+    return id;
+}
+
+void hpc_binary_logger::dsn_logv(const char *file,
+                                 const char *function,
+                                 const int line,
+                                 dsn_log_level_t log_level,
+                                 const char *fmt,
+                                 va_list args)
+{
+    tls_context *ctx = get_tls_context();
+
+    log_record_header h;
+    memset(&h, 0, sizeof(h));
+    if (::dsn::tools::is_engine_ready())
+        h.ts = dsn_now_ns();
+    h.tid = ctx->tid;
+    h.level = static_cast<uint8_t>(log_level);
+    h.task_id = task::get_current_task_id();
+
+    const char *node = task::get_current_node_name();
+    const char *pool = "unknown";
+    h.node_id = get_format_id(ctx, node);
+    auto worker = task::get_current_worker2();
+    if (worker != nullptr) {
+        pool = worker->pool_spec().name.c_str();
+        h.pool_id = get_format_id(ctx, pool);
+        h.worker_index = static_cast<int16_t>(worker->index());
+    }
+
+    // dump critical logs on screen
+    if (log_level >= LOG_LEVEL_WARNING) {
+        va_list screen_args;
+        va_copy(screen_args, args);
+        std::string text;
+        format_header(h, node, pool, text);
+        char body[1024];
+        int wn = std::vsnprintf(body, sizeof(body), fmt, screen_args);
+        va_end(screen_args);
+        if (wn > 0)
+            text.append(body, std::min(wn, static_cast<int>(sizeof(body)) - 1));
+        text.push_back('\n');
+        std::cout.write(text.c_str(), text.length());
+    }
+
+    // encode the raw arguments, the text is formatted later by the daemon thread
+    char *payload = ctx->scratch + sizeof(h);
+    uint32_t capacity = MAX_RECORD_BYTES - sizeof(h);
+    h.fmt_id = get_format_id(ctx, fmt);
+    auto fi = h.fmt_id ? get_format(h.fmt_id) : nullptr;
+    if (fi != nullptr && fi->valid) {
+        h.payload_size = encode_args(fi->segments, payload, capacity, args);
+    } else {
+        h.fmt_id = 0;
+        int wn = std::vsnprintf(payload, capacity, fmt, args);
+        if (wn < 0)
+            wn = snprintf_p(
+                payload, capacity, "-- cannot printf due to that log entry has error ---");
+        h.payload_size = std::min(static_cast<uint32_t>(wn), capacity - 1);
+    }
+    h.size = align8(sizeof(h) + h.payload_size);
+    memcpy(ctx->scratch, &h, sizeof(h));
+
+    while (!ctx->ring->try_write(ctx->scratch, h.size)) {
+        if (log_level < LOG_LEVEL_WARNING) {
+            ctx->ring->dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        _wakeup_cond.notify_one();
+        std::this_thread::yield();
+    }
+}
+
+void hpc_binary_logger::flush()
+{
+    // wait for a complete drain pass which starts after this call
+    uint64_t target = _drain_rounds.load() + 2;
+    while (_drain_rounds.load() < target && !_stop_thread.load()) {
+        _wakeup_cond.notify_one();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+void hpc_binary_logger::log_thread()
+{
+    while (true) {
+        bool stop = _stop_thread.load();
+        bool drained = drain_rings();
+        if (drained || stop) {
+            write_out_buffer();
+            _current_log->flush();
+        }
+        ++_drain_rounds;
+
+        if (stop)
+            break;
+        if (!drained) {
+            std::unique_lock<std::mutex> l(_wakeup_lock);
+            _wakeup_cond.wait_for(l, std::chrono::milliseconds(1));
+        }
+    }
+}
+
+bool hpc_binary_logger::drain_rings()
+{
+    std::vector<std::shared_ptr<log_ring>> rings;
+    {
+        std::lock_guard<std::mutex> l(_rings_lock);
+        rings = _rings;
+    }
+
+    bool drained = false;
+    bool retired = false;
+    for (auto &r : rings) {
+        // read before draining, so all the writes of an orphaned ring are drained below
+        bool orphaned = r->orphaned.load(std::memory_order_acquire);
+        uint64_t tail = r->tail.load(std::memory_order_relaxed);
+        uint64_t head = r->head.load(std::memory_order_acquire);
+        while (tail < head) {
+            uint32_t offset = static_cast<uint32_t>(tail % r->capacity);
+            uint32_t size;
+            memcpy(&size, r->buffer + offset, sizeof(size));
+            if (size == 0) {
+                tail += r->capacity - offset;
+            } else {
+                write_record(r->buffer + offset);
+                tail += size;
+            }
+            r->tail.store(tail, std::memory_order_release);
+            drained = true;
+        }
+
+        uint64_t dropped = r->dropped.load(std::memory_order_relaxed);
+        if (dropped != r->reported_dropped) {
+            char record[sizeof(log_record_header) + 128];
+            log_record_header h;
+            memset(&h, 0, sizeof(h));
+            if (::dsn::tools::is_engine_ready())
+                h.ts = dsn_now_ns();
+            h.tid = r->tid;
+            h.level = LOG_LEVEL_WARNING;
+            int wn = snprintf_p(record + sizeof(h),
+                                sizeof(record) - sizeof(h),
+                                "%" PRIu64 " log records are dropped as the log ring is full",
+                                dropped - r->reported_dropped);
+            h.payload_size = static_cast<uint32_t>(wn);
+            h.size = align8(sizeof(h) + h.payload_size);
+            memcpy(record, &h, sizeof(h));
+            write_record(record);
+
+            _dropped_count += dropped - r->reported_dropped;
+            r->reported_dropped = dropped;
+            drained = true;
+        }
+
+        if (orphaned) {
+            retired = true;
+        }
+    }
+
+    if (retired) {
+        std::lock_guard<std::mutex> l(_rings_lock);
+        _rings.erase(std::remove_if(_rings.begin(),
+                                    _rings.end(),
+                                    [](const std::shared_ptr<log_ring> &r) {
+                                        return r->orphaned.load(std::memory_order_acquire) &&
+                                               r->tail.load() == r->head.load() &&
+                                               r->reported_dropped == r->dropped.load();
+                                    }),
+                     _rings.end());
+    }
+    return drained;
+}
+
+void hpc_binary_logger::write_record(const char *record)
+{
+    if (_current_log_file_bytes + _out_buffer.size() >= MAX_FILE_SIZE) {
+        write_out_buffer();
+        _current_log->close();
+        delete _current_log;
+        _current_log = nullptr;
+
+        create_log_file();
+    }
+
+    log_record_header h;
+    memcpy(&h, record, sizeof(h));
+    if (_binary_output) {
+        write_dictionary(h.fmt_id);
+        write_dictionary(h.node_id);
+        write_dictionary(h.pool_id);
+        _out_buffer.append(record, h.size);
+    } else {
+        format_record(h,
+                      record + sizeof(h),
+                      [this](uint32_t id) { return get_format(id); },
+                      _out_buffer);
+    }
+
+    if (_out_buffer.size() >= OUT_BUFFER_BYTES)
+        write_out_buffer();
+}
+
+void hpc_binary_logger::write_dictionary(uint32_t id)
+{
+    if (id == 0 || (id < _written_ids.size() && _written_ids[id]))
+        return;
+    if (id >= _written_ids.size())
+        _written_ids.resize(id + 1, false);
+    _written_ids[id] = true;
+
+    const std::string &str = get_format(id)->fmt;
+    dictionary_record_header dh;
+    dh.size = align8(sizeof(dh) + str.length());
+    dh.marker = DICTIONARY_MARKER;
+    dh.id = id;
+    dh.length = static_cast<uint32_t>(str.length());
+    _out_buffer.append((const char *)&dh, sizeof(dh));
+    _out_buffer.append(str);
+    _out_buffer.append(dh.size - sizeof(dh) - str.length(), '\0');
+}
+
+void hpc_binary_logger::write_out_buffer()
+{
+    if (_out_buffer.empty())
+        return;
+    _current_log->write(_out_buffer.c_str(), _out_buffer.size());
+    _current_log_file_bytes += static_cast<int>(_out_buffer.size());
+    _out_buffer.clear();
+}
+
+error_code hpc_binary_logger::decode_file(const char *binary_file, std::ostream &os)
+{
+    std::ifstream is(binary_file, std::ifstream::in | std::ifstream::binary);
+    if (!is) {
+        derror("open binary log file %s failed", binary_file);
+        return ERR_FILE_OPERATION_FAILED;
+    }
+
+    char magic[sizeof(s_binary_magic)];
+    if (!is.read(magic, sizeof(magic)) || memcmp(magic, s_binary_magic, sizeof(magic)) != 0) {
+        derror("%s is not a binary log file", binary_file);
+        return ERR_INVALID_DATA;
+    }
+
+    std::unordered_map<uint32_t, std::unique_ptr<format_info>> dict;
+    auto lookup = [&dict](uint32_t id) -> const format_info * {
+        auto it = dict.find(id);
+        return it == dict.end() ? nullptr : it->second.get();
+    };
+
+    std::vector<char> record;
+    std::string text;
+    while (true) {
+        uint32_t words[2];
+        if (!is.read((char *)words, sizeof(words)))
+            break;
+
+        uint32_t size = words[0];
+        if (size < sizeof(dictionary_record_header) || size % 8 != 0 ||
+            size > MAX_FILE_SIZE) {
+            derror("%s is corrupted at offset %" PRId64,
+                   binary_file,
+                   static_cast<int64_t>(is.tellg()) - 8);
+            return ERR_INVALID_DATA;
+        }
+        record.resize(size);
+        memcpy(record.data(), words, sizeof(words));
+        if (!is.read(record.data() + sizeof(words), size - sizeof(words))) {
+            derror("%s ends with an incomplete record", binary_file);
+            return ERR_INCOMPLETE_DATA;
+        }
+
+        if (words[1] == DICTIONARY_MARKER) {
+            dictionary_record_header dh;
+            memcpy(&dh, record.data(), sizeof(dh));
+            if (sizeof(dh) + dh.length > size) {
+                derror("%s has a corrupted dictionary record", binary_file);
+                return ERR_INVALID_DATA;
+            }
+            std::unique_ptr<format_info> fi(new format_info());
+            fi->fmt.assign(record.data() + sizeof(dh), dh.length);
+            fi->valid = parse_format(fi->fmt.c_str(), fi->segments);
+            dict[dh.id] = std::move(fi);
+        } else {
+            log_record_header h;
+            memset(&h, 0, sizeof(h));
+            memcpy(&h, record.data(), std::min(sizeof(h), record.size()));
+            if (size < sizeof(h) || sizeof(h) + h.payload_size > size) {
+                derror("%s has a corrupted log record", binary_file);
+                return ERR_INVALID_DATA;
+            }
+            text.clear();
+            format_record(h, record.data() + sizeof(h), lookup, text);
+            os.write(text.c_str(), text.length());
+        }
+    }
+    return ERR_OK;
+}
+}
+}
@@ -0,0 +1,136 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015 Microsoft Corporation
+ *
+ * -=- Robust Distributed System Nucleus (rDSN) -=-
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * Description:
+ *     hpc_binary_logger, a logging provider which keeps text formatting off the
+ *     logging threads.
+ *
+ *     Each logging thread owns a single-producer single-consumer ring, and a log
+ *     call only copies a compact binary record (format id + raw arguments) into
+ *     the ring. A daemon thread drains all rings and either formats the records
+ *     to text (log.x.txt), or dumps them as they are (log.x.bin) so that they
+ *     can be decoded offline with decode_file().
+ *
+ *     When a ring is full, records below LOG_LEVEL_WARNING are dropped (and the
+ *     drop count is reported in the log later), while records at or above
+ *     LOG_LEVEL_WARNING wait for the daemon thread to free space.
+ *
+ * Revision history:
+ *     xxxx-xx-xx, author, first version
+ *     xxxx-xx-xx, author, fix bug about xxx
+ */
+
+#pragma once
+
+#include <dsn/tool_api.h>
+#include <atomic>
+#include <condition_variable>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace dsn {
+namespace tools {
+
+class hpc_binary_logger : public logging_provider
+{
+public:
+    hpc_binary_logger(const char *log_dir);
+    virtual ~hpc_binary_logger(void);
+
+    virtual void dsn_logv(const char *file,
+                          const char *function,
+                          const int line,
+                          dsn_log_level_t log_level,
+                          const char *fmt,
+                          va_list args);
+
+    virtual void flush();
+
+    // format a log.x.bin file written with binary_output = true to text
+    static error_code decode_file(const char *binary_file, std::ostream &os);
+
+    uint64_t dropped_count() const { return _dropped_count.load(); }
+
+    struct format_info;
+    struct log_ring;
+    struct tls_context;
+
+private:
+    tls_context *get_tls_context();
+    uint32_t get_format_id(tls_context *ctx, const char *fmt);
+    uint32_t register_format(const char *fmt);
+    const format_info *get_format(uint32_t id) const;
+
+    void log_thread();
+    bool drain_rings();
+    void write_record(const char *record);
+    void write_dictionary(uint32_t id);
+    void write_out_buffer();
+    void create_log_file();
+
+private:
+    std::string _log_dir;
+    uint64_t _instance_id;
+    bool _binary_output;
+    int _per_thread_ring_bytes;
+    int _max_number_of_log_files_on_disk;
+
+    // format (and node/pool name) dictionary, id 0 is reserved for the
+    // records which are formatted on the logging thread
+    std::mutex _dict_lock;
+    std::unordered_map<std::string, uint32_t> _dict_index;
+    std::unique_ptr<std::atomic<format_info *>[]> _dict;
+    std::atomic<uint32_t> _dict_count;
+
+    // per-thread rings, which are retired by the daemon thread once drained after their
+    // owner threads exit
+    std::mutex _rings_lock;
+    std::vector<std::shared_ptr<log_ring>> _rings;
+    std::atomic<uint64_t> _dropped_count;
+
+    // daemon thread
+    std::thread _log_thread;
+    std::atomic<bool> _stop_thread;
+    std::atomic<uint64_t> _drain_rounds;
+    std::mutex _wakeup_lock;
+    std::condition_variable _wakeup_cond;
+
+    // log file, only touched by the daemon thread
+    std::string _out_buffer;
+    std::vector<bool> _written_ids;
+    int _start_index;
+    int _index;
+    int _current_log_file_bytes;
+    std::ofstream *_current_log;
+};
+}
+}
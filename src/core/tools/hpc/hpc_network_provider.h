@@ -72,6 +72,10 @@ private:
 private:
     void do_accept();
 
+    // sharded mode (linux only, see [network] hpc_looper_shard_count)
+    void do_accept(socket_t listen_fd, io_looper *looper);
+    io_looper *select_looper(::dsn::rpc_address remote_addr);
+
 public:
     struct ready_event
     {
@@ -83,6 +87,13 @@ public:
 
 private:
     ready_event _accept_event;
+
+    // each shard has its own looper (epoll set), sessions are spread over the shards
+    // by hashing the remote address; with SO_REUSEPORT each shard also has its own
+    // listen socket and the accepted sessions stay in the shard of the listen socket
+    std::vector<io_looper *> _shard_loopers;
+    std::vector<socket_t> _shard_listen_fds;
+    std::vector<std::unique_ptr<ready_event>> _shard_accept_events;
 #ifdef _WIN32
     socket_t _accept_sock;
     char _accept_buffer[1024];
@@ -116,6 +127,14 @@ public:
 
     virtual void close_on_fault_injection() override { close(); }
 
+#ifdef __linux__
+    // the file segment is sent with sendfile, see write_file_segment()
+    virtual bool can_send_file_segment(message_ex *msg) const override
+    {
+        return msg->hdr_format == NET_HDR_DSN;
+    }
+#endif
+
     void bind_looper(io_looper *looper, bool delay = false);
     virtual void do_read(int read_next) override;
 
@@ -152,6 +171,8 @@ protected:
     void on_connect_events_ready(uintptr_t lolp_or_events);
     void on_send_recv_events_ready(uintptr_t lolp_or_events);
     void do_safe_write(uint64_t signature);
+    // returns false if the socket is not writable or failed
+    bool write_file_segment();
 #endif
 };
 }
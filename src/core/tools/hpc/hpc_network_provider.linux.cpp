@@ -38,10 +38,11 @@
 #include "hpc_network_provider.h"
 #include "mix_all_io_looper.h"
 #include <netinet/tcp.h>
+#include <sys/sendfile.h>
 
 namespace dsn {
 namespace tools {
-static socket_t create_tcp_socket(sockaddr_in *addr)
+static socket_t create_tcp_socket(sockaddr_in *addr, bool reuse_port = false)
 {
     socket_t s = -1;
     if ((s = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK, IPPROTO_TCP)) == -1) {
@@ -74,6 +75,13 @@ static socket_t create_tcp_socket(sockaddr_in *addr)
         dwarn("setsockopt SO_KEEPALIVE failed, err = %s", strerror(errno));
     }
 
+    if (reuse_port) {
+        int reuseport = 1;
+        if (setsockopt(s, SOL_SOCKET, SO_REUSEPORT, (char *)&reuseport, sizeof(int)) == -1) {
+            dwarn("setsockopt SO_REUSEPORT failed, err = %s", strerror(errno));
+        }
+    }
+
     if (addr != 0) {
         if (bind(s, (struct sockaddr *)addr, sizeof(*addr)) != 0) {
             derror("bind failed, err = %s", strerror(errno));
@@ -96,7 +104,7 @@ hpc_network_provider::hpc_network_provider(rpc_engine *srv, network *inner_provi
 error_code
 hpc_network_provider::start(rpc_channel channel, int port, bool client_only, io_modifer &ctx)
 {
-    if (_listen_fd != -1)
+    if (_listen_fd != -1 || !_shard_listen_fds.empty())
         return ERR_SERVICE_ALREADY_RUNNING;
 
     _looper = get_io_looper(node(), ctx.queue, ctx.mode);
@@ -107,44 +115,104 @@ hpc_network_provider::start(rpc_channel channel, int port, bool client_only, io_
 
     _address.assign_ipv4(get_local_ipv4(), port);
 
+    int shard_count = (int)dsn_config_get_value_uint64(
+        "network",
+        "hpc_looper_shard_count",
+        0,
+        "how many io loopers (epoll sets) are used by each hpc network provider, "
+        "0 means all sessions share the io looper of the node");
+    bool reuse_port =
+        dsn_config_get_value_bool("network",
+                                  "hpc_listen_reuse_port",
+                                  false,
+                                  "whether each looper shard has its own listen socket with "
+                                  "SO_REUSEPORT, valid only when hpc_looper_shard_count > 0");
+    bool pin_core =
+        dsn_config_get_value_bool("network",
+                                  "hpc_looper_shard_pin_core",
+                                  false,
+                                  "whether to pin the thread of each looper shard to one core");
+
+    if (shard_count > 0 && ctx.mode != IOE_PER_NODE) {
+        dwarn("hpc_looper_shard_count is ignored as the io mode is not IOE_PER_NODE");
+        shard_count = 0;
+    }
+
+    int core_count = std::min(static_cast<int>(std::thread::hardware_concurrency()), 64);
+    for (int i = 0; i < shard_count; i++) {
+        auto looper = new io_looper();
+        if (pin_core && core_count > 0) {
+            looper->set_worker_affinity((uint64_t)1 << (i % core_count));
+        }
+        looper->start(node(), 1);
+        _shard_loopers.push_back(looper);
+    }
+
     if (!client_only) {
         struct sockaddr_in addr;
         addr.sin_family = AF_INET;
         addr.sin_addr.s_addr = INADDR_ANY;
         addr.sin_port = htons(port);
 
-        _listen_fd = create_tcp_socket(&addr);
-        if (_listen_fd == -1) {
-            dassert(false, "cannot create listen socket");
-        }
-
-        int forcereuse = 1;
-        if (setsockopt(
-                _listen_fd, SOL_SOCKET, SO_REUSEADDR, (char *)&forcereuse, sizeof(forcereuse)) !=
-            0) {
-            dwarn("setsockopt SO_REUSEDADDR failed, err = %s", strerror(errno));
-        }
+        // one listen socket per shard, the kernel balances the new connections
+        int listen_count = (reuse_port && shard_count > 0) ? shard_count : 1;
+        for (int i = 0; i < listen_count; i++) {
+            socket_t fd = create_tcp_socket(&addr, listen_count > 1);
+            if (fd == -1) {
+                dassert(false, "cannot create listen socket");
+            }
 
-        if (listen(_listen_fd, SOMAXCONN) != 0) {
-            dwarn("listen failed, err = %s", strerror(errno));
-            return ERR_NETWORK_START_FAILED;
-        }
+            int forcereuse = 1;
+            if (setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, (char *)&forcereuse, sizeof(forcereuse)) !=
+                0) {
+                dwarn("setsockopt SO_REUSEDADDR failed, err = %s", strerror(errno));
+            }
 
-        _accept_event.callback = [this](int err, uint32_t size, uintptr_t lpolp) {
-            this->do_accept();
-        };
+            if (listen(fd, SOMAXCONN) != 0) {
+                dwarn("listen failed, err = %s", strerror(errno));
+                return ERR_NETWORK_START_FAILED;
+            }
 
-        // bind for accept
-        _looper->bind_io_handle((dsn_handle_t)(intptr_t)_listen_fd,
-                                &_accept_event.callback,
-                                EPOLLIN | EPOLLET,
-                                nullptr // network_provider is a global object
-                                );
+            if (listen_count == 1) {
+                _listen_fd = fd;
+                _accept_event.callback = [this](int err, uint32_t size, uintptr_t lpolp) {
+                    this->do_accept();
+                };
+
+                // bind for accept
+                _looper->bind_io_handle((dsn_handle_t)(intptr_t)_listen_fd,
+                                        &_accept_event.callback,
+                                        EPOLLIN | EPOLLET,
+                                        nullptr // network_provider is a global object
+                                        );
+            } else {
+                auto looper = _shard_loopers[i];
+                std::unique_ptr<ready_event> evt(new ready_event());
+                evt->callback = [this, fd, looper](int err, uint32_t size, uintptr_t lpolp) {
+                    this->do_accept(fd, looper);
+                };
+
+                looper->bind_io_handle(
+                    (dsn_handle_t)(intptr_t)fd, &evt->callback, EPOLLIN | EPOLLET, nullptr);
+                _shard_listen_fds.push_back(fd);
+                _shard_accept_events.push_back(std::move(evt));
+            }
+        }
     }
 
     return ERR_OK;
 }
 
+io_looper *hpc_network_provider::select_looper(::dsn::rpc_address remote_addr)
+{
+    if (_shard_loopers.empty())
+        return _looper;
+
+    uint64_t h = ((uint64_t)remote_addr.ip() << 16) | remote_addr.port();
+    h *= 0x9E3779B97F4A7C15ULL; // fibonacci hashing to spread nearby ports
+    return _shard_loopers[(h >> 32) % _shard_loopers.size()];
+}
+
 rpc_session_ptr hpc_network_provider::create_client_session(::dsn::rpc_address server_addr)
 {
     struct sockaddr_in addr;
@@ -157,23 +225,25 @@ rpc_session_ptr hpc_network_provider::create_client_session(::dsn::rpc_address s
     message_parser_ptr parser(new_message_parser(_client_hdr_format));
     auto client = new hpc_rpc_session(sock, parser, *this, server_addr, true);
     rpc_session_ptr c(client);
-    client->bind_looper(_looper, true);
+    client->bind_looper(select_looper(server_addr), true);
     return c;
 }
 
-void hpc_network_provider::do_accept()
+void hpc_network_provider::do_accept() { do_accept(_listen_fd, nullptr); }
+
+void hpc_network_provider::do_accept(socket_t listen_fd, io_looper *looper)
 {
     while (true) {
         struct sockaddr_in addr;
         socklen_t addr_len = (socklen_t)sizeof(addr);
-        socket_t s = ::accept(_listen_fd, (struct sockaddr *)&addr, &addr_len);
+        socket_t s = ::accept(listen_fd, (struct sockaddr *)&addr, &addr_len);
         if (s != -1) {
             ::dsn::rpc_address client_addr(ntohl(addr.sin_addr.s_addr), ntohs(addr.sin_port));
             message_parser_ptr null_parser;
             auto rs = new hpc_rpc_session(s, null_parser, *this, client_addr, false);
             rpc_session_ptr s1(rs);
 
-            rs->bind_looper(_looper);
+            rs->bind_looper(looper ? looper : select_looper(client_addr));
             this->on_server_session_accepted(s1);
         } else {
             if (errno != EAGAIN && errno != EWOULDBLOCK) {
@@ -285,6 +355,25 @@ void hpc_rpc_session::do_write(uint64_t sig)
     // prepare send buffer, make sure header is already in the buffer
     while (true) {
         int buffer_count = (int)_sending_buffers.size() - _sending_buffer_start_index;
+        if (buffer_count == 0) {
+            // all buffers are sent, continue with the file segment if any
+            if (_sending_file_seg.size > 0) {
+                if (!write_file_segment())
+                    return;
+                continue;
+            }
+
+            // message completed, continue next message
+            auto csig = _sending_signature;
+            _sending_signature = 0;
+
+            _send_lock.unlock(); // avoid recursion
+            // try next msg recursively
+            on_send_completed(csig);
+            _send_lock.lock();
+            return;
+        }
+
         struct msghdr hdr;
         memset((void *)&hdr, 0, sizeof(hdr));
         hdr.msg_name = (void *)&_peer_addr;
@@ -292,7 +381,9 @@ void hpc_rpc_session::do_write(uint64_t sig)
         hdr.msg_iov = (struct iovec *)&_sending_buffers[_sending_buffer_start_index];
         hdr.msg_iovlen = (size_t)buffer_count;
 
-        int sz = sendmsg(_socket, &hdr, MSG_NOSIGNAL);
+        // hint the kernel to coalesce the buffers with the following file segment
+        int flags = MSG_NOSIGNAL | (_sending_file_seg.size > 0 ? MSG_MORE : 0);
+        int sz = sendmsg(_socket, &hdr, flags);
         int err = errno;
         dinfo("(s = %d) call sendmsg on %s, return %d, err = %s",
               _socket,
@@ -324,25 +415,45 @@ void hpc_rpc_session::do_write(uint64_t sig)
             }
             _sending_buffer_start_index = buf_i;
 
-            // message completed, continue next message
-            if (_sending_buffer_start_index == (int)_sending_buffers.size()) {
-                dassert(len == 0, "buffer must be sent completely");
-
-                auto csig = _sending_signature;
-                _sending_signature = 0;
+            // try next while(true) loop to continue sending current msg,
+            // or to complete it if all buffers are sent
+        }
+    }
+}
 
-                _send_lock.unlock(); // avoid recursion
-                // try next msg recursively
-                on_send_completed(csig);
-                _send_lock.lock();
-                return;
-            }
+// runs on the looper thread, so the segment is expected to be in the page cache already
+// (e.g., nfs_service_impl only attaches cached ranges), otherwise the looper is stalled
+bool hpc_rpc_session::write_file_segment()
+{
+    off_t offset = (off_t)_sending_file_seg.offset;
+    ssize_t sz = ::sendfile(_socket, _sending_file_seg.fd, &offset, _sending_file_seg.size);
+    int err = errno;
+    dinfo("(s = %d) call sendfile on %s, return %d, err = %s",
+          _socket,
+          _remote_addr.to_string(),
+          (int)sz,
+          strerror(err));
 
-            else {
-                // try next while(true) loop to continue sending current msg
-            }
+    if (sz < 0) {
+        if (err != EAGAIN && err != EWOULDBLOCK) {
+            derror("(s = %d) sendfile failed, err = %s", _socket, strerror(err));
+            on_failure(true);
+        } else {
+            // wait for epoll_wait notification
         }
+        return false;
+    } else if (sz == 0) {
+        // the file is truncated, the announced body length can never be satisfied
+        derror("(s = %d) sendfile failed, unexpected end of file, remaining size = %u",
+               _socket,
+               _sending_file_seg.size);
+        on_failure(true);
+        return false;
     }
+
+    _sending_file_seg.offset += (uint64_t)sz;
+    _sending_file_seg.size -= (uint32_t)sz;
+    return true;
 }
 
 void hpc_rpc_session::close()
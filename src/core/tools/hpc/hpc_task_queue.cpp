@@ -144,5 +144,78 @@ task *hpc_concurrent_task_queue::dequeue(int &batch_size)
     } while (count != 0);
     return head;
 }
+hpc_work_stealing_task_queue::hpc_work_stealing_task_queue(task_worker_pool *pool,
+                                                           int index,
+                                                           task_queue *inner_provider)
+    : task_queue(pool, index, inner_provider), _next_queue(0)
+{
+    for (int i = 0; i < worker_count(); i++) {
+        _worker_queues.emplace_back(new worker_queue_t());
+    }
+}
+
+int hpc_work_stealing_task_queue::local_queue_index() const
+{
+    auto worker = task::get_current_worker2();
+    if (worker != nullptr && worker->queue() == this) {
+        return worker->index() % static_cast<int>(_worker_queues.size());
+    } else {
+        return -1;
+    }
+}
+
+void hpc_work_stealing_task_queue::enqueue(task *task)
+{
+    dassert(task->next == nullptr, "task is not alone");
+    int idx = local_queue_index();
+    if (idx == -1) {
+        idx = static_cast<int>(_next_queue.fetch_add(1, std::memory_order_relaxed) %
+                               _worker_queues.size());
+    }
+
+    _worker_queues[idx]->q[task->spec().priority].enqueue(task);
+    _sema.signal(1);
+}
+
+task *hpc_work_stealing_task_queue::dequeue(int &batch_size)
+{
+    // the semaphore counts the tasks in all the worker queues, so once
+    // we get batch_size from it there must be enough tasks to collect
+    batch_size = _sema.waitMany(batch_size);
+    if (batch_size == 0) {
+        return nullptr;
+    }
+
+    task *head = nullptr, *last = nullptr;
+    auto out = boost::make_function_output_iterator([&head, &last](task *in) {
+        if (last) {
+            last->next = in;
+        } else {
+            head = in;
+        }
+
+        last = in;
+        last->next = nullptr;
+    });
+
+    int self = local_queue_index();
+    if (self == -1) {
+        self = 0;
+    }
+
+    auto qcount = static_cast<int>(_worker_queues.size());
+    auto count = batch_size;
+    do {
+        // higher priority tasks first, and for each priority,
+        // try the local queue first and then steal from the peers
+        for (int pri = TASK_PRIORITY_COUNT - 1; pri >= 0 && count != 0; --pri) {
+            for (int i = 0; i < qcount && count != 0; ++i) {
+                auto &q = _worker_queues[(self + i) % qcount]->q[pri];
+                count -= q.try_dequeue_bulk(out, count);
+            }
+        }
+    } while (count != 0);
+    return head;
+}
 }
 }
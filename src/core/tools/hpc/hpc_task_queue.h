@@ -85,5 +85,33 @@ public:
 
     task *dequeue(/*inout*/ int &batch_size) override;
 };
+
+//
+// each worker of a shared (non-partitioned) pool owns a set of lock-free queues
+// (one per priority); tasks enqueued from a worker of the pool go to its own queues,
+// tasks from other threads are distributed round-robin, and an idle worker steals
+// from its peers (higher priorities first) before going to sleep
+//
+class hpc_work_stealing_task_queue : public task_queue
+{
+    moodycamel::details::mpmc_sema::LightweightSemaphore _sema;
+    struct worker_queue_t
+    {
+        moodycamel::ConcurrentQueue<task *> q[TASK_PRIORITY_COUNT];
+    };
+    std::vector<std::unique_ptr<worker_queue_t>> _worker_queues;
+    std::atomic<unsigned int> _next_queue;
+
+public:
+    hpc_work_stealing_task_queue(task_worker_pool *pool, int index, task_queue *inner_provider);
+
+    void enqueue(task *task) override;
+
+    task *dequeue(/*inout*/ int &batch_size) override;
+
+private:
+    // index of the queue owned by the current thread, or -1 when it is not a worker of this queue
+    int local_queue_index() const;
+};
 }
 }
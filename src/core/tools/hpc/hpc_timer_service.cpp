@@ -0,0 +1,124 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015 Microsoft Corporation
+ *
+ * -=- Robust Distributed System Nucleus (rDSN) -=-
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "hpc_timer_service.h"
+
+namespace dsn {
+namespace tools {
+hpc_timer_service::hpc_timer_service(service_node *node, timer_service *inner_provider)
+    : timer_service(node, inner_provider), _next_wakeup_ms(UINT64_MAX), _is_running(false)
+{
+}
+
+hpc_timer_service::~hpc_timer_service()
+{
+    {
+        std::lock_guard<std::mutex> l(_lock);
+        _is_running = false;
+    }
+    _cond.notify_one();
+
+    if (_worker != nullptr) {
+        _worker->join();
+    }
+}
+
+void hpc_timer_service::start(io_modifer &ctx)
+{
+    _is_running = true;
+    _worker = std::shared_ptr<std::thread>(new std::thread([this, ctx]() {
+        task::set_tls_dsn_context(node(), nullptr, ctx.queue);
+
+        char buffer[128];
+        sprintf(buffer,
+                "%s.%s.timer",
+                get_service_node_name(node()),
+                ctx.queue ? ctx.queue->get_name().c_str() : "");
+
+        task_worker::set_name(buffer);
+        task_worker::set_priority(worker_priority_t::THREAD_xPRIORITY_ABOVE_NORMAL);
+
+        run();
+    }));
+}
+
+void hpc_timer_service::add_timer(task *task)
+{
+    uint64_t now_ms = dsn_now_ms();
+    uint64_t ts_ms = now_ms + task->delay_milliseconds();
+    task->set_delay(0);
+
+    bool wakeup = false;
+    {
+        std::lock_guard<std::mutex> l(_lock);
+        _wheel.add(task, ts_ms, now_ms);
+        if (ts_ms < _next_wakeup_ms) {
+            _next_wakeup_ms = ts_ms;
+            wakeup = true;
+        }
+    }
+
+    if (wakeup)
+        _cond.notify_one();
+}
+
+void hpc_timer_service::run()
+{
+    std::unique_lock<std::mutex> l(_lock);
+    while (_is_running.load(std::memory_order_relaxed)) {
+        slist<task> fired;
+        uint64_t now_ms = dsn_now_ms();
+        _wheel.advance(now_ms, [&fired](task *t) { fired.add(t); });
+
+        // sleep until the next deadline instead of ticking every millisecond,
+        // add_timer wakes us up earlier for a timer that expires before it
+        _next_wakeup_ms = _wheel.next_expire_ms();
+
+        task *t = fired.pop_all(), *next;
+        if (t) {
+            l.unlock();
+            while (t) {
+                next = t->next;
+                t->next = nullptr;
+
+                t->enqueue();
+                t->release_ref(); // added by first t->enqueue()
+
+                t = next;
+            }
+            l.lock();
+            continue;
+        }
+
+        if (_next_wakeup_ms == UINT64_MAX) {
+            _cond.wait(l);
+        } else if (_next_wakeup_ms > now_ms) {
+            _cond.wait_for(l, std::chrono::milliseconds(_next_wakeup_ms - now_ms));
+        }
+    }
+}
+}
+}
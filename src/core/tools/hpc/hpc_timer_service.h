@@ -0,0 +1,68 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015 Microsoft Corporation
+ *
+ * -=- Robust Distributed System Nucleus (rDSN) -=-
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * Description:
+ *     timer service based on the hierarchical timing wheel with a dedicated ticking thread
+ *
+ * Revision history:
+ *     xxxx-xx-xx, author, first version
+ *     xxxx-xx-xx, author, fix bug about xxx
+ */
+
+#pragma once
+
+#include <dsn/tool_api.h>
+#include <condition_variable>
+#include <mutex>
+#include "timer_wheel.h"
+
+namespace dsn {
+namespace tools {
+class hpc_timer_service : public timer_service
+{
+public:
+    hpc_timer_service(service_node *node, timer_service *inner_provider);
+    virtual ~hpc_timer_service();
+
+    // after milliseconds, the provider should call task->enqueue()
+    virtual void add_timer(task *task) override;
+
+    virtual void start(io_modifer &ctx) override;
+
+private:
+    void run();
+
+private:
+    std::mutex _lock;
+    std::condition_variable _cond;
+    uint64_t _next_wakeup_ms; // when the worker wakes up next, protected by _lock
+    timer_wheel<task> _wheel;
+    std::shared_ptr<std::thread> _worker;
+    std::atomic<bool> _is_running;
+};
+}
+}
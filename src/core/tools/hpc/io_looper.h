@@ -36,6 +36,7 @@
 
 #include <dsn/utility/ports.h>
 #include <dsn/tool_api.h>
+#include "timer_wheel.h"
 
 #ifndef _WIN32
 
@@ -110,12 +111,16 @@ public:
 
     void add_timer(task *timer); // return next firing delay ms
 
+    // pin the worker threads to the given cores, must be called before start
+    void set_worker_affinity(uint64_t mask) { _worker_affinity_mask = mask; }
+
 protected:
     virtual bool is_shared_timer_queue() { return true; }
     void exec_timer_tasks(bool local_exec);
 
 private:
     std::vector<std::thread *> _workers;
+    uint64_t _worker_affinity_mask = 0;
 #ifdef _WIN32
     HANDLE _io_queue;
 #else
@@ -145,8 +150,8 @@ private:
     // timers
     std::atomic<uint64_t> _remote_timer_tasks_count;
     ::dsn::utils::ex_lock_nr_spin _remote_timer_tasks_lock;
-    std::map<uint64_t, slist<task>> _remote_timer_tasks; // ts (ms) => task
-    std::map<uint64_t, slist<task>> _local_timer_tasks;
+    timer_wheel<task> _remote_timer_tasks;
+    timer_wheel<task> _local_timer_tasks;
 };
 
 // --------------- inline implementation -------------------------
@@ -175,6 +175,9 @@ void io_looper::start(service_node *node, int worker_count)
             char buffer[128];
             sprintf(buffer, "%s.io-loop.%d", name, i);
             task_worker::set_name(buffer);
+            if (_worker_affinity_mask != 0) {
+                task_worker::set_affinity(_worker_affinity_mask);
+            }
 
             this->loop_worker();
         });
@@ -121,47 +121,39 @@ void io_looper::exec_timer_tasks(bool local_exec)
 {
     // execute local timers
     uint64_t nts = ::dsn::task::get_current_env()->now_ns() / 1000000;
-    while (_local_timer_tasks.size() > 0) {
-        auto it = _local_timer_tasks.begin();
-        if (it->first <= nts) {
-            task *t = it->second.pop_all(), *next;
-            _local_timer_tasks.erase(it);
-
-            while (t) {
-                next = t->next;
-                if (local_exec)
-                    t->exec_internal();
-                else {
-                    t->enqueue();
-                    t->release_ref(); // added by first t->enqueue()
-                }
-
-                t = next;
+    if (!_local_timer_tasks.empty()) {
+        slist<task> fired;
+        _local_timer_tasks.advance(nts, [&fired](task *t) { fired.add(t); });
+
+        task *t = fired.pop_all(), *next;
+        while (t) {
+            next = t->next;
+            t->next = nullptr;
+            if (local_exec)
+                t->exec_internal();
+            else {
+                t->enqueue();
+                t->release_ref(); // added by first t->enqueue()
             }
-        } else
-            break;
+
+            t = next;
+        }
     }
 
     // execute shared timers
-    while (_remote_timer_tasks_count.load(std::memory_order_relaxed) > 0) {
-        task *t = nullptr, *next;
+    if (_remote_timer_tasks_count.load(std::memory_order_relaxed) > 0) {
+        slist<task> fired;
         {
             utils::auto_lock<::dsn::utils::ex_lock_nr_spin> l(_remote_timer_tasks_lock);
-            if (_remote_timer_tasks.size() == 0)
-                break;
-
-            auto it = _remote_timer_tasks.begin();
-            if (it->first <= nts) {
-                t = it->second.pop_all();
-                _remote_timer_tasks.erase(it);
-            } else
-                break;
+            _remote_timer_tasks.advance(nts, [&fired](task *t) { fired.add(t); });
         }
 
+        task *t = fired.pop_all(), *next;
         while (t) {
             _remote_timer_tasks_count--;
 
             next = t->next;
+            t->next = nullptr;
 
             if (local_exec)
                 t->exec_internal();
@@ -177,16 +169,15 @@ void io_looper::exec_timer_tasks(bool local_exec)
 
 void io_looper::add_timer(task *timer)
 {
-    uint64_t ts_ms = dsn_now_ms() + timer->delay_milliseconds();
+    uint64_t now_ms = dsn_now_ms();
+    uint64_t ts_ms = now_ms + timer->delay_milliseconds();
     timer->set_delay(0);
 
     // put into locked queue when it is shared or from remote threads
     if (is_shared_timer_queue()) {
         {
             utils::auto_lock<::dsn::utils::ex_lock_nr_spin> l(_remote_timer_tasks_lock);
-            auto pr = _remote_timer_tasks.insert(
-                std::map<uint64_t, slist<task>>::value_type(ts_ms, slist<task>()));
-            pr.first->second.add(timer);
+            _remote_timer_tasks.add(timer, ts_ms, now_ms);
         }
 
         _remote_timer_tasks_count++;
@@ -194,9 +185,7 @@ void io_looper::add_timer(task *timer)
 
     // put into local queue
     else {
-        auto pr = _local_timer_tasks.insert(
-            std::map<uint64_t, slist<task>>::value_type(ts_ms, slist<task>()));
-        pr.first->second.add(timer);
+        _local_timer_tasks.add(timer, ts_ms, now_ms);
     }
 }
 
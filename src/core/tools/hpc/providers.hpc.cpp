@@ -37,9 +37,11 @@
 #include "hpc_task_queue.h"
 #include "hpc_tail_logger.h"
 #include "hpc_logger.h"
+#include "hpc_binary_logger.h"
 #include "hpc_aio_provider.h"
 #include "hpc_network_provider.h"
 #include "hpc_env_provider.h"
+#include "hpc_timer_service.h"
 #include "mix_all_io_looper.h"
 
 namespace dsn {
@@ -48,9 +50,12 @@ void register_hpc_providers()
 {
     register_component_provider<hpc_tail_logger>("dsn::tools::hpc_tail_logger");
     register_component_provider<hpc_logger>("dsn::tools::hpc_logger");
+    register_component_provider<hpc_binary_logger>("dsn::tools::hpc_binary_logger");
     register_component_provider<hpc_task_queue>("dsn::tools::hpc_task_queue");
     register_component_provider<hpc_task_priority_queue>("dsn::tools::hpc_task_priority_queue");
     register_component_provider<hpc_concurrent_task_queue>("dsn::tools::hpc_concurrent_task_queue");
+    register_component_provider<hpc_work_stealing_task_queue>(
+        "dsn::tools::hpc_work_stealing_task_queue");
     register_component_provider<hpc_env_provider>("dsn::tools::hpc_env_provider");
 
     register_component_provider<hpc_aio_provider>("dsn::tools::hpc_aio_provider");
@@ -58,6 +63,7 @@ void register_hpc_providers()
     register_component_provider<io_looper_task_queue>("dsn::tools::io_looper_task_queue");
     register_component_provider<io_looper_task_worker>("dsn::tools::io_looper_task_worker");
     register_component_provider<io_looper_timer_service>("dsn::tools::io_looper_timer_service");
+    register_component_provider<hpc_timer_service>("dsn::tools::hpc_timer_service");
 }
 }
 }
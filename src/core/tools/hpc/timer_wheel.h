@@ -0,0 +1,199 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015 Microsoft Corporation
+ *
+ * -=- Robust Distributed System Nucleus (rDSN) -=-
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * Description:
+ *     hierarchical timing wheel with O(1) insertion, used by io_looper for timers
+ *
+ * Revision history:
+ *     xxxx-xx-xx, author, first version
+ *     xxxx-xx-xx, author, fix bug about xxx
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace dsn {
+namespace tools {
+//
+// the wheel has 1ms resolution and 5 levels: the first level has 256 slots
+// for the next 256 ms, and each of the following levels has 64 slots that
+// each cover all the slots of the previous level (up to about 49 days, longer
+// timeouts are clamped), similar to the linux kernel timers.
+//
+// items in an upper level are cascaded down when the lower levels wrap around,
+// so every item is moved at most once per level. cancellation is not supported
+// here as the tasks are cancelled lazily by their states when they are fired.
+//
+// the wheel is not thread-safe.
+//
+template <typename T>
+class timer_wheel
+{
+public:
+    timer_wheel() : _current_ms(0), _count(0) {}
+
+    // add an item that expires at expire_ms, now_ms is only used to
+    // initialize the wheel clock when the wheel is empty
+    void add(T *item, uint64_t expire_ms, uint64_t now_ms)
+    {
+        if (_count == 0 && now_ms > _current_ms)
+            _current_ms = now_ms;
+
+        place(item, expire_ms);
+        _count++;
+    }
+
+    // fire all the items that expire before or at now_ms,
+    // callback is invoked as callback(T* item)
+    template <typename TCallback>
+    void advance(uint64_t now_ms, TCallback &&callback)
+    {
+        while (_current_ms <= now_ms) {
+            if (_count == 0) {
+                _current_ms = now_ms + 1;
+                break;
+            }
+
+            int idx = static_cast<int>(_current_ms & LEVEL0_MASK);
+            if (idx == 0) {
+                // wrap around, cascade upper levels
+                for (int level = 1; level < LEVEL_COUNT; ++level) {
+                    int lidx = level_index(_current_ms, level);
+                    cascade(level, lidx);
+                    if (lidx != 0)
+                        break;
+                }
+            }
+
+            auto &slot = _slots[0][idx];
+            if (!slot.empty()) {
+                _firing.swap(slot);
+                _count -= _firing.size();
+                for (auto &e : _firing) {
+                    callback(e.second);
+                }
+                _firing.clear();
+            }
+
+            _current_ms++;
+        }
+    }
+
+    // a lower bound of when the next item expires: the first non-empty slot
+    // of the first level before it wraps around, or the wrap-around itself
+    // where the upper levels are cascaded, or UINT64_MAX when the wheel is empty
+    uint64_t next_expire_ms() const
+    {
+        if (_count == 0)
+            return UINT64_MAX;
+
+        // upper levels are cascaded before this tick is fired
+        if ((_current_ms & LEVEL0_MASK) == 0)
+            return _current_ms;
+
+        uint64_t wrap_ms = (_current_ms | LEVEL0_MASK) + 1;
+        for (uint64_t ms = _current_ms; ms < wrap_ms; ++ms) {
+            if (!_slots[0][ms & LEVEL0_MASK].empty())
+                return ms;
+        }
+        return wrap_ms;
+    }
+
+    size_t size() const { return _count; }
+    bool empty() const { return _count == 0; }
+
+private:
+    enum
+    {
+        LEVEL_COUNT = 5,
+        LEVEL0_BITS = 8,
+        LEVELN_BITS = 6,
+        LEVEL0_SIZE = 1 << LEVEL0_BITS,
+        LEVELN_SIZE = 1 << LEVELN_BITS,
+        LEVEL0_MASK = LEVEL0_SIZE - 1,
+        LEVELN_MASK = LEVELN_SIZE - 1
+    };
+
+    typedef std::vector<std::pair<uint64_t, T *>> slot_t; // expire_ms => item
+
+    static int level_shift(int level)
+    {
+        return level == 0 ? 0 : LEVEL0_BITS + (level - 1) * LEVELN_BITS;
+    }
+
+    static int level_index(uint64_t ts_ms, int level)
+    {
+        return level == 0 ? static_cast<int>(ts_ms & LEVEL0_MASK)
+                          : static_cast<int>((ts_ms >> level_shift(level)) & LEVELN_MASK);
+    }
+
+    void place(T *item, uint64_t expire_ms)
+    {
+        // already expired items are fired on the next tick
+        if (expire_ms < _current_ms)
+            expire_ms = _current_ms;
+
+        uint64_t delta = expire_ms - _current_ms;
+        int level = 0;
+        while (level < LEVEL_COUNT - 1 && delta >= (1ULL << level_shift(level + 1))) {
+            level++;
+        }
+
+        uint64_t max_delta = (1ULL << level_shift(LEVEL_COUNT)) - 1;
+        if (delta > max_delta) {
+            expire_ms = _current_ms + max_delta;
+        }
+
+        _slots[level][level_index(expire_ms, level)].emplace_back(expire_ms, item);
+    }
+
+    void cascade(int level, int idx)
+    {
+        auto &slot = _slots[level][idx];
+        if (slot.empty())
+            return;
+
+        _cascading.swap(slot);
+        for (auto &e : _cascading) {
+            place(e.second, e.first);
+        }
+        _cascading.clear();
+    }
+
+private:
+    uint64_t _current_ms; // the next tick to be fired
+    size_t _count;
+    slot_t _slots[LEVEL_COUNT][LEVEL0_SIZE]; // only LEVELN_SIZE slots are used for upper levels
+    slot_t _firing;
+    slot_t _cascading;
+};
+}
+}
@@ -57,6 +57,9 @@ replication_options::replication_options()
     max_mutation_count_in_prepare_list = 110;
     mutation_2pc_min_replica_count = 2;
 
+    secondary_read_disabled = false;
+    secondary_read_lease_ms = 20000;
+
     group_check_disabled = false;
     group_check_interval_ms = 10000;
 
@@ -90,10 +93,14 @@ replication_options::replication_options()
     log_shared_file_size_mb = 32;
     log_shared_file_count_limit = 100;
     log_shared_batch_buffer_kb = 0;
+    log_shared_group_commit_delay_ms = 0;
+    log_shared_stream_count = 1;
     log_shared_force_flush = false;
+    log_shared_parallel_replay_disabled = false;
 
     config_sync_disabled = false;
     config_sync_interval_ms = 30000;
+    config_sync_full_interval = 10;
 
     lb_interval_ms = 10000;
 
@@ -294,6 +301,18 @@ void replication_options::initialize()
         mutation_2pc_min_replica_count,
         "minimum number of alive replicas under which write is allowed");
 
+    secondary_read_disabled =
+        dsn_config_get_value_bool("replication",
+                                  "secondary_read_disabled",
+                                  secondary_read_disabled,
+                                  "whether bounded-staleness reads on secondaries are disabled");
+    secondary_read_lease_ms = (int32_t)dsn_config_get_value_uint64(
+        "replication",
+        "secondary_read_lease_ms",
+        secondary_read_lease_ms,
+        "a secondary stops serving reads when it has heard nothing from the primary for this "
+        "long, should be larger than group_check_interval_ms");
+
     group_check_disabled = dsn_config_get_value_bool("replication",
                                                      "group_check_disabled",
                                                      group_check_disabled,
@@ -429,11 +448,31 @@ void replication_options::initialize()
                                          "log_shared_batch_buffer_kb",
                                          log_shared_batch_buffer_kb,
                                          "shared log buffer size (KB) for batching incoming logs");
+    log_shared_group_commit_delay_ms = (int)dsn_config_get_value_uint64(
+        "replication",
+        "log_shared_group_commit_delay_ms",
+        log_shared_group_commit_delay_ms,
+        "max delay (ms) of writing shared log for batching incoming logs, the write is issued "
+        "earlier when log_shared_batch_buffer_kb is reached, 0 means writing immediately");
+    log_shared_stream_count = (int)dsn_config_get_value_uint64(
+        "replication",
+        "log_shared_stream_count",
+        log_shared_stream_count,
+        "count of independent shared log streams, the first one is in slog_dir and the others "
+        "are in 'slog.<index>' beside data_dirs in turn, each replica writes to one of them");
+    if (log_shared_stream_count < 1) {
+        log_shared_stream_count = 1;
+    }
     log_shared_force_flush =
         dsn_config_get_value_bool("replication",
                                   "log_shared_force_flush",
                                   log_shared_force_flush,
                                   "when write shared log, whether to flush file after write done");
+    log_shared_parallel_replay_disabled = dsn_config_get_value_bool(
+        "replication",
+        "log_shared_parallel_replay_disabled",
+        log_shared_parallel_replay_disabled,
+        "whether to disable replaying shared log of different replicas in parallel on startup");
 
     config_sync_disabled = dsn_config_get_value_bool(
         "replication",
@@ -445,6 +484,13 @@ void replication_options::initialize()
         "config_sync_interval_ms",
         config_sync_interval_ms,
         "every this period(ms) the replica syncs replica configuration with the meta server");
+    config_sync_full_interval = (int)dsn_config_get_value_uint64(
+        "replication",
+        "config_sync_full_interval",
+        config_sync_full_interval,
+        "every this number of config syncs, the replica server sends all its stored replicas "
+        "and gets all the partitions it serves, the others only get the changed ones; "
+        "1 means every sync is full");
 
     lb_interval_ms = (int)dsn_config_get_value_uint64(
         "replication",
@@ -73,6 +73,9 @@ public:
     int32_t max_mutation_count_in_prepare_list;
     int32_t mutation_2pc_min_replica_count;
 
+    bool secondary_read_disabled;
+    int32_t secondary_read_lease_ms;
+
     bool group_check_disabled;
     int32_t group_check_interval_ms;
 
@@ -106,10 +109,14 @@ public:
     int32_t log_shared_file_size_mb;
     int32_t log_shared_file_count_limit;
     int32_t log_shared_batch_buffer_kb;
+    int32_t log_shared_group_commit_delay_ms;
+    int32_t log_shared_stream_count;
     bool log_shared_force_flush;
+    bool log_shared_parallel_replay_disabled;
 
     bool config_sync_disabled;
     int32_t config_sync_interval_ms;
+    int32_t config_sync_full_interval;
 
     int32_t lb_interval_ms;
 
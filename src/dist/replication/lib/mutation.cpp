@@ -109,14 +109,13 @@ void mutation::add_client_request(task_code code, dsn_message_t request)
         update.serialization_type = dsn_msg_get_serialize_format(request);
         dsn_msg_add_ref(request); // released on dctor
 
-        void *ptr;
-        size_t size;
-        bool r = dsn_msg_read_next(request, &ptr, &size);
+        // take a shared reference on the request buffer instead of a raw pointer, so that the
+        // payload can be attached to prepare messages without copy (see write_to)
+        bool r = ((::dsn::message_ex *)request)->read_next(update.data);
         dassert(r, "payload is not present");
         dsn_msg_read_commit(request, 0); // so we can re-read the request buffer in replicated app
-        update.data.assign((char *)ptr, 0, (int)size);
 
-        _appro_data_bytes += sizeof(int) + (int)size; // data size
+        _appro_data_bytes += sizeof(int) + update.data.length(); // data size
     } else {
         update.code = RPC_REPLICATION_WRITE_EMPTY;
         _appro_data_bytes += sizeof(int); // empty data size
@@ -131,29 +130,50 @@ void mutation::write_to(std::function<void(const blob &)> inserter) const
 {
     binary_writer writer(1024);
     write_mutation_header(writer, data.header);
-    writer.write_pod(static_cast<int>(data.updates.size()));
+    write_update_descriptors(writer);
+    inserter(writer.get_buffer());
     for (const mutation_update &update : data.updates) {
-        // write task_code as string to make it cross-process compatible.
-        // avoid memory copy, equal to writer.write(std::string)
-        const char *cstr = update.code.to_string();
-        int len = static_cast<int>(strlen(cstr));
-        writer.write_pod(len);
-        if (len > 0)
-            writer.write(cstr, len);
+        inserter(update.data);
+    }
+}
 
-        writer.write_pod(static_cast<int>(update.serialization_type));
+void mutation::write_to(binary_writer &writer, dsn_message_t to) const
+{
+    write_mutation_header(writer, data.header);
 
-        writer.write_pod(static_cast<int>(update.data.length()));
+    if (to != nullptr) {
+        // the header is written per message as the ballot and log offset may change when
+        // the mutation is re-prepared, while the update descriptors and payloads are encoded
+        // only once and then shared by reference among all the messages
+        writer.flush();
+        for (const blob &bb : encoded_updates()) {
+            ((::dsn::message_ex *)to)->write_append(bb);
+        }
+        return;
     }
-    inserter(writer.get_buffer());
+
+    write_update_descriptors(writer);
     for (const mutation_update &update : data.updates) {
-        inserter(update.data);
+        writer.write(update.data.data(), update.data.length());
     }
 }
 
-void mutation::write_to(binary_writer &writer, dsn_message_t /*to*/) const
+const std::vector<blob> &mutation::encoded_updates() const
+{
+    if (_encoded_updates.empty()) {
+        binary_writer writer(256);
+        write_update_descriptors(writer);
+        _encoded_updates.reserve(data.updates.size() + 1);
+        _encoded_updates.push_back(writer.get_buffer());
+        for (const mutation_update &update : data.updates) {
+            _encoded_updates.push_back(update.data);
+        }
+    }
+    return _encoded_updates;
+}
+
+void mutation::write_update_descriptors(binary_writer &writer) const
 {
-    write_mutation_header(writer, data.header);
     writer.write_pod(static_cast<int>(data.updates.size()));
     for (const mutation_update &update : data.updates) {
         // write task_code as string to make it cross-process compatible.
@@ -168,10 +188,6 @@ void mutation::write_to(binary_writer &writer, dsn_message_t /*to*/) const
 
         writer.write_pod(static_cast<int>(update.data.length()));
     }
-    // TODO(qinzuoyan): directly append buffer to message to avoid memory copy
-    for (const mutation_update &update : data.updates) {
-        writer.write(update.data.data(), update.data.length());
-    }
 }
 
 /*static*/ mutation_ptr mutation::read_from(binary_reader &reader, dsn_message_t from)
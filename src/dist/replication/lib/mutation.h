@@ -119,6 +119,9 @@ public:
     //   - the private log may be transfered to other node with different program
     //   - the private/shared log may be replayed by different program when server restart
     void write_to(std::function<void(const blob &)> inserter) const;
+    // if "to" is not null, "writer" must be the write stream of "to", and the update payloads
+    // are appended to the message by reference rather than copied, so one mutation can be
+    // fanned out to multiple replicas with the body encoded only once
     void write_to(binary_writer &writer, dsn_message_t to) const;
     static mutation_ptr read_from(binary_reader &reader, dsn_message_t from);
 
@@ -134,6 +137,11 @@ public:
     // used by pending mutation queue only
     mutation *next;
 
+private:
+    // encoded update descriptors followed by the update payloads, built on first use
+    const std::vector<blob> &encoded_updates() const;
+    void write_update_descriptors(binary_writer &writer) const;
+
 private:
     union
     {
@@ -150,6 +158,7 @@ private:
     ::dsn::task_ptr _log_task;
     node_tasks _prepare_or_commit_tasks;
     std::vector<dsn_message_t> _prepare_requests; // may combine duplicate requests
+    mutable std::vector<blob> _encoded_updates;   // shared by all prepare messages
     char _name[60];                               // app_id.partition_index.ballot.decree
     int _appro_data_bytes;
     uint64_t _create_ts_ns; // for profiling
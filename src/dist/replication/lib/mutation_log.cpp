@@ -40,6 +40,8 @@
 #include "replica.h"
 #include <dsn/utility/filesystem.h>
 #include <dsn/utility/crc.h>
+#include <deque>
+#include <unordered_map>
 
 namespace dsn {
 namespace replication {
@@ -66,6 +68,7 @@ using namespace ::dsn::service;
         _pending_write_callbacks.reset(new callbacks());
         _pending_write_mutations.reset(new mutations());
         _pending_write_start_offset = mark_new_offset(0, true).second;
+        _pending_write_start_time_ms = dsn_now_ms();
     }
 
     // save mutations
@@ -85,13 +88,46 @@ using namespace ::dsn::service;
 
     // start to write if possible
     if (!_is_writing.load(std::memory_order_acquire)) {
-        write_pending_mutations(true);
+        write_pending_mutations_or_delay();
     } else {
         _slock.unlock();
     }
     return cb;
 }
 
+void mutation_log_shared::write_pending_mutations_or_delay()
+{
+    if (_group_commit_delay_ms == 0 ||
+        (_group_commit_bytes > 0 &&
+         static_cast<uint32_t>(_pending_write->size()) >= _group_commit_bytes) ||
+        _pending_write_start_time_ms + _group_commit_delay_ms <= dsn_now_ms()) {
+        write_pending_mutations(true);
+        return;
+    }
+
+    if (!_group_commit_timer_scheduled) {
+        _group_commit_timer_scheduled = true;
+        uint64_t delay_ms = _pending_write_start_time_ms + _group_commit_delay_ms - dsn_now_ms();
+        tasking::enqueue(LPC_MUTATION_LOG_PENDING_TIMER,
+                         this,
+                         [this]() { on_group_commit_timer(); },
+                         0,
+                         std::chrono::milliseconds(delay_ms));
+    }
+    _slock.unlock();
+}
+
+void mutation_log_shared::on_group_commit_timer()
+{
+    _slock.lock();
+    _group_commit_timer_scheduled = false;
+    if (!_is_writing.load(std::memory_order_acquire) && _pending_write) {
+        write_pending_mutations(true);
+    } else {
+        _slock.unlock();
+    }
+}
+
 void mutation_log_shared::flush() { flush_internal(-1); }
 
 void mutation_log_shared::flush_once() { flush_internal(1); }
@@ -199,7 +235,7 @@ void mutation_log_shared::write_pending_mutations(bool release_lock_required)
                 _slock.lock();
 
                 if (!_is_writing.load(std::memory_order_acquire) && _pending_write) {
-                    write_pending_mutations(true);
+                    write_pending_mutations_or_delay();
                 } else {
                     _slock.unlock();
                 }
@@ -435,6 +471,7 @@ mutation_log::mutation_log(const std::string &dir, int32_t max_log_file_mb, gpid
     _min_log_file_size_in_bytes = _max_log_file_size_in_bytes / 10;
     _owner_replica = r;
     _private_gpid = gpid;
+    _parallel_replay = false;
 
     if (r) {
         dassert(_private_gpid == r->get_gpid(),
@@ -635,6 +672,8 @@ error_code mutation_log::open(replay_callback read_callback,
             }
 
             if (ret) {
+                // the callback may be invoked concurrently for different gpids
+                zauto_lock l(_lock);
                 this->update_max_decree_no_lock(mu->data.header.pid, mu->data.header.decree);
                 if (this->_is_private) {
                     this->update_max_commit_on_disk_no_lock(mu->data.header.last_committed_decree);
@@ -643,7 +682,8 @@ error_code mutation_log::open(replay_callback read_callback,
 
             return ret;
         },
-        end_offset);
+        end_offset,
+        _parallel_replay);
 
     if (ERR_OK == err) {
         _global_start_offset =
@@ -884,6 +924,297 @@ std::pair<log_file_ptr, int64_t> mutation_log::mark_new_offset(size_t size,
     return err;
 }
 
+class mutation_log::replay_pipeline
+{
+public:
+    explicit replay_pipeline(replay_callback callback)
+        : _callback(std::move(callback)),
+          _start_ns(dsn_now_ns()),
+          _block_count(0),
+          _mutation_count(0),
+          _byte_count(0),
+          _end_offset(0)
+    {
+    }
+
+    ~replay_pipeline()
+    {
+        flush();
+        wait_applied();
+    }
+
+    void start(int64_t end_offset)
+    {
+        _end_offset = end_offset;
+        _err = ERR_OK;
+    }
+
+    // push a block read from the log file starting at 'start_offset', the block is then
+    // crc-checked (if 'check_crc') and decoded asynchronously
+    error_code push(const blob &bb, uint32_t init_crc, uint32_t body_crc, bool check_crc,
+                    int64_t start_offset)
+    {
+        block_ptr blk(new block());
+        blk->data = bb;
+        blk->init_crc = init_crc;
+        blk->body_crc = body_crc;
+        blk->check_crc = check_crc;
+        blk->start_offset = start_offset;
+        blk->end_offset = start_offset;
+        blk->decode_task = tasking::enqueue(LPC_REPLICATION_LOG_REPLAY_DECODE,
+                                            nullptr,
+                                            [blk]() { decode(*blk); },
+                                            static_cast<int>(_block_count++));
+        _byte_count += bb.length();
+        _decoding.push_back(std::move(blk));
+
+        while (_err == ERR_OK && _decoding.size() > MAX_DECODING_BLOCK_COUNT) {
+            dispatch_front();
+        }
+        return _err;
+    }
+
+    // dispatch all the pushed blocks, returns the first error met
+    error_code flush()
+    {
+        while (!_decoding.empty()) {
+            if (_err == ERR_OK) {
+                dispatch_front();
+            } else {
+                // the replay is already stopped, drop the remaining blocks
+                _decoding.front()->decode_task->wait();
+                _decoding.pop_front();
+            }
+        }
+        return _err;
+    }
+
+    // wait until all the dispatched mutations are applied
+    void wait_applied()
+    {
+        for (auto &kv : _queues) {
+            if (kv.second->apply_task != nullptr) {
+                kv.second->apply_task->wait();
+            }
+        }
+    }
+
+    int64_t end_offset() const { return _end_offset; }
+
+    void report(size_t file_count) const
+    {
+        uint64_t elapsed_ms = (dsn_now_ns() - _start_ns) / 1000000;
+        ddebug("parallel log replay done, files = %d, blocks = %" PRId64 ", mutations = %" PRId64
+               ", gpids = %d, size = %" PRId64 " bytes, time = %" PRIu64
+               " ms, throughput = %.2f MB/s",
+               static_cast<int>(file_count),
+               _block_count,
+               _mutation_count,
+               static_cast<int>(_queues.size()),
+               _byte_count,
+               elapsed_ms,
+               static_cast<double>(_byte_count) / 1024.0 / 1024.0 /
+                   (elapsed_ms == 0 ? 0.001 : elapsed_ms / 1000.0));
+    }
+
+private:
+    enum
+    {
+        MAX_DECODING_BLOCK_COUNT = 16,
+        MAX_PENDING_MUTATION_COUNT = 1024
+    };
+
+    typedef std::deque<std::pair<int, mutation_ptr>> mutation_queue;
+
+    struct block
+    {
+        blob data;
+        uint32_t init_crc;
+        uint32_t body_crc;
+        bool check_crc;
+        int64_t start_offset;
+        int64_t end_offset; // offset after the last valid mutation of the block
+        error_code err;
+        std::vector<std::pair<int, mutation_ptr>> mutations;
+        task_ptr decode_task;
+    };
+    typedef std::shared_ptr<block> block_ptr;
+
+    struct gpid_queue
+    {
+        zlock lock;
+        mutation_queue mutations;
+        bool running = false;
+        task_ptr apply_task; // only touched by the dispatching thread
+    };
+
+    static void decode(block &blk)
+    {
+        if (blk.check_crc && !log_file::check_log_block_crc(blk.data, blk.init_crc, blk.body_crc)) {
+            // the replay stops before the header of the corrupted block
+            blk.end_offset = blk.start_offset - static_cast<int64_t>(sizeof(log_block_header));
+            derror("crc checking failed for log block at offset %" PRId64, blk.end_offset);
+            blk.err = ERR_INVALID_DATA;
+            return;
+        }
+
+        binary_reader reader(blk.data);
+        while (!reader.is_eof()) {
+            auto old_size = reader.get_remaining_size();
+            mutation_ptr mu = mutation::read_from(reader, nullptr);
+            dassert(nullptr != mu, "");
+            mu->set_logged();
+
+            if (mu->data.header.log_offset != blk.end_offset) {
+                derror("offset mismatch in log entry and mutation %" PRId64 " vs %" PRId64,
+                       blk.end_offset,
+                       mu->data.header.log_offset);
+                blk.err = ERR_INVALID_DATA;
+                return;
+            }
+
+            int log_length = old_size - reader.get_remaining_size();
+            blk.mutations.emplace_back(log_length, std::move(mu));
+            blk.end_offset += log_length;
+        }
+    }
+
+    void dispatch_front()
+    {
+        block_ptr blk = std::move(_decoding.front());
+        _decoding.pop_front();
+        blk->decode_task->wait();
+
+        // the mutations decoded before an error are still valid, same as the serial replay
+        for (auto &m : blk->mutations) {
+            gpid pid = m.second->data.header.pid;
+            auto &q = _queues[pid];
+            if (q == nullptr) {
+                q.reset(new gpid_queue());
+            }
+
+            bool start_apply;
+            size_t pending;
+            {
+                zauto_lock l(q->lock);
+                q->mutations.push_back(std::move(m));
+                pending = q->mutations.size();
+                start_apply = !q->running;
+                q->running = true;
+            }
+
+            if (start_apply) {
+                gpid_queue *pq = q.get();
+                q->apply_task = tasking::enqueue(LPC_REPLICATION_LOG_REPLAY_APPLY,
+                                                 nullptr,
+                                                 [this, pq]() { apply(*pq); },
+                                                 gpid_to_thread_hash(pid));
+            } else if (pending > MAX_PENDING_MUTATION_COUNT) {
+                // back pressure, the running task drains the whole queue
+                q->apply_task->wait();
+            }
+            _mutation_count++;
+        }
+
+        _end_offset = blk->end_offset;
+        _err = blk->err;
+    }
+
+    void apply(gpid_queue &q)
+    {
+        mutation_queue mutations;
+        while (true) {
+            {
+                zauto_lock l(q.lock);
+                if (q.mutations.empty()) {
+                    q.running = false;
+                    return;
+                }
+                mutations.swap(q.mutations);
+            }
+
+            for (auto &m : mutations) {
+                _callback(m.first, m.second);
+            }
+            mutations.clear();
+        }
+    }
+
+private:
+    replay_callback _callback;
+    uint64_t _start_ns;
+    int64_t _block_count;
+    int64_t _mutation_count;
+    int64_t _byte_count;
+
+    std::deque<block_ptr> _decoding;
+    std::unordered_map<gpid, std::unique_ptr<gpid_queue>> _queues;
+    int64_t _end_offset;
+    error_code _err;
+};
+
+/*static*/ error_code mutation_log::replay_parallel(log_file_ptr log,
+                                                    replay_pipeline &pipeline,
+                                                    /*out*/ int64_t &end_offset)
+{
+    end_offset = log->start_offset();
+    ddebug("start to replay mutation log %s in parallel, offset = [%" PRId64 ", %" PRId64
+           "), size = %" PRId64,
+           log->path().c_str(),
+           log->start_offset(),
+           log->end_offset(),
+           log->end_offset() - log->start_offset());
+
+    ::dsn::blob bb;
+    uint32_t init_crc, body_crc;
+    log->reset_stream();
+    error_code err = log->read_next_log_block(bb, init_crc, body_crc);
+    if (err != ERR_OK) {
+        return err;
+    }
+    if (!log_file::check_log_block_crc(bb, init_crc, body_crc)) {
+        derror("crc checking failed");
+        return ERR_INVALID_DATA;
+    }
+    end_offset += sizeof(log_block_header);
+
+    // read file header
+    binary_reader reader(bb);
+    int header_size = log->read_file_header(reader);
+    if (!log->is_right_header()) {
+        return ERR_INVALID_DATA;
+    }
+    end_offset += header_size;
+
+    pipeline.start(end_offset);
+    err = pipeline.push(bb.range(header_size), init_crc, body_crc, false, end_offset);
+    end_offset += bb.length() - header_size;
+
+    while (err == ERR_OK) {
+        err = log->read_next_log_block(bb, init_crc, body_crc);
+        if (err != ERR_OK) {
+            // if an error occurs in an log mutation block, then the replay log is stopped
+            break;
+        }
+
+        end_offset += sizeof(log_block_header);
+        err = pipeline.push(bb, init_crc, body_crc, true, end_offset);
+        end_offset += bb.length();
+    }
+
+    // an error met in decoding precedes the read error as it happens earlier in the log
+    error_code decode_err = pipeline.flush();
+    if (decode_err != ERR_OK) {
+        err = decode_err;
+    }
+    end_offset = pipeline.end_offset();
+
+    ddebug("finish to replay mutation log %s in parallel, err = %s",
+           log->path().c_str(),
+           err.to_string());
+    return err;
+}
+
 /*static*/ error_code mutation_log::replay(std::vector<std::string> &log_files,
                                            replay_callback callback,
                                            /*out*/ int64_t &end_offset)
@@ -912,7 +1243,8 @@ std::pair<log_file_ptr, int64_t> mutation_log::mark_new_offset(size_t size,
 
 /*static*/ error_code mutation_log::replay(std::map<int, log_file_ptr> &logs,
                                            replay_callback callback,
-                                           /*out*/ int64_t &end_offset)
+                                           /*out*/ int64_t &end_offset,
+                                           bool parallel)
 {
     int64_t g_start_offset = 0;
     int64_t g_end_offset = 0;
@@ -936,6 +1268,7 @@ std::pair<log_file_ptr, int64_t> mutation_log::mark_new_offset(size_t size,
 
     end_offset = g_start_offset;
 
+    std::unique_ptr<replay_pipeline> pipeline(parallel ? new replay_pipeline(callback) : nullptr);
     for (auto &kv : logs) {
         log_file_ptr &log = kv.second;
 
@@ -947,7 +1280,11 @@ std::pair<log_file_ptr, int64_t> mutation_log::mark_new_offset(size_t size,
         }
 
         last = log;
-        err = mutation_log::replay(log, callback, end_offset);
+        if (pipeline != nullptr) {
+            err = mutation_log::replay_parallel(log, *pipeline, end_offset);
+        } else {
+            err = mutation_log::replay(log, callback, end_offset);
+        }
 
         log->close();
 
@@ -963,6 +1300,11 @@ std::pair<log_file_ptr, int64_t> mutation_log::mark_new_offset(size_t size,
         }
     }
 
+    if (pipeline != nullptr) {
+        pipeline->wait_applied();
+        pipeline->report(logs.size());
+    }
+
     if (err == ERR_OK || err == ERR_HANDLE_EOF) {
         // the log may still be written when used for learning
         dassert(g_end_offset <= end_offset,
@@ -2038,7 +2380,8 @@ void log_file::flush() const
     }
 }
 
-error_code log_file::read_next_log_block(/*out*/ ::dsn::blob &bb)
+error_code log_file::read_next_log_block_no_crc(/*out*/ log_block_header &hdr,
+                                                /*out*/ ::dsn::blob &bb)
 {
     dassert(_is_read, "log file must be of read mode");
     auto err = _stream->read_next(sizeof(log_block_header), bb);
@@ -2055,7 +2398,7 @@ error_code log_file::read_next_log_block(/*out*/ ::dsn::blob &bb)
 
         return err;
     }
-    log_block_header hdr = *reinterpret_cast<const log_block_header *>(bb.data());
+    hdr = *reinterpret_cast<const log_block_header *>(bb.data());
 
     if (hdr.magic != 0xdeadbeef) {
         derror("invalid data header magic: 0x%x", hdr.magic);
@@ -2077,6 +2420,17 @@ error_code log_file::read_next_log_block(/*out*/ ::dsn::blob &bb)
         return err;
     }
 
+    return ERR_OK;
+}
+
+error_code log_file::read_next_log_block(/*out*/ ::dsn::blob &bb)
+{
+    log_block_header hdr;
+    auto err = read_next_log_block_no_crc(hdr, bb);
+    if (err != ERR_OK) {
+        return err;
+    }
+
     auto crc = dsn::utils::crc32_calc(
         static_cast<const void *>(bb.data()), static_cast<size_t>(hdr.length), _crc32);
     if (crc != hdr.body_crc) {
@@ -2088,6 +2442,41 @@ error_code log_file::read_next_log_block(/*out*/ ::dsn::blob &bb)
     return ERR_OK;
 }
 
+error_code log_file::read_next_log_block(/*out*/ ::dsn::blob &bb,
+                                         /*out*/ uint32_t &init_crc,
+                                         /*out*/ uint32_t &body_crc)
+{
+    log_block_header hdr;
+    auto err = read_next_log_block_no_crc(hdr, bb);
+    if (err != ERR_OK) {
+        return err;
+    }
+
+    // the stream may return a block pointing to its internal read-ahead buffers, which are
+    // reused by the following reads, so make a copy as the block is consumed asynchronously
+    if (bb.buffer() == nullptr) {
+        std::shared_ptr<char> buffer(dsn::utils::make_shared_array<char>(bb.length()));
+        memcpy(buffer.get(), bb.data(), bb.length());
+        bb = blob(buffer, bb.length());
+    }
+
+    // the next block is chained from the expected crc, if this one turns out to be
+    // corrupted, the replay stops at this block anyway
+    init_crc = _crc32;
+    body_crc = static_cast<uint32_t>(hdr.body_crc);
+    _crc32 = body_crc;
+
+    return ERR_OK;
+}
+
+/*static*/ bool
+log_file::check_log_block_crc(const ::dsn::blob &bb, uint32_t init_crc, uint32_t body_crc)
+{
+    auto crc = dsn::utils::crc32_calc(
+        static_cast<const void *>(bb.data()), static_cast<size_t>(bb.length()), init_crc);
+    return crc == body_crc;
+}
+
 log_block *log_file::prepare_log_block()
 {
     log_block_header hdr;
@@ -174,6 +174,12 @@ public:
     error_code open(replay_callback read_callback,
                     io_failure_callback write_error_callback,
                     const std::map<gpid, decree> &replay_condition);
+
+    // replay on open with mutations of different gpids applied concurrently (see
+    // replay_parallel()), in which case 'read_callback' must be thread safe across gpids
+    // not thread safe, should be called before open
+    void set_parallel_replay(bool parallel) { _parallel_replay = parallel; }
+
     // close the log
     // thread safe
     void close();
@@ -312,7 +318,18 @@ private:
 
     static error_code replay(std::map<int, log_file_ptr> &log_files,
                              replay_callback callback,
-                             /*out*/ int64_t &end_offset);
+                             /*out*/ int64_t &end_offset,
+                             bool parallel = false);
+
+    // pipelined replay of one log file:
+    //  - log blocks are read ahead sequentially by the calling thread
+    //  - the blocks are crc-checked and decoded in parallel
+    //  - the mutations are dispatched in log order to per-gpid queues which are applied
+    //    concurrently, so the replay order is kept within each gpid
+    class replay_pipeline;
+    static error_code replay_parallel(log_file_ptr log,
+                                      replay_pipeline &pipeline,
+                                      /*out*/ int64_t &end_offset);
 
     // update max decree without lock
     void update_max_decree_no_lock(gpid gpid, decree d);
@@ -338,6 +355,7 @@ protected:
     int64_t _max_log_file_size_in_bytes;
     int64_t _min_log_file_size_in_bytes;
     bool _force_flush;
+    bool _parallel_replay;
 
 private:
     ///////////////////////////////////////////////
@@ -371,12 +389,24 @@ private:
 };
 typedef dsn::ref_ptr<mutation_log> mutation_log_ptr;
 
+//
+// the shared log groups the mutations appended while a write is in flight into the next write;
+// with group commit enabled (group_commit_delay_ms > 0), an idle log also waits for up to
+// 'group_commit_delay_ms' or until 'group_commit_bytes' are pending before issuing the write,
+// so that more mutations share one write (and one flush when 'force_flush' is set)
+//
 class mutation_log_shared : public mutation_log
 {
 public:
-    mutation_log_shared(const std::string &dir, int32_t max_log_file_mb, bool force_flush)
+    mutation_log_shared(const std::string &dir,
+                        int32_t max_log_file_mb,
+                        bool force_flush,
+                        uint32_t group_commit_bytes = 0,
+                        uint32_t group_commit_delay_ms = 0)
         : mutation_log(dir, max_log_file_mb, dsn::gpid(), nullptr), _is_writing(false),
-          _pending_write_start_offset(0), _force_flush(force_flush)
+          _pending_write_start_offset(0), _pending_write_start_time_ms(0),
+          _group_commit_timer_scheduled(false), _force_flush(force_flush),
+          _group_commit_bytes(group_commit_bytes), _group_commit_delay_ms(group_commit_delay_ms)
     {
     }
 
@@ -402,6 +432,15 @@ private:
     // if count <= 0, means flush until all data is on disk
     void flush_internal(int max_count);
 
+    // start to write the pending mutations if the group commit condition is met, or schedule
+    // a timer to write them when the group commit delay expires
+    // Preconditions:
+    // - _slock.locked() and it is released by this function
+    // - !_is_writing && _pending_write != nullptr
+    void write_pending_mutations_or_delay();
+
+    void on_group_commit_timer();
+
 private:
     // bufferring - only one concurrent write is allowed
     typedef std::vector<task_ptr> callbacks;
@@ -412,8 +451,12 @@ private:
     std::shared_ptr<callbacks> _pending_write_callbacks;
     std::shared_ptr<mutations> _pending_write_mutations;
     int64_t _pending_write_start_offset;
+    uint64_t _pending_write_start_time_ms;
+    bool _group_commit_timer_scheduled;
 
     bool _force_flush;
+    uint32_t _group_commit_bytes;
+    uint32_t _group_commit_delay_ms;
 };
 
 class mutation_log_private : public mutation_log
@@ -536,6 +579,16 @@ public:
     //  - other io errors caused by file read operator
     error_code read_next_log_block(/*out*/ ::dsn::blob &bb);
 
+    // same as read_next_log_block(bb), but the crc is not checked here, instead it is returned
+    // together with the crc chained from the previous block by 'init_crc' and 'body_crc', so
+    // that blocks can be checked in parallel by check_log_block_crc()
+    // the result 'bb' always owns its memory
+    error_code read_next_log_block(/*out*/ ::dsn::blob &bb,
+                                   /*out*/ uint32_t &init_crc,
+                                   /*out*/ uint32_t &body_crc);
+
+    static bool check_log_block_crc(const ::dsn::blob &bb, uint32_t init_crc, uint32_t body_crc);
+
     //
     // write routines
     //
@@ -598,6 +651,9 @@ private:
     // make private, user should create log_file through open_read() or open_write()
     log_file(const char *path, dsn_handle_t handle, int index, int64_t start_offset, bool is_read);
 
+    // read the next block without checking its crc
+    error_code read_next_log_block_no_crc(/*out*/ log_block_header &hdr, /*out*/ ::dsn::blob &bb);
+
 private:
     uint32_t _crc32;
     int64_t _start_offset; // start offset in the global space
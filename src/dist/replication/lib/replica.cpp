@@ -134,6 +134,11 @@ void replica::on_client_read(task_code code, dsn_message_t request)
         return;
     }
 
+    if (status() == partition_status::PS_SECONDARY) {
+        on_client_read_on_secondary(request);
+        return;
+    }
+
     if (status() != partition_status::PS_PRIMARY ||
 
         // a small window where the state is not the latest yet
@@ -156,7 +161,51 @@ void replica::on_client_read(task_code code, dsn_message_t request)
     }
 
     dassert(_app != nullptr, "");
+    uint64_t start_ns = dsn_now_ns();
+    _app->on_request(request);
+    _load_stats.on_read(dsn_msg_body_size(request), dsn_now_ns() - start_ns);
+}
+
+void replica::on_client_read_on_secondary(dsn_message_t request)
+{
+    dsn_msg_options_t opts;
+    dsn_msg_get_options(request, &opts);
+    if (opts.context.u.parameter_type != MSG_PARAM_READ_STALENESS) {
+        derror("%s: invalid status: partition_status=%s", name(), enum_to_string(status()));
+        response_client_message(true, request, ERR_INVALID_STATE);
+        return;
+    }
+
+    // the client goes to the primary on ERR_STALE_READ, rather than refreshing the config
+    if (_options->secondary_read_disabled) {
+        response_client_message(true, request, ERR_STALE_READ);
+        return;
+    }
+
+    // the staleness is measured against the committed decree of the primary, as carried by
+    // its prepares and group checks, which are no older than the lease
+    const secondary_context &ctx = _secondary_states;
+    uint64_t silent_ms = dsn_now_ms() - ctx.primary_contact_ms;
+    bool lease_valid = ctx.primary_contact_ballot == get_ballot() &&
+                       ctx.primary_committed_decree != invalid_decree &&
+                       silent_ms <= (uint64_t)_options->secondary_read_lease_ms;
+    decree staleness = lease_valid ? ctx.primary_committed_decree - last_committed_decree() : 0;
+    if (!lease_valid || staleness > static_cast<decree>(opts.context.u.parameter)) {
+        dwarn("%s: reject stale read, lease_valid = %s, silent_ms = %" PRIu64
+              ", staleness = %" PRId64 ", bound = %" PRIu64,
+              name(),
+              lease_valid ? "true" : "false",
+              silent_ms,
+              staleness,
+              (uint64_t)opts.context.u.parameter);
+        response_client_message(true, request, ERR_STALE_READ);
+        return;
+    }
+
+    dassert(_app != nullptr, "");
+    uint64_t start_ns = dsn_now_ns();
     _app->on_request(request);
+    _load_stats.on_read(dsn_msg_body_size(request), dsn_now_ns() - start_ns);
 }
 
 void replica::response_client_message(bool is_read, dsn_message_t request, error_code error)
@@ -232,7 +281,7 @@ void replica::check_state_completeness()
             last_durable_decree());
 
     /*
-    auto mind = _stub->_log->max_gced_decree(get_gpid(),
+    auto mind = _stub->shared_log(get_gpid())->max_gced_decree(get_gpid(),
     _app->init_info().init_offset_in_shared_log);
     dassert(mind <= last_durable_decree(), "%" PRId64 " VS %" PRId64, mind, last_durable_decree());
 
@@ -275,6 +324,9 @@ void replica::execute_mutation(mutation_ptr &mu)
                 _app->last_committed_decree(),
                 d);
         err = _app->apply_mutation(mu);
+        if (!mu->client_requests.empty()) {
+            _load_stats.on_write_committed(dsn_now_ns() - mu->create_ts_ns());
+        }
     } break;
 
     case partition_status::PS_SECONDARY:
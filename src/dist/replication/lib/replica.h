@@ -49,6 +49,7 @@
 #include "mutation_log.h"
 #include "prepare_list.h"
 #include "replica_context.h"
+#include "replica_load_stats.h"
 
 namespace dsn {
 namespace replication {
@@ -143,6 +144,7 @@ public:
     uint64_t last_checkpoint_generate_time_ms() const { return _last_checkpoint_generate_time_ms; }
     const char *name() const { return _name; }
     mutation_log_ptr private_log() const { return _private_log; }
+    replica_load_stats &load_stats() { return _load_stats; }
     const replication_options *options() const { return _options; }
     replica_stub *get_replica_stub() { return _stub; }
     bool verbose_commit_log() const;
@@ -157,6 +159,7 @@ private:
     // common helpers
     void init_state();
     void response_client_message(bool is_read, dsn_message_t request, error_code error);
+    void on_client_read_on_secondary(dsn_message_t request);
     void execute_mutation(mutation_ptr &mu);
     mutation_ptr new_mutation(decree decree);
 
@@ -185,13 +188,19 @@ private:
 
     /////////////////////////////////////////////////////////////////
     // learning
+    class learn_round;
     void init_learn(uint64_t signature);
-    void on_learn_reply(error_code err, learn_request &&req, learn_response &&resp);
-    void on_copy_remote_state_completed(error_code err,
-                                        size_t size,
-                                        uint64_t copy_start_time,
-                                        learn_request &&req,
-                                        learn_response &&resp);
+    // return true if the round goes on to copy the remote state, with copy_err set to the
+    // error to pass to on_copy_remote_state_completed without copying any file
+    bool on_learn_reply(error_code err,
+                        learn_request &req,
+                        learn_response &resp,
+                        /*out*/ error_code &copy_err);
+    error_code on_copy_remote_state_completed(error_code err,
+                                              size_t size,
+                                              uint64_t copy_start_time,
+                                              const learn_request &req,
+                                              const learn_response &resp);
     void on_learn_remote_state_completed(error_code err);
     void handle_learning_error(error_code err, bool is_local_error);
     error_code handle_learning_succeeded_on_primary(::dsn::rpc_address node,
@@ -256,10 +265,12 @@ private:
 
     /////////////////////////////////////////////////////////////////
     // cold backup
+    class backup_checkpoint_round;
     void generate_backup_checkpoint(cold_backup_context_ptr backup_context);
-    void trigger_async_checkpoint_for_backup(cold_backup_context_ptr backup_context);
-    void wait_async_checkpoint_for_backup(cold_backup_context_ptr backup_context);
-    void local_create_backup_checkpoint(cold_backup_context_ptr backup_context);
+    // the following return ERR_TRY_AGAIN if they should be retried later
+    error_code trigger_async_checkpoint_for_backup(cold_backup_context_ptr backup_context);
+    error_code wait_async_checkpoint_for_backup(cold_backup_context_ptr backup_context);
+    error_code local_create_backup_checkpoint(cold_backup_context_ptr backup_context);
     void send_backup_request_to_secondary(const backup_request &request);
     // set all cold_backup_state cancel/pause
     void set_backup_context_cancel();
@@ -353,6 +364,9 @@ private:
 
     // perf counters
     perf_counter_wrapper _counter_private_log_size;
+
+    // read/write load since the last config sync, reported to the meta server
+    replica_load_stats _load_stats;
 };
 typedef dsn::ref_ptr<replica> replica_ptr;
 }
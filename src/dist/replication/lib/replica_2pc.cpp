@@ -70,6 +70,7 @@ void replica::on_client_write(task_code code, dsn_message_t request)
     dinfo("%s: got write request from %s",
           name(),
           dsn_address_to_string(dsn_msg_from_address(request)));
+    _load_stats.on_write(dsn_msg_body_size(request));
     auto mu = _primary_states.write_queue.add_work(code, request, this);
     if (mu) {
         init_prepare(mu);
@@ -159,15 +160,16 @@ void replica::init_prepare(mutation_ptr &mu)
                 "invalid log offset, offset = %" PRId64,
                 mu->data.header.log_offset);
         dassert(mu->log_task() == nullptr, "");
-        mu->log_task() = _stub->_log->append(mu,
-                                             LPC_WRITE_REPLICATION_LOG,
-                                             this,
-                                             std::bind(&replica::on_append_log_completed,
-                                                       this,
-                                                       mu,
-                                                       std::placeholders::_1,
-                                                       std::placeholders::_2),
-                                             gpid_to_thread_hash(get_gpid()));
+        mu->log_task() = _stub->shared_log(get_gpid())->append(
+            mu,
+            LPC_WRITE_REPLICATION_LOG,
+            this,
+            std::bind(&replica::on_append_log_completed,
+                      this,
+                      mu,
+                      std::placeholders::_1,
+                      std::placeholders::_2),
+            gpid_to_thread_hash(get_gpid()));
         dassert(nullptr != mu->log_task(), "");
     }
 
@@ -196,6 +198,8 @@ void replica::send_prepare_message(::dsn::rpc_address addr,
         rpc_write_stream writer(msg);
         marshall(writer, get_gpid(), DSF_THRIFT_BINARY);
         marshall(writer, rconfig, DSF_THRIFT_BINARY);
+        // only the small per-target header is serialized here, the mutation body is encoded
+        // once and shared by all the prepare messages of this mutation
         mu->write_to(writer, msg);
     }
 
@@ -326,6 +330,9 @@ void replica::on_prepare(dsn_message_t request)
             "invalid status, %s VS %s",
             enum_to_string(rconfig.status),
             enum_to_string(status()));
+    if (partition_status::PS_SECONDARY == status()) {
+        _secondary_states.on_primary_contact(get_ballot(), mu->data.header.last_committed_decree);
+    }
     if (decree <= last_committed_decree()) {
         ack_prepare_message(ERR_OK, mu);
         return;
@@ -373,15 +380,16 @@ void replica::on_prepare(dsn_message_t request)
     }
 
     dassert(mu->log_task() == nullptr, "");
-    mu->log_task() = _stub->_log->append(mu,
-                                         LPC_WRITE_REPLICATION_LOG,
-                                         this,
-                                         std::bind(&replica::on_append_log_completed,
-                                                   this,
-                                                   mu,
-                                                   std::placeholders::_1,
-                                                   std::placeholders::_2),
-                                         gpid_to_thread_hash(get_gpid()));
+    mu->log_task() = _stub->shared_log(get_gpid())->append(
+        mu,
+        LPC_WRITE_REPLICATION_LOG,
+        this,
+        std::bind(&replica::on_append_log_completed,
+                  this,
+                  mu,
+                  std::placeholders::_1,
+                  std::placeholders::_2),
+        gpid_to_thread_hash(get_gpid()));
     dassert(nullptr != mu->log_task(), "");
 }
 
@@ -635,7 +643,7 @@ void replica::cleanup_preparing_mutations(bool wait)
             // make sure the buffers from mutations are valid for underlying aio
             //
             if (wait) {
-                _stub->_log->flush();
+                _stub->shared_log(get_gpid())->flush();
                 mu->wait_log_task();
             }
         }
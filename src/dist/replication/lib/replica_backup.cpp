@@ -8,6 +8,7 @@
 #include "mutation_log.h"
 #include "replica_stub.h"
 #include "../client_lib/block_service_manager.h"
+#include <dsn/cpp/coroutine.h>
 
 namespace dsn {
 namespace replication {
@@ -337,13 +338,67 @@ static bool backup_parse_dir_name(const char *name,
     }
 }
 
+// generate the backup checkpoint if it is not exist:
+// - trigger async checkpoint and wait it done in REPLICATION thread, check every 10 seconds
+// - copy the checkpoint to backup dir in REPLICATION_LONG thread, retry every 10 seconds
+// - complete_checkpoint() and continue with on_cold_backup() in REPLICATION thread
+class replica::backup_checkpoint_round : public coroutine
+{
+public:
+    backup_checkpoint_round(replica *r, cold_backup_context_ptr backup_context)
+        : coroutine(r), _r(r), _backup_context(std::move(backup_context))
+    {
+    }
+
+private:
+    void run() override
+    {
+        DSN_CO_BEGIN
+        _delay = std::chrono::milliseconds(0);
+        while (true) {
+            DSN_CO_AWAIT(await_task(
+                LPC_REPLICATION_COLD_BACKUP, gpid_to_thread_hash(_r->get_gpid()), _delay));
+            _err = _r->trigger_async_checkpoint_for_backup(_backup_context);
+            if (_err != ERR_TRY_AGAIN)
+                break;
+            _delay = std::chrono::seconds(10);
+        }
+        if (_err != ERR_OK)
+            DSN_CO_RETURN;
+
+        _delay = std::chrono::milliseconds(0);
+        while (true) {
+            DSN_CO_AWAIT(await_task(LPC_BACKGROUND_COLD_BACKUP, 0, _delay));
+            _err = _r->local_create_backup_checkpoint(_backup_context);
+            if (_err != ERR_TRY_AGAIN)
+                break;
+            _delay = std::chrono::seconds(10);
+        }
+        if (_err != ERR_OK)
+            DSN_CO_RETURN;
+
+        DSN_CO_AWAIT(
+            await_task(LPC_REPLICATION_COLD_BACKUP, gpid_to_thread_hash(_r->get_gpid())));
+        {
+            backup_response response;
+            _r->on_cold_backup(_backup_context->request, response);
+        }
+        DSN_CO_END
+    }
+
+    replica *_r;
+    cold_backup_context_ptr _backup_context;
+    std::chrono::milliseconds _delay;
+    error_code _err;
+};
+
 // run in REPLICATION_LONG thread
 // Effection:
 // - may ignore_checkpoint() if in invalid status
 // - may fail_checkpoint() if some error occurs
 // - may complete_checkpoint() and schedule on_cold_backup() if backup checkpoint dir is already
 // exist
-// - may schedule trigger_async_checkpoint_for_backup() if backup checkpoint dir is not exist
+// - may start backup_checkpoint_round if backup checkpoint dir is not exist
 void replica::generate_backup_checkpoint(cold_backup_context_ptr backup_context)
 {
     if (backup_context->status() != ColdBackupCheckpointing) {
@@ -417,11 +472,7 @@ void replica::generate_backup_checkpoint(cold_backup_context_ptr backup_context)
     } else {
         ddebug("%s: backup checkpoint not exist, start to trigger async checkpoint",
                backup_context->name);
-        tasking::enqueue(
-            LPC_REPLICATION_COLD_BACKUP,
-            this,
-            [this, backup_context]() { trigger_async_checkpoint_for_backup(backup_context); },
-            gpid_to_thread_hash(get_gpid()));
+        (new backup_checkpoint_round(this, backup_context))->start();
     }
 
     // clear related but not valid checkpoint
@@ -442,8 +493,8 @@ void replica::generate_backup_checkpoint(cold_backup_context_ptr backup_context)
 // Effection:
 // - may ignore_checkpoint() if in invalid status
 // - may fail_checkpoint() if some error occurs
-// - may trigger async checkpoint and invoke wait_async_checkpoint_for_backup()
-void replica::trigger_async_checkpoint_for_backup(cold_backup_context_ptr backup_context)
+// - may trigger async checkpoint and return wait_async_checkpoint_for_backup()
+error_code replica::trigger_async_checkpoint_for_backup(cold_backup_context_ptr backup_context)
 {
     check_hashed_access();
 
@@ -452,7 +503,7 @@ void replica::trigger_async_checkpoint_for_backup(cold_backup_context_ptr backup
                backup_context->name,
                cold_backup_status_to_string(backup_context->status()));
         backup_context->ignore_checkpoint();
-        return;
+        return ERR_INVALID_STATE;
     }
 
     if (status() != partition_status::PS_PRIMARY && status() != partition_status::PS_SECONDARY) {
@@ -460,7 +511,7 @@ void replica::trigger_async_checkpoint_for_backup(cold_backup_context_ptr backup
                backup_context->name,
                enum_to_string(status()));
         backup_context->ignore_checkpoint();
-        return;
+        return ERR_INVALID_STATE;
     }
 
     decree durable_decree = last_durable_decree();
@@ -510,16 +561,15 @@ void replica::trigger_async_checkpoint_for_backup(cold_backup_context_ptr backup
     }
 
     // after triggering init_checkpoint, we just wait until it finish
-    wait_async_checkpoint_for_backup(backup_context);
+    return wait_async_checkpoint_for_backup(backup_context);
 }
 
 // run in REPLICATION thread
 // Effection:
 // - may ignore_checkpoint() if in invalid status
-// - may delay some time and schedule trigger_async_checkpoint_for_backup() if async checkpoint not
-// completed
-// - may schedule local_create_backup_checkpoint if async checkpoint completed
-void replica::wait_async_checkpoint_for_backup(cold_backup_context_ptr backup_context)
+// - return ERR_TRY_AGAIN if async checkpoint not completed, so as to trigger it again later
+// - return ERR_OK if async checkpoint completed
+error_code replica::wait_async_checkpoint_for_backup(cold_backup_context_ptr backup_context)
 {
     check_hashed_access();
 
@@ -528,7 +578,7 @@ void replica::wait_async_checkpoint_for_backup(cold_backup_context_ptr backup_co
                backup_context->name,
                cold_backup_status_to_string(backup_context->status()));
         backup_context->ignore_checkpoint();
-        return;
+        return ERR_INVALID_STATE;
     }
 
     if (status() != partition_status::PS_PRIMARY && status() != partition_status::PS_SECONDARY) {
@@ -536,7 +586,7 @@ void replica::wait_async_checkpoint_for_backup(cold_backup_context_ptr backup_co
                backup_context->name,
                enum_to_string(status()));
         backup_context->ignore_checkpoint();
-        return;
+        return ERR_INVALID_STATE;
     }
 
     decree du = last_durable_decree();
@@ -546,21 +596,14 @@ void replica::wait_async_checkpoint_for_backup(cold_backup_context_ptr backup_co
                backup_context->name,
                du,
                backup_context->checkpoint_decree);
-        tasking::enqueue(
-            LPC_REPLICATION_COLD_BACKUP,
-            this,
-            [this, backup_context]() { trigger_async_checkpoint_for_backup(backup_context); },
-            gpid_to_thread_hash(get_gpid()),
-            std::chrono::seconds(10));
+        return ERR_TRY_AGAIN;
     } else {
         ddebug("%s: async checkpoint done, last_durable_decree = %" PRId64
                ", backup_context->checkpoint_decree = %" PRId64,
                backup_context->name,
                du,
                backup_context->checkpoint_decree);
-        tasking::enqueue(LPC_BACKGROUND_COLD_BACKUP, this, [this, backup_context]() {
-            local_create_backup_checkpoint(backup_context);
-        });
+        return ERR_OK;
     }
 }
 
@@ -568,16 +611,16 @@ void replica::wait_async_checkpoint_for_backup(cold_backup_context_ptr backup_co
 // Effection:
 // - may ignore_checkpoint() if in invalid status
 // - may fail_checkpoint() if some error occurs
-// - may complete_checkpoint() and schedule on_cold_backup() if checkpoint dir is successfully
-// copied
-void replica::local_create_backup_checkpoint(cold_backup_context_ptr backup_context)
+// - may complete_checkpoint() if checkpoint dir is successfully copied
+// - return ERR_TRY_AGAIN if copying checkpoint failed, so as to retry later
+error_code replica::local_create_backup_checkpoint(cold_backup_context_ptr backup_context)
 {
     if (backup_context->status() != ColdBackupCheckpointing) {
         ddebug("%s: ignore generating backup checkpoint because backup_status = %s",
                backup_context->name,
                cold_backup_status_to_string(backup_context->status()));
         backup_context->ignore_checkpoint();
-        return;
+        return ERR_INVALID_STATE;
     }
 
     // the real checkpoint decree may be larger than backup_context->checkpoint_decree,
@@ -597,12 +640,7 @@ void replica::local_create_backup_checkpoint(cold_backup_context_ptr backup_cont
                backup_context->name,
                err.to_string());
         dsn::utils::filesystem::remove_path(backup_checkpoint_tmp_dir_path);
-        tasking::enqueue(
-            LPC_BACKGROUND_COLD_BACKUP,
-            this,
-            [this, backup_context]() { local_create_backup_checkpoint(backup_context); },
-            0,
-            std::chrono::seconds(10));
+        return ERR_TRY_AGAIN;
     } else {
         dassert(last_decree >= backup_context->checkpoint_decree,
                 "%" PRId64 " VS %" PRId64 "",
@@ -624,7 +662,7 @@ void replica::local_create_backup_checkpoint(cold_backup_context_ptr backup_cont
             dsn::utils::filesystem::remove_path(backup_checkpoint_tmp_dir_path);
             dsn::utils::filesystem::remove_path(backup_checkpoint_dir_path);
             backup_context->fail_checkpoint("rename checkpoint dir failed");
-            return;
+            return ERR_FILE_OPERATION_FAILED;
         }
 
         std::vector<std::pair<std::string, int64_t>> file_infos;
@@ -634,7 +672,7 @@ void replica::local_create_backup_checkpoint(cold_backup_context_ptr backup_cont
                    backup_context->name,
                    backup_checkpoint_dir_path.c_str());
             backup_context->fail_checkpoint("statistic file info under dir failed");
-            return;
+            return ERR_FILE_OPERATION_FAILED;
         }
 
         ddebug("%s: generate backup checkpoint succeed, dir = %s, file_count = %d, total_size = "
@@ -650,13 +688,7 @@ void replica::local_create_backup_checkpoint(cold_backup_context_ptr backup_cont
         }
         backup_context->checkpoint_file_total_size = total_size;
         backup_context->complete_checkpoint();
-        tasking::enqueue(LPC_REPLICATION_COLD_BACKUP,
-                         this,
-                         [this, backup_context]() {
-                             backup_response response;
-                             on_cold_backup(backup_context->request, response);
-                         },
-                         gpid_to_thread_hash(get_gpid()));
+        return ERR_OK;
     }
 }
 
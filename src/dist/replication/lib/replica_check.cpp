@@ -159,6 +159,7 @@ void replica::on_group_check(const group_check_request &request,
     case partition_status::PS_INACTIVE:
         break;
     case partition_status::PS_SECONDARY:
+        _secondary_states.on_primary_contact(get_ballot(), request.last_committed_decree);
         if (request.last_committed_decree > last_committed_decree()) {
             _prepare_list->commit(request.last_committed_decree, COMMIT_TO_DECREE_HARD);
         }
@@ -35,6 +35,7 @@
 
 #include <dsn/utility/filesystem.h>
 #include <dsn/utility/utils.h>
+#include <algorithm>
 
 #include "replica_context.h"
 #include "replica.h"
@@ -175,9 +176,22 @@ bool secondary_context::cleanup(bool force)
     CLEANUP_TASK(catchup_with_private_log_task, force)
 
     checkpoint_is_running = false;
+    primary_contact_ballot = invalid_ballot;
+    primary_contact_ms = 0;
+    primary_committed_decree = invalid_decree;
     return true;
 }
 
+void secondary_context::on_primary_contact(ballot b, decree primary_committed)
+{
+    if (b != primary_contact_ballot) {
+        primary_contact_ballot = b;
+        primary_committed_decree = invalid_decree;
+    }
+    primary_contact_ms = dsn_now_ms();
+    primary_committed_decree = std::max(primary_committed_decree, primary_committed);
+}
+
 bool secondary_context::is_cleaned() { return checkpoint_is_running == false; }
 
 bool potential_secondary_context::cleanup(bool force)
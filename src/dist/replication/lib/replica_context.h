@@ -114,12 +114,28 @@ public:
 class secondary_context
 {
 public:
-    secondary_context() : checkpoint_is_running(false) {}
+    secondary_context()
+        : checkpoint_is_running(false),
+          primary_contact_ballot(invalid_ballot),
+          primary_contact_ms(0),
+          primary_committed_decree(invalid_decree)
+    {
+    }
     bool cleanup(bool force);
     bool is_cleaned();
 
+    // called on each prepare or group check from the primary
+    void on_primary_contact(ballot b, decree primary_committed);
+
 public:
     bool checkpoint_is_running;
+
+    // for bounded-staleness reads: the committed decree of the primary as last heard,
+    // valid only when primary_contact_ballot equals the current ballot
+    ballot primary_contact_ballot;
+    uint64_t primary_contact_ms;
+    decree primary_committed_decree;
+
     ::dsn::task_ptr checkpoint_task;
     ::dsn::task_ptr checkpoint_completed_task;
     ::dsn::task_ptr catchup_with_private_log_task;
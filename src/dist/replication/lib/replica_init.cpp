@@ -201,7 +201,8 @@ error_code replica::init_app_and_prepare_list(bool create_new)
     dassert(nullptr == _private_log, "private log must not be initialized yet");
 
     if (create_new) {
-        err = _app->open_new_internal(this, _stub->_log->on_partition_reset(get_gpid(), 0), 0);
+        err = _app->open_new_internal(
+            this, _stub->shared_log(get_gpid())->on_partition_reset(get_gpid(), 0), 0);
         // two case:
         //      1, just open a new app, in this case, the last_committed_decree and
         //      last_durable_decree
@@ -233,7 +234,7 @@ error_code replica::init_app_and_prepare_list(bool create_new)
             ddebug("%s: plog_dir = %s", name(), log_dir.c_str());
 
             // sync valid_start_offset between app and logs
-            _stub->_log->set_valid_start_offset_on_open(
+            _stub->shared_log(get_gpid())->set_valid_start_offset_on_open(
                 get_gpid(), _app->init_info().init_offset_in_shared_log);
             _private_log->set_valid_start_offset_on_open(
                 get_gpid(), _app->init_info().init_offset_in_private_log);
@@ -300,7 +301,7 @@ error_code replica::init_app_and_prepare_list(bool create_new)
                     _private_log->close();
                     _private_log = nullptr;
 
-                    _stub->_log->on_partition_removed(get_gpid());
+                    _stub->shared_log(get_gpid())->on_partition_removed(get_gpid());
                 }
             }
         }
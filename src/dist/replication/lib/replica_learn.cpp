@@ -40,10 +40,111 @@
 #include <dsn/utility/factory_store.h>
 #include <dsn/utility/filesystem.h>
 #include <dsn/dist/replication/replication_app_base.h>
+#include <dsn/cpp/coroutine.h>
+#include <fstream>
+#include <sstream>
 
 namespace dsn {
 namespace replication {
 
+// the learn dir is kept if the remote state to copy is the same as the last (interrupted)
+// learning, so nfs can resume the partially copied files, otherwise it is recreated.
+// the remote state is identified by the content of the ".learn_source" file in the dir.
+static bool prepare_learn_dir(const std::string &learn_dir, const std::string &learn_source)
+{
+    std::string source_file = utils::filesystem::path_combine(learn_dir, ".learn_source");
+    if (utils::filesystem::directory_exists(learn_dir)) {
+        std::ifstream is(source_file);
+        std::string last_source;
+        if (is && std::getline(is, last_source) && last_source == learn_source) {
+            return true;
+        }
+    }
+
+    utils::filesystem::remove_path(learn_dir);
+    utils::filesystem::create_directory(learn_dir);
+    if (!utils::filesystem::directory_exists(learn_dir)) {
+        return false;
+    }
+
+    std::ofstream os(source_file, std::ios::out | std::ios::trunc);
+    os << learn_source << std::endl;
+    return true;
+}
+
+// one round of learning on the learner: ask the learnee for the state to learn, copy the
+// remote files if any, apply the learned state on the LONG pool, and then continue on the
+// replica thread. the round is kept in learning_task and then learn_remote_files_task so
+// cleanup() can cancel it as before, and the request and response are kept in the round
+// rather than moved into a new callback on each step.
+class replica::learn_round : public coroutine
+{
+public:
+    learn_round(replica *r, learn_request &&request)
+        : coroutine(r), _r(r), _request(std::move(request)), _copy_start_time(0), _copy_size(0)
+    {
+    }
+
+private:
+    void run() override
+    {
+        DSN_CO_BEGIN
+        DSN_CO_AWAIT(await_rpc(_r->_config.primary,
+                               RPC_LEARN,
+                               _request,
+                               std::chrono::milliseconds(0),
+                               gpid_to_thread_hash(_r->get_gpid())));
+        unmarshall_response(_response);
+        if (!_r->on_learn_reply(co_err, _request, _response, _copy_err))
+            DSN_CO_RETURN;
+
+        if (_r->_potential_secondary_states.learning_task == this)
+            _r->_potential_secondary_states.learning_task = nullptr;
+        _r->_potential_secondary_states.learn_remote_files_task = this;
+        _copy_start_time = _r->_potential_secondary_states.duration_ms();
+        if (_copy_err == ERR_OK && !_response.state.files.empty()) {
+            DSN_CO_AWAIT(await_copy_remote_files(_response.config.primary,
+                                                 _response.base_local_dir,
+                                                 _response.state.files,
+                                                 _r->_app->learn_dir(),
+                                                 true, // overwrite
+                                                 _response.type != learn_type::LT_APP,
+                                                 LPC_REPLICATION_COPY_REMOTE_FILES));
+            _copy_err = co_err;
+            _copy_size = co_io_size;
+        } else {
+            DSN_CO_AWAIT(await_task(LPC_LEARN_REMOTE_DELTA_FILES));
+        }
+
+        _copy_err = _r->on_copy_remote_state_completed(
+            _copy_err, _copy_size, _copy_start_time, _request, _response);
+
+        // it is possible that learn_remote_files_task is still running while its body is
+        // definitely done as being here, so it is cleared right now to avoid unnecessary
+        // failed cleanup later, and the completion is handed to a normal task which cleanup
+        // can cancel as learn_remote_files_completed_task
+        {
+            replica *r = _r;
+            error_code err = _copy_err;
+            r->_potential_secondary_states.learn_remote_files_task = nullptr;
+            r->_potential_secondary_states.learn_remote_files_completed_task =
+                tasking::create_task(LPC_LEARN_REMOTE_DELTA_FILES_COMPLETED,
+                                     r,
+                                     [r, err]() { r->on_learn_remote_state_completed(err); },
+                                     gpid_to_thread_hash(r->get_gpid()));
+            r->_potential_secondary_states.learn_remote_files_completed_task->enqueue();
+        }
+        DSN_CO_END
+    }
+
+    replica *_r;
+    learn_request _request;
+    learn_response _response;
+    error_code _copy_err;
+    uint64_t _copy_start_time;
+    size_t _copy_size;
+};
+
 void replica::init_learn(uint64_t signature)
 {
     check_hashed_access();
@@ -218,14 +319,7 @@ void replica::init_learn(uint64_t signature)
            _potential_secondary_states.learning_copy_buffer_size);
 
     _potential_secondary_states.learning_task =
-        rpc::create_message(
-            RPC_LEARN, request, std::chrono::milliseconds(0), gpid_to_thread_hash(get_gpid()))
-            .call(_config.primary,
-                  this,
-                  [ this, req_cap = std::move(request) ](error_code err,
-                                                         learn_response && resp) mutable {
-                      on_learn_reply(err, std::move(req_cap), std::move(resp));
-                  });
+        (new learn_round(this, std::move(request)))->start();
 }
 
 void replica::on_learn(dsn_message_t msg, const learn_request &request)
@@ -485,7 +579,10 @@ void replica::on_learn(dsn_message_t msg, const learn_request &request)
     }
 }
 
-void replica::on_learn_reply(error_code err, learn_request &&req, learn_response &&resp)
+bool replica::on_learn_reply(error_code err,
+                             learn_request &req,
+                             learn_response &resp,
+                             /*out*/ error_code &copy_err)
 {
     check_hashed_access();
 
@@ -499,7 +596,7 @@ void replica::on_learn_reply(error_code err, learn_request &&req, learn_response
 
     if (err != ERR_OK) {
         handle_learning_error(err, false);
-        return;
+        return false;
     }
 
     ddebug("%s: on_learn_reply[%016" PRIx64 "]: learnee = %s, learn_duration = %" PRIu64
@@ -540,7 +637,7 @@ void replica::on_learn_reply(error_code err, learn_request &&req, learn_response
         } else {
             handle_learning_error(resp.err, false);
         }
-        return;
+        return false;
     }
 
     if (resp.config.ballot > get_ballot()) {
@@ -560,7 +657,7 @@ void replica::on_learn_reply(error_code err, learn_request &&req, learn_response
                req.signature,
                resp.config.primary.to_string(),
                enum_to_string(status()));
-        return;
+        return false;
     }
 
     // local state is newer than learnee
@@ -609,9 +706,10 @@ void replica::on_learn_reply(error_code err, learn_request &&req, learn_response
         }
 
         if (err == ERR_OK) {
-            err = _app->open_new_internal(this,
-                                          _stub->_log->on_partition_reset(get_gpid(), 0),
-                                          _private_log->on_partition_reset(get_gpid(), 0));
+            err = _app->open_new_internal(
+                this,
+                _stub->shared_log(get_gpid())->on_partition_reset(get_gpid(), 0),
+                _private_log->on_partition_reset(get_gpid(), 0));
 
             if (err != ERR_OK) {
                 derror("%s: on_learn_reply[%016" PRIx64
@@ -632,16 +730,8 @@ void replica::on_learn_reply(error_code err, learn_request &&req, learn_response
         }
 
         if (err != ERR_OK) {
-            _potential_secondary_states.learn_remote_files_task = tasking::create_task(
-                LPC_LEARN_REMOTE_DELTA_FILES,
-                this,
-                [ this, err, copy_start = _potential_secondary_states.duration_ms(),
-                req_cap = std::move(req), resp_cap = std::move(resp) ]() mutable {
-                    on_copy_remote_state_completed(err, 0, copy_start,
-                        std::move(req_cap), std::move(resp_cap));
-                });
-            _potential_secondary_states.learn_remote_files_task->enqueue();
-            return;
+            copy_err = err;
+            return true;
         }
     }
 
@@ -656,7 +746,7 @@ void replica::on_learn_reply(error_code err, learn_request &&req, learn_response
                 _config.primary.to_string(),
                 _options->learn_app_max_concurrent_count);
             _potential_secondary_states.learning_round_is_running = false;
-            return;
+            return false;
         } else {
             ddebug("%s: on_learn_reply[%016" PRIx64
                    "]: learnee = %s, ++learn_app_concurrent_count = %d",
@@ -701,7 +791,8 @@ void replica::on_learn_reply(error_code err, learn_request &&req, learn_response
         // appended by the mutations AFTER current position
         err = _app->update_init_info(
             this,
-            _stub->_log->on_partition_reset(get_gpid(), _app->last_committed_decree()),
+            _stub->shared_log(get_gpid())->on_partition_reset(get_gpid(),
+                                                              _app->last_committed_decree()),
             _private_log->on_partition_reset(get_gpid(), _app->last_committed_decree()),
             _app->last_committed_decree());
 
@@ -733,7 +824,8 @@ void replica::on_learn_reply(error_code err, learn_request &&req, learn_response
 
                 // write to shared log with no callback, the later 2pc ensures that logs
                 // are written to the disk
-                _stub->_log->append(mu, LPC_WRITE_REPLICATION_LOG_COMMON, this, nullptr);
+                _stub->shared_log(get_gpid())->append(
+                    mu, LPC_WRITE_REPLICATION_LOG_COMMON, this, nullptr);
 
                 // because shared log are written without callback, need to manully
                 // set flag and write mutations to private log
@@ -796,40 +888,26 @@ void replica::on_learn_reply(error_code err, learn_request &&req, learn_response
 
         // go to next stage
         _potential_secondary_states.learning_status = learner_status::LearningWithPrepare;
-        _potential_secondary_states.learn_remote_files_task = tasking::create_task(
-            LPC_LEARN_REMOTE_DELTA_FILES,
-            this,
-            [ this, err, copy_start = _potential_secondary_states.duration_ms(),
-            req_cap = std::move(req), resp_cap = std::move(resp) ]() mutable {
-                on_copy_remote_state_completed(err, 0, copy_start,
-                    std::move(req_cap), std::move(resp_cap));
-            });
-        _potential_secondary_states.learn_remote_files_task->enqueue();
+        copy_err = err;
+        return true;
     }
 
     else if (resp.state.files.size() > 0) {
         auto learn_dir = _app->learn_dir();
-        utils::filesystem::remove_path(learn_dir);
-        utils::filesystem::create_directory(learn_dir);
+        std::stringstream learn_source;
+        learn_source << resp.config.primary.to_string() << " " << enum_to_string(resp.type) << " "
+                     << resp.base_local_dir << " " << resp.state.from_decree_excluded << " "
+                     << resp.state.to_decree_included << " " << resp.state.files.size();
 
-        if (!dsn::utils::filesystem::directory_exists(learn_dir)) {
+        if (!prepare_learn_dir(learn_dir, learn_source.str())) {
             derror("%s: on_learn_reply[%016" PRIx64
                    "]: learnee = %s, create replica learn dir %s failed",
                    name(),
                    req.signature,
                    resp.config.primary.to_string(),
                    learn_dir.c_str());
-
-            _potential_secondary_states.learn_remote_files_task = tasking::create_task(
-                LPC_LEARN_REMOTE_DELTA_FILES,
-                this,
-                [ this, err, copy_start = _potential_secondary_states.duration_ms(),
-                req_cap = std::move(req), resp_cap = std::move(resp) ]() mutable {
-                    on_copy_remote_state_completed(ERR_FILE_OPERATION_FAILED, 0, copy_start,
-                        std::move(req_cap), std::move(resp_cap));
-                });
-            _potential_secondary_states.learn_remote_files_task->enqueue();
-            return;
+            copy_err = ERR_FILE_OPERATION_FAILED;
+            return true;
         }
 
         bool high_priority = (resp.type == learn_type::LT_APP ? false : true);
@@ -841,39 +919,17 @@ void replica::on_learn_reply(error_code err, learn_request &&req, learn_response
                _potential_secondary_states.duration_ms(),
                static_cast<int>(resp.state.files.size()),
                high_priority ? "high" : "low");
-
-        _potential_secondary_states.learn_remote_files_task = file::copy_remote_files(
-            resp.config.primary,
-            resp.base_local_dir,
-            resp.state.files,
-            learn_dir,
-            true, // overwrite
-            high_priority,
-            LPC_REPLICATION_COPY_REMOTE_FILES,
-            this,
-            [ this, copy_start = _potential_secondary_states.duration_ms(),
-            req_cap = std::move(req), resp_copy = resp ](error_code err, size_t sz) mutable {
-                on_copy_remote_state_completed(err, sz, copy_start,
-                    std::move(req_cap), std::move(resp_copy));
-            });
-    } else {
-        _potential_secondary_states.learn_remote_files_task = tasking::create_task(
-            LPC_LEARN_REMOTE_DELTA_FILES,
-            this,
-            [ this, copy_start = _potential_secondary_states.duration_ms(),
-            req_cap = std::move(req), resp_cap = std::move(resp) ]() mutable {
-                on_copy_remote_state_completed(ERR_OK, 0, copy_start,
-                    std::move(req_cap), std::move(resp_cap));
-            });
-        _potential_secondary_states.learn_remote_files_task->enqueue();
     }
+
+    copy_err = ERR_OK;
+    return true;
 }
 
-void replica::on_copy_remote_state_completed(error_code err,
-                                             size_t size,
-                                             uint64_t copy_start_time,
-                                             learn_request &&req,
-                                             learn_response &&resp)
+error_code replica::on_copy_remote_state_completed(error_code err,
+                                                   size_t size,
+                                                   uint64_t copy_start_time,
+                                                   const learn_request &req,
+                                                   const learn_response &resp)
 {
     decree old_prepared = last_prepared_decree();
     decree old_committed = last_committed_decree();
@@ -1069,19 +1125,7 @@ void replica::on_copy_remote_state_completed(error_code err,
             err = ERR_OK;
     }
 
-    // it is possible that the _potential_secondary_states.learn_remote_files_task is still running
-    // while its body is definitely done already as being here, so we manually set its value to
-    // nullptr
-    // so that we don't have unnecessary failed reconfiguration later due to this non-nullptr in
-    // cleanup
-    _potential_secondary_states.learn_remote_files_task = nullptr;
-
-    _potential_secondary_states.learn_remote_files_completed_task =
-        tasking::create_task(LPC_LEARN_REMOTE_DELTA_FILES_COMPLETED,
-                             this,
-                             [this, err]() { on_learn_remote_state_completed(err); },
-                             gpid_to_thread_hash(get_gpid()));
-    _potential_secondary_states.learn_remote_files_completed_task->enqueue();
+    return err;
 }
 
 void replica::on_learn_remote_state_completed(error_code err)
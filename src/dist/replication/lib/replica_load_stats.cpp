@@ -0,0 +1,96 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015 Microsoft Corporation
+ *
+ * -=- Robust Distributed System Nucleus (rDSN) -=-
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * Description:
+ *     per-replica load statistics reported to the meta server
+ *
+ * Revision history:
+ *     xxxx-xx-xx, author, first version
+ *     xxxx-xx-xx, author, fix bug about xxx
+ */
+
+#include "replica_load_stats.h"
+#include <dsn/service_api_c.h>
+
+namespace dsn {
+namespace replication {
+
+// the p99 of the latencies recorded since the last call, or 0 if there is none
+static int64_t fetch_p99_and_reset(histogram &h)
+{
+    histogram_snapshot snapshot;
+    h.merge_and_reset(snapshot);
+    return static_cast<int64_t>(snapshot.percentile(99));
+}
+
+replica_load_stats::replica_load_stats()
+    : _read_count(0),
+      _read_bytes(0),
+      _write_count(0),
+      _write_bytes(0),
+      _storage_mb(0),
+      _period_start_ms(dsn_now_ms())
+{
+}
+
+void replica_load_stats::on_read(uint64_t bytes, uint64_t latency_ns)
+{
+    _read_count.fetch_add(1, std::memory_order_relaxed);
+    _read_bytes.fetch_add(bytes, std::memory_order_relaxed);
+    _read_latency.record(latency_ns);
+}
+
+void replica_load_stats::on_write(uint64_t bytes)
+{
+    _write_count.fetch_add(1, std::memory_order_relaxed);
+    _write_bytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void replica_load_stats::on_write_committed(uint64_t latency_ns)
+{
+    _write_latency.record(latency_ns);
+}
+
+void replica_load_stats::fetch_and_reset(/*out*/ replica_load_stat &stat)
+{
+    uint64_t now = dsn_now_ms();
+    uint64_t interval_ms = now > _period_start_ms ? now - _period_start_ms : 1;
+    _period_start_ms = now;
+
+    auto per_second = [interval_ms](uint64_t v) {
+        return static_cast<int64_t>(v * 1000 / interval_ms);
+    };
+    stat.read_qps = per_second(_read_count.exchange(0, std::memory_order_relaxed));
+    stat.read_bytes_per_sec = per_second(_read_bytes.exchange(0, std::memory_order_relaxed));
+    stat.write_qps = per_second(_write_count.exchange(0, std::memory_order_relaxed));
+    stat.write_bytes_per_sec = per_second(_write_bytes.exchange(0, std::memory_order_relaxed));
+    stat.read_latency_p99_ns = fetch_p99_and_reset(_read_latency);
+    stat.write_latency_p99_ns = fetch_p99_and_reset(_write_latency);
+    stat.storage_mb = _storage_mb.load(std::memory_order_relaxed);
+}
+}
+} // namespace
@@ -0,0 +1,79 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015 Microsoft Corporation
+ *
+ * -=- Robust Distributed System Nucleus (rDSN) -=-
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * Description:
+ *     per-replica load statistics reported to the meta server
+ *
+ * Revision history:
+ *     xxxx-xx-xx, author, first version
+ *     xxxx-xx-xx, author, fix bug about xxx
+ */
+
+#pragma once
+
+#include <dsn/dist/replication/replication_types.h>
+#include <dsn/utility/histogram.h>
+#include <atomic>
+#include <cstdint>
+
+namespace dsn {
+namespace replication {
+
+//
+// read/write counters of a replica, updated on the request paths with relaxed atomics only,
+// and fetched by replica_stub when it sends the config sync request to the meta server
+//
+class replica_load_stats
+{
+public:
+    replica_load_stats();
+
+    void on_read(uint64_t bytes, uint64_t latency_ns);
+    void on_write(uint64_t bytes);
+    void on_write_committed(uint64_t latency_ns);
+
+    // updated by the periodical disk stat of replica_stub
+    void set_storage_mb(int64_t storage_mb)
+    {
+        _storage_mb.store(storage_mb, std::memory_order_relaxed);
+    }
+
+    // fill the rates since the last call, and start a new period
+    void fetch_and_reset(/*out*/ replica_load_stat &stat);
+
+private:
+    std::atomic<uint64_t> _read_count;
+    std::atomic<uint64_t> _read_bytes;
+    std::atomic<uint64_t> _write_count;
+    std::atomic<uint64_t> _write_bytes;
+    histogram _read_latency;  // in ns, reset by fetch_and_reset
+    histogram _write_latency; // in ns, reset by fetch_and_reset
+    std::atomic<int64_t> _storage_mb;
+    uint64_t _period_start_ms;
+};
+}
+} // namespace
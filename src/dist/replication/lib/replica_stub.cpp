@@ -43,6 +43,7 @@
 #include <dsn/dist/replication/replication_app_base.h>
 #include <vector>
 #include <deque>
+#include <fstream>
 
 namespace dsn {
 namespace replication {
@@ -54,6 +55,10 @@ bool replica_stub::s_not_exit_on_log_failure = false;
 replica_stub::replica_stub(replica_state_subscriber subscriber /*= nullptr*/,
                            bool is_long_subscriber /* = true*/)
     : serverlet("replica_stub"),
+      _config_sync_epoch(0),
+      _config_sync_version(0),
+      _config_sync_count(0),
+      _config_sync_full(true),
       _kill_partition_command(nullptr),
       _deny_client_command(nullptr),
       _verbose_client_log_command(nullptr),
@@ -69,7 +74,6 @@ replica_stub::replica_stub(replica_state_subscriber subscriber /*= nullptr*/,
     _is_long_subscriber = is_long_subscriber;
     _failure_detector = nullptr;
     _state = NS_Disconnected;
-    _log = nullptr;
     install_perf_counters();
 }
 
@@ -280,8 +284,13 @@ void replica_stub::initialize(const replication_options &opts, bool clear /* = f
 
     // clear dirs if need
     if (clear) {
-        if (!dsn::utils::filesystem::remove_path(_options.slog_dir)) {
-            dassert(false, "Fail to remove %s.", _options.slog_dir.c_str());
+        for (auto &dir : get_shared_log_dirs(get_shared_log_stream_count())) {
+            if (!dsn::utils::filesystem::remove_path(dir)) {
+                dassert(false, "Fail to remove %s.", dir.c_str());
+            }
+        }
+        if (!dsn::utils::filesystem::remove_path(get_shared_log_streams_file())) {
+            dassert(false, "Fail to remove %s.", get_shared_log_streams_file().c_str());
         }
         for (auto &dir : _options.data_dirs) {
             if (!dsn::utils::filesystem::remove_path(dir)) {
@@ -319,9 +328,26 @@ void replica_stub::initialize(const replication_options &opts, bool clear /* = f
         dassert(err == dsn::ERR_OK, "initialize fs manager failed, err(%s)", err.to_string());
     }
 
-    _log = new mutation_log_shared(
-        _options.slog_dir, _options.log_shared_file_size_mb, _options.log_shared_force_flush);
-    ddebug("slog_dir = %s", _options.slog_dir.c_str());
+    // the stream count is fixed once the shared log is created, as replicas are bound to
+    // the streams by their gpid and must find their mutations in the same stream on restart
+    int stream_count = get_shared_log_stream_count();
+    if (stream_count != _options.log_shared_stream_count) {
+        dwarn("log_shared_stream_count = %d is ignored, keep using %d streams of the existing "
+              "shared log",
+              _options.log_shared_stream_count,
+              stream_count);
+    }
+    if (!dsn::utils::filesystem::file_exists(get_shared_log_streams_file())) {
+        std::ofstream os(get_shared_log_streams_file());
+        os << stream_count;
+        os.close();
+        dassert(!os.fail(), "Fail to write %s.", get_shared_log_streams_file().c_str());
+    }
+    std::vector<std::string> slog_dirs = get_shared_log_dirs(stream_count);
+    for (auto &dir : slog_dirs) {
+        _logs.push_back(create_shared_log(dir));
+        ddebug("slog_dir[%d] = %s", (int)_logs.size() - 1, dir.c_str());
+    }
 
     // init rps
     ddebug("start to load replicas");
@@ -392,42 +418,60 @@ void replica_stub::initialize(const replication_options &opts, bool clear /* = f
            finish_time - start_time);
 
     // init shared prepare log
-    ddebug("start to replay shared log");
+    // replay the shared log streams one by one, each replica is only in one of them
+    std::vector<error_code> stream_errs(_logs.size(), ERR_OK);
+    for (int i = 0; i < (int)_logs.size(); i++) {
+        ddebug("start to replay shared log %s", slog_dirs[i].c_str());
 
-    std::map<gpid, decree> replay_condition;
-    for (auto it = rps.begin(); it != rps.end(); ++it) {
-        replay_condition[it->first] = it->second->last_committed_decree();
-    }
-
-    start_time = dsn_now_ms();
-    error_code err = _log->open(
-        [&rps](int log_length, mutation_ptr &mu) {
-            auto it = rps.find(mu->data.header.pid);
-            if (it != rps.end()) {
-                return it->second->replay_mutation(mu, false);
-            } else {
-                return false;
+        std::map<gpid, decree> replay_condition;
+        for (auto it = rps.begin(); it != rps.end(); ++it) {
+            if (get_shared_log_index(it->first) == i) {
+                replay_condition[it->first] = it->second->last_committed_decree();
             }
-        },
-        [this](error_code err) { this->handle_log_failure(err); },
-        replay_condition);
-    finish_time = dsn_now_ms();
+        }
 
-    if (err == ERR_OK) {
-        ddebug("replay shared log succeed, time_used = %" PRIu64 " ms", finish_time - start_time);
-    } else {
-        derror("replay shared log failed, err = %s, time_used = %" PRIu64 " ms, clear all logs ...",
+        start_time = dsn_now_ms();
+        _logs[i]->set_parallel_replay(!_options.log_shared_parallel_replay_disabled);
+        error_code err = _logs[i]->open(
+            [&rps](int log_length, mutation_ptr &mu) {
+                auto it = rps.find(mu->data.header.pid);
+                if (it != rps.end()) {
+                    return it->second->replay_mutation(mu, false);
+                } else {
+                    return false;
+                }
+            },
+            [this](error_code err) { this->handle_log_failure(err); },
+            replay_condition);
+        finish_time = dsn_now_ms();
+
+        if (err == ERR_OK) {
+            ddebug("replay shared log %s succeed, time_used = %" PRIu64 " ms",
+                   slog_dirs[i].c_str(),
+                   finish_time - start_time);
+            continue;
+        }
+
+        derror("replay shared log %s failed, err = %s, time_used = %" PRIu64
+               " ms, clear all logs ...",
+               slog_dirs[i].c_str(),
                err.to_string(),
                finish_time - start_time);
+        stream_errs[i] = err;
 
         // we must delete or update meta server the error for all replicas
         // before we fix the logs
         // otherwise, the next process restart may consider the replicas'
         // state complete
 
-        // delete all replicas
+        // delete all replicas of this stream
         // TODO: checkpoint latest state and update on meta server so learning is cheaper
-        for (auto it = rps.begin(); it != rps.end(); ++it) {
+        for (auto it = rps.begin(); it != rps.end();) {
+            if (get_shared_log_index(it->first) != i) {
+                ++it;
+                continue;
+            }
+
             it->second->close();
             // move to '.err' directory
             const char *dir = it->second->dir().c_str();
@@ -439,27 +483,46 @@ void replica_stub::initialize(const replication_options &opts, bool clear /* = f
                   dir,
                   rename_dir);
             _counter_replicas_recent_replica_move_error_count->increment();
+            it = rps.erase(it);
         }
-        rps.clear();
 
         // restart log service
-        _log->close();
-        _log = nullptr;
-        if (!utils::filesystem::remove_path(_options.slog_dir)) {
-            dassert(false, "remove directory %s failed", _options.slog_dir.c_str());
+        _logs[i]->close();
+        _logs[i] = nullptr;
+        if (!utils::filesystem::remove_path(slog_dirs[i])) {
+            dassert(false, "remove directory %s failed", slog_dirs[i].c_str());
         }
-        _log = new mutation_log_shared(
-            _options.slog_dir, _options.log_shared_file_size_mb, _options.log_shared_force_flush);
-        auto lerr = _log->open(nullptr, [this](error_code err) { this->handle_log_failure(err); });
+        _logs[i] = create_shared_log(slog_dirs[i]);
+        auto lerr =
+            _logs[i]->open(nullptr, [this](error_code err) { this->handle_log_failure(err); });
         dassert(lerr == ERR_OK, "restart log service must succeed");
     }
 
-    bool is_log_complete = true;
+    // checkpoint the replayed state of the replicas in parallel
+    start_time = dsn_now_ms();
     for (auto it = rps.begin(); it != rps.end(); ++it) {
-        it->second->sync_checkpoint();
-        it->second->reset_prepare_list_after_replay();
+        replica_ptr r = it->second;
+        load_tasks.push_back(tasking::create_task(LPC_REPLICATION_INIT_LOAD,
+                                                  this,
+                                                  [r] {
+                                                      r->sync_checkpoint();
+                                                      r->reset_prepare_list_after_replay();
+                                                  },
+                                                  gpid_to_thread_hash(it->first)));
+        load_tasks.back()->enqueue();
+    }
+    for (auto &tsk : load_tasks) {
+        tsk->wait();
+    }
+    load_tasks.clear();
+    ddebug("checkpoint replicas after replay done, time_used = %" PRIu64 " ms",
+           dsn_now_ms() - start_time);
 
-        decree smax = _log->max_decree(it->first);
+    bool is_log_complete = true;
+    for (auto it = rps.begin(); it != rps.end(); ++it) {
+        const mutation_log_ptr &slog = shared_log(it->first);
+        error_code err = stream_errs[get_shared_log_index(it->first)];
+        decree smax = slog->max_decree(it->first);
         decree pmax = invalid_decree;
         decree pmax_commit = invalid_decree;
         if (it->second->private_log()) {
@@ -468,7 +531,7 @@ void replica_stub::initialize(const replication_options &opts, bool clear /* = f
 
             // possible when shared log is restarted
             if (smax == 0) {
-                _log->update_max_decree(it->first, pmax);
+                slog->update_max_decree(it->first, pmax);
                 smax = pmax;
             }
 
@@ -543,7 +606,11 @@ void replica_stub::initialize(const replication_options &opts, bool clear /* = f
     }
 
     // attach rps
-    _replicas = std::move(rps);
+    {
+        zauto_write_lock l(_replicas_lock);
+        _replicas = std::move(rps);
+        publish_replicas_snapshot();
+    }
     _counter_replicas_count->add((uint64_t)_replicas.size());
     for (const auto &kv : _replicas) {
         _fs_manager.add_replica(kv.first, kv.second->dir());
@@ -609,13 +676,9 @@ dsn::error_code replica_stub::on_kill_replica(gpid pid)
 {
     ddebug("kill replica: gpid = %d.%d", pid.get_app_id(), pid.get_partition_index());
     if (pid.get_app_id() == -1 || pid.get_partition_index() == -1) {
-        replicas rs;
-        {
-            zauto_read_lock l(_replicas_lock);
-            rs = _replicas;
-        }
-        for (auto it = rs.begin(); it != rs.end(); ++it) {
-            replica_ptr &r = it->second;
+        std::shared_ptr<const replicas> rs = _replicas_snapshot.get();
+        for (auto it = rs->begin(); it != rs->end(); ++it) {
+            const replica_ptr &r = it->second;
             if (pid.get_app_id() == -1 || pid.get_app_id() == r->get_gpid().get_app_id())
                 r->inject_error(ERR_INJECTED);
         }
@@ -636,12 +699,18 @@ dsn::error_code replica_stub::on_kill_replica(gpid pid)
 
 replica_ptr replica_stub::get_replica(gpid gpid)
 {
-    zauto_read_lock l(_replicas_lock);
-    auto it = _replicas.find(gpid);
-    if (it != _replicas.end())
-        return it->second;
-    else
-        return nullptr;
+    return _replicas_snapshot.read([gpid](const replicas &rs) {
+        auto it = rs.find(gpid);
+        if (it != rs.end())
+            return it->second;
+        else
+            return replica_ptr();
+    });
+}
+
+void replica_stub::publish_replicas_snapshot()
+{
+    _replicas_snapshot.publish(std::shared_ptr<const replicas>(new replicas(_replicas)));
 }
 
 replica_stub::replica_life_cycle replica_stub::get_replica_life_cycle(const gpid &pid)
@@ -991,6 +1060,18 @@ void replica_stub::get_replica_info(replica_info &info, replica_ptr r)
     }
 }
 
+void replica_stub::get_load_stats(std::vector<replica_load_stat> &stats)
+{
+    std::shared_ptr<const replicas> rs = _replicas_snapshot.get();
+    stats.reserve(rs->size());
+    for (auto &kv : *rs) {
+        replica_load_stat stat;
+        stat.pid = kv.first;
+        kv.second->load_stats().fetch_and_reset(stat);
+        stats.push_back(stat);
+    }
+}
+
 void replica_stub::get_local_replicas(std::vector<replica_info> &replicas)
 {
     zauto_read_lock l(_replicas_lock);
@@ -1033,14 +1114,27 @@ void replica_stub::query_configuration_by_node()
     configuration_query_by_node_request req;
     req.node = _primary_address;
 
-    // TODO: send stored replicas may cost network, we shouldn't config the frequency
-    get_local_replicas(req.stored_replicas);
-    req.__isset.stored_replicas = true;
+    // a full sync sends all the stored replicas for the meta server to collect and gc,
+    // and gets all the partitions on this node; the others only get the changed partitions
+    _config_sync_full = _config_sync_version == 0 || _options.config_sync_full_interval <= 1 ||
+                        ++_config_sync_count % _options.config_sync_full_interval == 0;
+    if (_config_sync_full) {
+        get_local_replicas(req.stored_replicas);
+        req.__isset.stored_replicas = true;
+    }
+    req.__set_config_epoch(_config_sync_epoch);
+    req.__set_config_version(_config_sync_full ? 0 : _config_sync_version);
+
+    get_load_stats(req.load_stats);
+    req.__isset.load_stats = true;
 
     ::dsn::marshall(msg, req);
 
-    ddebug("send query node partitions request to meta server, stored_replicas_count = %d",
-           (int)req.stored_replicas.size());
+    ddebug("send query node partitions request to meta server, stored_replicas_count = %d, "
+           "load_stats_count = %d, config_version = %" PRId64,
+           (int)req.stored_replicas.size(),
+           (int)req.load_stats.size(),
+           req.config_version);
 
     rpc_address target(_failure_detector->get_servers());
     _config_query_task = rpc::call(
@@ -1109,31 +1203,51 @@ void replica_stub::on_node_query_reply(error_code err,
         }
 
         ddebug("process query node partitions response for resp.err = ERR_OK, "
-               "partitions_count(%d), gc_replicas_count(%d)",
+               "partitions_count(%d), gc_replicas_count(%d), is_delta(%s)",
                (int)resp.partitions.size(),
-               (int)resp.gc_replicas.size());
+               (int)resp.gc_replicas.size(),
+               resp.is_delta ? "true" : "false");
+
+        if (resp.__isset.config_version) {
+            // if the meta server changes, sync fully next time to report all the stored replicas
+            bool meta_changed = resp.config_epoch != _config_sync_epoch && !_config_sync_full;
+            _config_sync_epoch = resp.config_epoch;
+            _config_sync_version = meta_changed ? 0 : resp.config_version;
+        }
 
-        replicas rs;
-        {
-            zauto_read_lock l(_replicas_lock);
-            rs = _replicas;
+        // the app infos are deduplicated in the response
+        if (resp.__isset.apps) {
+            std::unordered_map<int32_t, const app_info *> apps;
+            for (const app_info &info : resp.apps) {
+                apps[info.app_id] = &info;
+            }
+            for (configuration_update_request &req : resp.partitions) {
+                auto it = apps.find(req.config.pid.get_app_id());
+                dassert(it != apps.end(), "app_info of %d not found", req.config.pid.get_app_id());
+                req.info = *(it->second);
+            }
         }
 
         for (auto it = resp.partitions.begin(); it != resp.partitions.end(); ++it) {
-            rs.erase(it->config.pid);
             tasking::enqueue(LPC_QUERY_NODE_CONFIGURATION_SCATTER,
                              this,
                              std::bind(&replica_stub::on_node_query_reply_scatter, this, this, *it),
                              gpid_to_thread_hash(it->config.pid));
         }
 
-        // for rps not exist on meta_servers
-        for (auto it = rs.begin(); it != rs.end(); ++it) {
-            tasking::enqueue(
-                LPC_QUERY_NODE_CONFIGURATION_SCATTER2,
-                this,
-                std::bind(&replica_stub::on_node_query_reply_scatter2, this, this, it->first),
-                gpid_to_thread_hash(it->first));
+        // for rps not exist on meta_servers, which is only known from a full response
+        if (!resp.is_delta) {
+            replicas rs = *_replicas_snapshot.get();
+            for (auto it = resp.partitions.begin(); it != resp.partitions.end(); ++it) {
+                rs.erase(it->config.pid);
+            }
+            for (auto it = rs.begin(); it != rs.end(); ++it) {
+                tasking::enqueue(
+                    LPC_QUERY_NODE_CONFIGURATION_SCATTER2,
+                    this,
+                    std::bind(&replica_stub::on_node_query_reply_scatter2, this, this, it->first),
+                    gpid_to_thread_hash(it->first));
+            }
         }
 
         // handle the replicas which need to be gc
@@ -1255,13 +1369,8 @@ void replica_stub::on_meta_server_disconnected()
 
     _state = NS_Disconnected;
 
-    replicas rs;
-    {
-        zauto_read_lock l(_replicas_lock);
-        rs = _replicas;
-    }
-
-    for (auto it = rs.begin(); it != rs.end(); ++it) {
+    std::shared_ptr<const replicas> rs = _replicas_snapshot.get();
+    for (auto it = rs->begin(); it != rs->end(); ++it) {
         tasking::enqueue(
             LPC_CM_DISCONNECTED_SCATTER,
             this,
@@ -1375,12 +1484,8 @@ void replica_stub::on_gc_replica(replica_stub_ptr this_, gpid pid)
 void replica_stub::on_gc()
 {
     uint64_t start = dsn_now_ns();
-    replicas rs;
-    {
-        zauto_read_lock l(_replicas_lock);
-        rs = _replicas;
-    }
-    ddebug("start to garbage collection, replica_count = %d", (int)rs.size());
+    std::shared_ptr<const replicas> rs = _replicas_snapshot.get();
+    ddebug("start to garbage collection, replica_count = %d", (int)rs->size());
 
     // statistic learning info
     uint64_t learning_count = 0;
@@ -1389,8 +1494,8 @@ void replica_stub::on_gc()
     uint64_t cold_backup_running_count = 0;
     uint64_t cold_backup_max_duration_time_ms = 0;
     uint64_t cold_backup_max_upload_file_size = 0;
-    for (auto it = rs.begin(); it != rs.end(); ++it) {
-        replica_ptr &r = it->second;
+    for (auto it = rs->begin(); it != rs->end(); ++it) {
+        const replica_ptr &r = it->second;
         if (r->status() == partition_status::PS_POTENTIAL_SECONDARY) {
             learning_count++;
             learning_max_duration_time_ms = std::max(learning_max_duration_time_ms,
@@ -1439,11 +1544,12 @@ void replica_stub::on_gc()
     //      garbage
     //      collection of the oldest log file.
     //
-    if (_log != nullptr) {
-        replica_log_info_map gc_condition;
-        for (auto it = rs.begin(); it != rs.end(); ++it) {
+    if (!_logs.empty()) {
+        // valid_start_offset is only meaningful for the stream the replica is logged to
+        std::vector<replica_log_info_map> gc_conditions(_logs.size());
+        for (auto it = rs->begin(); it != rs->end(); ++it) {
             replica_log_info ri;
-            replica_ptr &r = it->second;
+            const replica_ptr &r = it->second;
             mutation_log_ptr plog = r->private_log();
             if (plog) {
                 // flush private log to update plog_max_commit_on_disk,
@@ -1470,19 +1576,25 @@ void replica_stub::on_gc()
                        r->last_durable_decree());
             }
             ri.valid_start_offset = r->get_app()->init_info().init_offset_in_shared_log;
-            gc_condition[it->first] = ri;
+            gc_conditions[get_shared_log_index(it->first)][it->first] = ri;
         }
 
         std::set<gpid> prevent_gc_replicas;
-        int reserved_log_count = _log->garbage_collection(
-            gc_condition, _options.log_shared_file_count_limit, prevent_gc_replicas);
+        int reserved_log_count = 0;
+        int64_t total_log_size = 0;
+        for (size_t i = 0; i < _logs.size(); i++) {
+            int count = _logs[i]->garbage_collection(
+                gc_conditions[i], _options.log_shared_file_count_limit, prevent_gc_replicas);
+            reserved_log_count = std::max(reserved_log_count, count);
+            total_log_size += _logs[i]->size();
+        }
         if (reserved_log_count > _options.log_shared_file_count_limit * 2) {
             ddebug("gc_shared: trigger emergency checkpoint by log_shared_file_count_limit, "
                    "file_count_limit = %d, reserved_log_count = %d, trigger all replicas to do "
                    "checkpoint",
                    _options.log_shared_file_count_limit,
                    reserved_log_count);
-            for (auto it = rs.begin(); it != rs.end(); ++it) {
+            for (auto it = rs->begin(); it != rs->end(); ++it) {
                 tasking::enqueue(
                     LPC_PER_REPLICA_CHECKPOINT_TIMER,
                     this,
@@ -1509,8 +1621,8 @@ void replica_stub::on_gc()
                    (int)prevent_gc_replicas.size(),
                    oss.str().c_str());
             for (auto &id : prevent_gc_replicas) {
-                auto find = rs.find(id);
-                if (find != rs.end()) {
+                auto find = rs->find(id);
+                if (find != rs->end()) {
                     tasking::enqueue(
                         LPC_PER_REPLICA_CHECKPOINT_TIMER,
                         this,
@@ -1523,7 +1635,7 @@ void replica_stub::on_gc()
             }
         }
 
-        _counter_shared_log_size->set(_log->size() / (1024 * 1024));
+        _counter_shared_log_size->set(total_log_size / (1024 * 1024));
     }
 
     ddebug("finish to garbage collection, time_used_ns = %" PRIu64, dsn_now_ns() - start);
@@ -1593,9 +1705,69 @@ void replica_stub::on_disk_stat()
 
     _fs_manager.update_disk_stat();
 
+    // storage size of the replicas, reported to the meta server for load balancing
+    dir_size_cache visited;
+    std::shared_ptr<const replicas> rs = _replicas_snapshot.get();
+    for (auto &kv : *rs) {
+        const replica_ptr &r = kv.second;
+        int64_t total_size = get_dir_size(r->dir(), visited);
+        mutation_log_ptr plog = r->private_log();
+        if (plog != nullptr) {
+            total_size -= get_dir_size(utils::filesystem::path_combine(r->dir(), "plog"), visited);
+            total_size += plog->size();
+        }
+        r->load_stats().set_storage_mb(std::max<int64_t>(total_size, 0) / (1024 * 1024));
+    }
+    // forget the directories of the removed replicas
+    _dir_size_cache.swap(visited);
+
     ddebug("finish to update disk stat, time_used_ns = %" PRIu64, dsn_now_ns() - start);
 }
 
+int64_t replica_stub::get_dir_size(const std::string &dir, /*inout*/ dir_size_cache &visited)
+{
+    auto it = visited.find(dir);
+    if (it == visited.end()) {
+        time_t mt = 0;
+        if (!dsn::utils::filesystem::last_write_time(dir, mt)) {
+            dwarn("disk_stat: failed to get last write time of %s", dir.c_str());
+            return 0;
+        }
+
+        dir_size_entry &e = visited[dir];
+        auto cached = _dir_size_cache.find(dir);
+        if (cached != _dir_size_cache.end() && cached->second.mtime == mt) {
+            e = std::move(cached->second);
+        } else {
+            std::vector<std::string> files;
+            if (!dsn::utils::filesystem::get_subfiles(dir, files, false) ||
+                !dsn::utils::filesystem::get_subdirectories(dir, e.sub_dirs, false)) {
+                dwarn("disk_stat: failed to list %s", dir.c_str());
+                mt = 0;
+            }
+            e.files_size = 0;
+            for (auto &f : files) {
+                int64_t sz = 0;
+                if (dsn::utils::filesystem::file_size(f, sz)) {
+                    e.files_size += sz;
+                }
+            }
+            // the last write time is in seconds, so a directory changed within the same
+            // second may change again unnoticed, list it again next time
+            e.mtime = (mt >= ::time(nullptr) - 1) ? 0 : mt;
+        }
+        it = visited.find(dir);
+    }
+
+    // references to the elements are kept valid when visited grows
+    const dir_size_entry &e = it->second;
+    int64_t total_size = e.files_size;
+    for (const std::string &sub_dir : e.sub_dirs) {
+        total_size += get_dir_size(sub_dir, visited);
+    }
+    return total_size;
+}
+
 ::dsn::task_ptr replica_stub::begin_open_replica(const app_info &app,
                                                  gpid gpid,
                                                  std::shared_ptr<group_check_request> req,
@@ -1630,6 +1802,7 @@ void replica_stub::on_disk_stat()
 
                 auto pr = _replicas.insert(replicas::value_type(gpid, r));
                 dassert(pr.second, "replica %s is already in the collection", r->name());
+                publish_replicas_snapshot();
                 _counter_replicas_count->increment();
 
                 _closed_replicas.erase(gpid);
@@ -1735,6 +1908,7 @@ void replica_stub::open_replica(const app_info &app,
         auto it = _replicas.find(gpid);
         dassert(it == _replicas.end(), "replica %s is already in _replicas", rep->name());
         _replicas.insert(replicas::value_type(rep->get_gpid(), rep));
+        publish_replicas_snapshot();
         _counter_replicas_count->increment();
 
         _closed_replicas.erase(gpid);
@@ -1760,6 +1934,7 @@ void replica_stub::open_replica(const app_info &app,
     zauto_write_lock l(_replicas_lock);
 
     if (_replicas.erase(r->get_gpid()) > 0) {
+        publish_replicas_snapshot();
         _counter_replicas_count->decrement();
 
         int delay_ms = 0;
@@ -1904,12 +2079,8 @@ void replica_stub::open_service()
         "trigger-checkpoint - trigger all replicas to do checkpoints",
         [this](const std::vector<std::string> &args) {
             ddebug("start to trigger checkpoint by remote command");
-            replicas rs;
-            {
-                zauto_read_lock l(_replicas_lock);
-                rs = _replicas;
-            }
-            for (auto it = rs.begin(); it != rs.end(); ++it) {
+            std::shared_ptr<const replicas> rs = _replicas_snapshot.get();
+            for (auto it = rs->begin(); it != rs->end(); ++it) {
                 tasking::enqueue(
                     LPC_PER_REPLICA_CHECKPOINT_TIMER,
                     this,
@@ -2001,6 +2172,7 @@ void replica_stub::close()
             _counter_replicas_count->decrement();
             _replicas.erase(_replicas.begin());
         }
+        publish_replicas_snapshot();
     }
 
     if (_failure_detector != nullptr) {
@@ -2009,10 +2181,57 @@ void replica_stub::close()
         _failure_detector = nullptr;
     }
 
-    if (_log != nullptr) {
-        _log->close();
-        _log = nullptr;
+    for (auto &log : _logs) {
+        log->close();
+        log = nullptr;
+    }
+    _logs.clear();
+}
+
+std::string replica_stub::get_shared_log_streams_file() const
+{
+    return utils::filesystem::path_combine(utils::filesystem::remove_file_name(_options.slog_dir),
+                                           "slog.streams");
+}
+
+int replica_stub::get_shared_log_stream_count() const
+{
+    std::string file = get_shared_log_streams_file();
+    if (utils::filesystem::file_exists(file)) {
+        std::ifstream is(file);
+        int count = 0;
+        is >> count;
+        dassert(!is.fail() && count > 0, "invalid shared log stream count in %s", file.c_str());
+        return count;
+    }
+
+    // logs written before striping is introduced are all in slog_dir
+    std::vector<std::string> files;
+    if (utils::filesystem::get_subfiles(_options.slog_dir, files, false) && !files.empty()) {
+        return 1;
     }
+    return _options.log_shared_stream_count;
+}
+
+std::vector<std::string> replica_stub::get_shared_log_dirs(int stream_count) const
+{
+    std::vector<std::string> dirs;
+    dirs.push_back(_options.slog_dir);
+    for (int i = 1; i < stream_count; i++) {
+        const std::string &data_dir = _options.data_dirs[i % _options.data_dirs.size()];
+        dirs.push_back(utils::filesystem::path_combine(
+            utils::filesystem::remove_file_name(data_dir), "slog." + std::to_string(i)));
+    }
+    return dirs;
+}
+
+mutation_log_ptr replica_stub::create_shared_log(const std::string &dir) const
+{
+    return new mutation_log_shared(dir,
+                                   _options.log_shared_file_size_mb,
+                                   _options.log_shared_force_flush,
+                                   _options.log_shared_batch_buffer_kb * 1024,
+                                   _options.log_shared_group_commit_delay_ms);
 }
 
 std::string replica_stub::get_replica_dir(const char *app_type, gpid gpid, bool create_new)
@@ -47,6 +47,7 @@
 #include "replica.h"
 #include <dsn/cpp/perf_counter_wrapper.h>
 #include <dsn/dist/failure_detector_multimaster.h>
+#include <dsn/utility/rcu_snapshot.h>
 
 namespace dsn {
 namespace replication {
@@ -143,6 +144,12 @@ public:
 
     std::string get_replica_dir(const char *app_type, gpid gpid, bool create_new = true);
 
+    // the shared log stream which the replica writes its mutations to
+    const mutation_log_ptr &shared_log(gpid pid) const
+    {
+        return _logs[get_shared_log_index(pid)];
+    }
+
 private:
     enum replica_node_state
     {
@@ -187,8 +194,33 @@ private:
 
     void get_replica_info(/*out*/ replica_info &info, /*in*/ replica_ptr r);
     void get_local_replicas(/*out*/ std::vector<replica_info> &replicas);
+    // fetch and reset the load statistics of the serving replicas
+    void get_load_stats(/*out*/ std::vector<replica_load_stat> &stats);
     replica_life_cycle get_replica_life_cycle(const dsn::gpid &pid);
     void on_gc_replica(replica_stub_ptr this_, gpid pid);
+    // must be called with _replicas_lock write-locked after _replicas is changed
+    void publish_replicas_snapshot();
+
+    struct dir_size_entry
+    {
+        time_t mtime;
+        int64_t files_size; // of the files directly in the directory
+        std::vector<std::string> sub_dirs;
+    };
+    typedef std::unordered_map<std::string, dir_size_entry> dir_size_cache;
+    // the total size of the files under dir, the directories visited are moved or added
+    // from _dir_size_cache into visited
+    int64_t get_dir_size(const std::string &dir, /*inout*/ dir_size_cache &visited);
+
+    int get_shared_log_index(gpid pid) const
+    {
+        return static_cast<int>(static_cast<unsigned int>(gpid_to_thread_hash(pid)) %
+                                _logs.size());
+    }
+    std::string get_shared_log_streams_file() const;
+    int get_shared_log_stream_count() const;
+    std::vector<std::string> get_shared_log_dirs(int stream_count) const;
+    mutation_log_ptr create_shared_log(const std::string &dir) const;
 
 private:
     friend class ::dsn::replication::replication_checker;
@@ -203,11 +235,16 @@ private:
 
     mutable zrwlock_nr _replicas_lock;
     replicas _replicas;
+    // read-only copy of _replicas for the lookups on the hot path without taking
+    // _replicas_lock, republished by publish_replicas_snapshot() on every change of _replicas
+    utils::rcu_snapshot<replicas> _replicas_snapshot;
     opening_replicas _opening_replicas;
     closing_replicas _closing_replicas;
     closed_replicas _closed_replicas;
 
-    mutation_log_ptr _log;
+    // shared log streams, each replica is bound to one of them by get_shared_log_index(),
+    // _logs[0] is in slog_dir and the others are striped across the data dirs
+    std::vector<mutation_log_ptr> _logs;
     ::dsn::rpc_address _primary_address;
 
     ::dsn::dist::slave_failure_detector_with_multimaster *_failure_detector;
@@ -221,9 +258,20 @@ private:
 
     // temproal states
     ::dsn::task_ptr _config_query_task;
+    // the version of the config sync response applied last time, which is sent back to
+    // the meta server so that only the changed partitions are returned
+    int64_t _config_sync_epoch;
+    int64_t _config_sync_version;
+    int32_t _config_sync_count;
+    bool _config_sync_full;
     ::dsn::task_ptr _config_sync_timer_task;
     ::dsn::task_ptr _gc_timer_task;
     ::dsn::task_ptr _disk_stat_timer_task;
+    // the directories under the replica dirs, which are only listed and stat-ed again by
+    // on_disk_stat() when their last write time changes, i.e., when a file is created,
+    // removed or renamed in them. so a file written in place is not seen until then, except
+    // the private logs, whose sizes are known by the replicas
+    dir_size_cache _dir_size_cache;
 
     // command_handlers
     dsn_handle_t _kill_partition_command;
@@ -35,6 +35,7 @@
  */
 
 #include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <queue>
 #include <dsn/tool-api/command_manager.h>
@@ -48,16 +49,24 @@ greedy_load_balancer::greedy_load_balancer(meta_service *_svc)
     : simple_load_balancer(_svc),
       _ctrl_balancer_in_turn(nullptr),
       _ctrl_only_primary_balancer(nullptr),
-      _ctrl_only_move_primary(nullptr)
+      _ctrl_only_move_primary(nullptr),
+      _ctrl_load_aware_balancer(nullptr)
 {
     if (_svc != nullptr) {
         _balancer_in_turn = _svc->get_meta_options()._lb_opts.balancer_in_turn;
         _only_primary_balancer = _svc->get_meta_options()._lb_opts.only_primary_balancer;
         _only_move_primary = _svc->get_meta_options()._lb_opts.only_move_primary;
+        _load_aware_balancer = _svc->get_meta_options()._lb_opts.load_aware_balancer;
+        _load_aware_time_budget_ms =
+            _svc->get_meta_options()._lb_opts.load_aware_balancer_time_budget_ms;
+        _load_aware_max_moves = _svc->get_meta_options()._lb_opts.load_aware_balancer_max_moves;
     } else {
         _balancer_in_turn = false;
         _only_primary_balancer = false;
         _only_move_primary = false;
+        _load_aware_balancer = false;
+        _load_aware_time_budget_ms = 1000;
+        _load_aware_max_moves = 20;
     }
 }
 
@@ -66,6 +75,7 @@ greedy_load_balancer::~greedy_load_balancer()
     UNREGISTER_VALID_HANDLER(_ctrl_balancer_in_turn);
     UNREGISTER_VALID_HANDLER(_ctrl_only_move_primary);
     UNREGISTER_VALID_HANDLER(_ctrl_only_move_primary);
+    UNREGISTER_VALID_HANDLER(_ctrl_load_aware_balancer);
 }
 
 void greedy_load_balancer::register_ctrl_commands()
@@ -96,6 +106,14 @@ void greedy_load_balancer::register_ctrl_commands()
         [this](const std::vector<std::string> &args) {
             HANDLE_CLI_FLAGS(_only_move_primary, args);
         });
+
+    _ctrl_load_aware_balancer = dsn::command_manager::instance().register_app_command(
+        {"lb.load_aware_balancer"},
+        "lb.load_aware_balancer <true|false>",
+        "control whether balance by the reported load instead of the replica count",
+        [this](const std::vector<std::string> &args) {
+            HANDLE_CLI_FLAGS(_load_aware_balancer, args);
+        });
 }
 
 void greedy_load_balancer::unregister_ctrl_commands()
@@ -103,6 +121,7 @@ void greedy_load_balancer::unregister_ctrl_commands()
     UNREGISTER_VALID_HANDLER(_ctrl_balancer_in_turn);
     UNREGISTER_VALID_HANDLER(_ctrl_only_move_primary);
     UNREGISTER_VALID_HANDLER(_ctrl_only_move_primary);
+    UNREGISTER_VALID_HANDLER(_ctrl_load_aware_balancer);
 
     simple_load_balancer::unregister_ctrl_commands();
 }
@@ -833,6 +852,253 @@ bool greedy_load_balancer::all_replica_infos_collected(const node_state &ns)
     });
 }
 
+//
+// the load-aware balancer estimates the cost of each serving replica from what the replica
+// servers report in config sync:
+//   - qps: the reads served by the replica, plus the writes of the partition as every member
+//     applies them;
+//   - storage: the size of the replica directory.
+// both are normalized by the cluster-wide sum and added up, so a node's load is its share of the
+// cluster's qps plus its share of the storage.
+//
+// then it greedily picks the node with the peak load, and moves to a less loaded node the replica
+// whose cost is closest to half of their gap, so that the peak always drops. a primary is moved
+// (only its reads move then) if the target is a secondary, otherwise the replica is copied.
+// among replicas of equal cost, the one on the fullest disk of the source node is preferred.
+//
+// planning stops when the peak is within the tolerance of the mean, no move can reduce the peak,
+// or the round runs out of its move count or time budget. false is returned if no move is
+// planned, e.g., no load is reported yet or the load is balanced, so that the replica count
+// is balanced instead.
+//
+bool greedy_load_balancer::load_aware_balancer()
+{
+    struct replica_cost
+    {
+        int node;
+        bool is_primary;
+        const std::string *disk_tag;
+        double read_qps;
+        double qps;
+        double storage_mb;
+        double cost;
+    };
+    struct partition_replicas
+    {
+        const partition_configuration *pc;
+        bool movable;
+        std::vector<int> replicas;
+    };
+
+    uint64_t start_ms = dsn_now_ms();
+    std::vector<partition_replicas> partitions;
+    std::vector<replica_cost> replicas;
+    std::vector<std::vector<std::pair<int, int>>> node_replicas(address_vec.size());
+    double total_qps = 0;
+    double total_storage_mb = 0;
+    static const std::string empty_tag;
+
+    for (const auto &kv : *(t_global_view->apps)) {
+        const std::shared_ptr<app_state> &app = kv.second;
+        if (app->status != app_status::AS_AVAILABLE)
+            continue;
+
+        for (int i = 0; i < app->partition_count; ++i) {
+            const partition_configuration &pc = app->partitions[i];
+            const config_context &cc = app->helpers->contexts[i];
+            if (pc.primary.is_invalid())
+                continue;
+
+            partition_replicas pr;
+            pr.pc = &pc;
+            // partitions under cure are left to the cure stage
+            pr.movable = static_cast<int>(pc.secondaries.size()) + 1 >= pc.max_replica_count;
+
+            int64_t write_qps = 0;
+            for (const serving_replica &s : cc.serving) {
+                write_qps = std::max(write_qps, s.load.write_qps);
+            }
+
+            std::vector<rpc_address> members(pc.secondaries);
+            members.insert(members.begin(), pc.primary);
+            for (const rpc_address &node : members) {
+                auto it = address_id.find(node);
+                if (it == address_id.end())
+                    continue;
+
+                replica_cost r;
+                r.node = it->second;
+                r.is_primary = (node == pc.primary);
+                auto s = cc.find_from_serving(node);
+                r.disk_tag = s == cc.serving.end() ? &empty_tag : &s->disk_tag;
+                r.read_qps = s == cc.serving.end() ? 0 : s->load.read_qps;
+                r.qps = r.read_qps + write_qps;
+                r.storage_mb = s == cc.serving.end() ? 0 : s->storage_mb;
+                r.cost = 0;
+                total_qps += r.qps;
+                total_storage_mb += r.storage_mb;
+
+                node_replicas[r.node].emplace_back(partitions.size(), replicas.size());
+                pr.replicas.push_back(replicas.size());
+                replicas.push_back(r);
+            }
+            partitions.push_back(std::move(pr));
+        }
+    }
+
+    if (total_qps <= 0 && total_storage_mb <= 0) {
+        return false;
+    }
+
+    auto qps_share = [total_qps](double qps) { return total_qps > 0 ? qps / total_qps : 0; };
+    std::vector<double> node_load(address_vec.size(), 0);
+    std::vector<std::map<std::string, double>> disk_storage(address_vec.size());
+    for (replica_cost &r : replicas) {
+        r.cost = qps_share(r.qps) + (total_storage_mb > 0 ? r.storage_mb / total_storage_mb : 0);
+        node_load[r.node] += r.cost;
+        disk_storage[r.node][*r.disk_tag] += r.storage_mb;
+    }
+
+    // loads are measured, so leave a margin to avoid moving back and forth on noise
+    const double tolerance = 0.05;
+    double mean_load = 0;
+    for (int id = 1; id <= t_alive_nodes; ++id) {
+        mean_load += node_load[id];
+    }
+    mean_load /= t_alive_nodes;
+
+    std::vector<int> node_ids(t_alive_nodes);
+    for (int id = 1; id <= t_alive_nodes; ++id) {
+        node_ids[id - 1] = id;
+    }
+
+    double peak_before = *std::max_element(node_load.begin(), node_load.end());
+    int moves = 0;
+    while (moves < _load_aware_max_moves) {
+        if (dsn_now_ms() - start_ms > _load_aware_time_budget_ms) {
+            ddebug("load aware balancer: stop planning coz time budget(%" PRIu64 " ms) used up",
+                   _load_aware_time_budget_ms);
+            break;
+        }
+
+        std::sort(node_ids.begin(), node_ids.end(), [&node_load](int id1, int id2) {
+            return node_load[id1] != node_load[id2] ? node_load[id1] < node_load[id2]
+                                                    : id1 < id2;
+        });
+        int hi = node_ids.back();
+        if (node_load[hi] <= mean_load * (1 + tolerance)) {
+            ddebug("load aware balancer: stop planning coz peak load(%.4f) is close to mean(%.4f)",
+                   node_load[hi],
+                   mean_load);
+            break;
+        }
+
+        const std::map<std::string, double> &hi_disks = disk_storage[hi];
+        bool found = false;
+        for (int lo : node_ids) {
+            double gap = node_load[hi] - node_load[lo];
+            if (lo == hi || gap <= mean_load * tolerance)
+                break;
+
+            const node_state &lo_ns = (*(t_global_view->nodes))[address_vec[lo]];
+            int best = -1;
+            int best_partition = -1;
+            double best_delta = 0;
+            double best_score = 0;
+            balance_type best_type = balance_type::copy_secondary;
+            for (const auto &pr_r : node_replicas[hi]) {
+                const partition_replicas &pr = partitions[pr_r.first];
+                const replica_cost &r = replicas[pr_r.second];
+                if (!pr.movable ||
+                    t_migration_result->find(pr.pc->pid) != t_migration_result->end())
+                    continue;
+
+                double delta;
+                balance_type type;
+                partition_status::type lo_status = lo_ns.served_as(pr.pc->pid);
+                if (lo_status == partition_status::PS_INACTIVE) {
+                    if (_only_move_primary || (_only_primary_balancer && !r.is_primary))
+                        continue;
+                    delta = r.cost;
+                    type = r.is_primary ? balance_type::copy_primary : balance_type::copy_secondary;
+                } else if (r.is_primary && lo_status == partition_status::PS_SECONDARY) {
+                    double lo_read_qps = 0;
+                    for (int idx : pr.replicas) {
+                        if (replicas[idx].node == lo)
+                            lo_read_qps = replicas[idx].read_qps;
+                    }
+                    delta = qps_share(r.read_qps) - qps_share(lo_read_qps);
+                    type = balance_type::move_primary;
+                } else {
+                    continue;
+                }
+
+                // the peak must drop, so the source must stay above the target after the move
+                if (delta <= 0 || delta >= gap)
+                    continue;
+
+                double score = std::abs(delta - gap / 2);
+                bool better = best == -1 || score < best_score;
+                if (!better && score == best_score) {
+                    const replica_cost &b = replicas[best];
+                    better = hi_disks.at(*r.disk_tag) > hi_disks.at(*b.disk_tag);
+                }
+                if (better) {
+                    best = pr_r.second;
+                    best_partition = pr_r.first;
+                    best_delta = delta;
+                    best_score = score;
+                    best_type = type;
+                }
+            }
+
+            if (best != -1) {
+                const partition_configuration &pc = *partitions[best_partition].pc;
+                ddebug("load aware balancer: %s gpid(%d.%d) from %s(load %.4f) to %s(load %.4f), "
+                       "cost = %.4f",
+                       best_type == balance_type::move_primary
+                           ? "move primary of"
+                           : (best_type == balance_type::copy_primary ? "copy primary of"
+                                                                       : "copy secondary of"),
+                       pc.pid.get_app_id(),
+                       pc.pid.get_partition_index(),
+                       address_vec[hi].to_string(),
+                       node_load[hi],
+                       address_vec[lo].to_string(),
+                       node_load[lo],
+                       best_delta);
+                t_migration_result->emplace(
+                    pc.pid,
+                    generate_balancer_request(pc, best_type, address_vec[hi], address_vec[lo]));
+                node_load[hi] -= best_delta;
+                node_load[lo] += best_delta;
+                if (best_type != balance_type::move_primary) {
+                    const replica_cost &r = replicas[best];
+                    disk_storage[hi][*r.disk_tag] -= r.storage_mb;
+                }
+                ++moves;
+                found = true;
+                break;
+            }
+        }
+
+        if (!found) {
+            ddebug("load aware balancer: stop planning coz the load of %s can't be reduced",
+                   address_vec[hi].to_string());
+            break;
+        }
+    }
+
+    ddebug("load aware balancer: planned %d moves, peak load %.4f -> %.4f, mean load %.4f, "
+           "time_used = %" PRIu64 " ms",
+           moves,
+           peak_before,
+           *std::max_element(node_load.begin(), node_load.end()),
+           mean_load,
+           dsn_now_ms() - start_ms);
+    return moves > 0;
+}
+
 void greedy_load_balancer::greedy_balancer()
 {
     const app_mapper &apps = *t_global_view->apps;
@@ -847,6 +1113,13 @@ void greedy_load_balancer::greedy_balancer()
         }
     }
 
+    if (_load_aware_balancer) {
+        if (load_aware_balancer()) {
+            return;
+        }
+        ddebug("no load aware move is planned, fall back to balance by replica count");
+    }
+
     for (const auto &kv : apps) {
         const std::shared_ptr<app_state> &app = kv.second;
         if (app->status != app_status::AS_AVAILABLE)
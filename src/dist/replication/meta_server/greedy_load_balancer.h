@@ -76,10 +76,14 @@ private:
     bool _balancer_in_turn;
     bool _only_primary_balancer;
     bool _only_move_primary;
+    bool _load_aware_balancer;
+    uint64_t _load_aware_time_budget_ms;
+    int32_t _load_aware_max_moves;
 
     dsn_handle_t _ctrl_balancer_in_turn;
     dsn_handle_t _ctrl_only_primary_balancer;
     dsn_handle_t _ctrl_only_move_primary;
+    dsn_handle_t _ctrl_load_aware_balancer;
 
 private:
     void number_nodes(const node_mapper &nodes);
@@ -108,6 +112,10 @@ private:
     bool copy_secondary_per_app(const std::shared_ptr<app_state> &app);
     bool secondary_balancer_globally();
 
+    // balance by the load reported in config sync instead of the replica count,
+    // return false if there is no load reported yet
+    bool load_aware_balancer();
+
     void greedy_balancer();
 
     bool all_replica_infos_collected(const node_state &ns);
@@ -346,12 +346,31 @@ void config_context::collect_serving_replica(const rpc_address &node, const repl
     auto iter = find_from_serving(node);
     if (iter != serving.end()) {
         iter->disk_tag = info.disk_tag;
-        iter->storage_mb = 0;
     } else {
         serving.emplace_back(serving_replica{node, 0, info.disk_tag});
     }
 }
 
+bool config_context::collect_serving_load(const rpc_address &node, const replica_load_stat &load)
+{
+    auto iter = find_from_serving(node);
+    if (iter == serving.end()) {
+        return false;
+    }
+    iter->load = load;
+    iter->storage_mb = load.storage_mb;
+    return true;
+}
+
+int64_t config_context::total_qps() const
+{
+    int64_t qps = 0;
+    for (const serving_replica &r : serving) {
+        qps += r.load.read_qps + r.load.write_qps;
+    }
+    return qps;
+}
+
 void config_context::adjust_proposal(const rpc_address &node, const replica_info &info)
 {
     lb_actions.track_current_learner(node, info);
@@ -363,8 +382,10 @@ void app_state_helper::on_init_partitions()
     context.stage = config_status::not_pending;
     context.pending_sync_task = nullptr;
     context.msg = nullptr;
+    context.config_version = 0;
 
     context.prefered_dropped = -1;
+    context.is_hotspot = false;
     contexts.assign(owner->partition_count, context);
 
     std::vector<partition_configuration> &partitions = owner->partitions;
@@ -402,7 +423,11 @@ std::shared_ptr<app_state> app_state::create(const app_info &info)
 }
 
 node_state::node_state()
-    : total_primaries(0), total_partitions(0), is_alive(false), has_collected_replicas(false)
+    : total_primaries(0),
+      total_partitions(0),
+      is_alive(false),
+      has_collected_replicas(false),
+      partition_removed_version(0)
 {
 }
 
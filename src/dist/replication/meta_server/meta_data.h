@@ -177,9 +177,11 @@ inline int dropped_cmp(const dropped_replica &d1, const dropped_replica &d2)
 struct serving_replica
 {
     dsn::rpc_address node;
-    // TODO: report the storage size of replica
+    // reported by the replica server with the load, see replica_load_stat
     int64_t storage_mb;
     std::string disk_tag;
+    // load of the replica reported in the last config sync
+    replica_load_stat load;
 };
 
 class config_context
@@ -192,6 +194,9 @@ public:
     task_ptr pending_sync_task;
     std::shared_ptr<configuration_update_request> pending_sync_request;
     dsn_message_t msg;
+    // the config version of server state when this partition was changed last time,
+    // used by config sync to send only the changed partitions
+    int64_t config_version;
     //]
 
     // for load balancer's decision
@@ -208,6 +213,9 @@ public:
     //
     // TODO: a more clear implementation
     int32_t prefered_dropped;
+
+    // set by the hotspot detector if the load of this partition is far above the app's mean
+    bool is_hotspot;
     //]
 public:
     void check_size();
@@ -241,6 +249,12 @@ public:
 
     void collect_serving_replica(const dsn::rpc_address &node, const replica_info &info);
 
+    // return false if the node is not serving this partition
+    bool collect_serving_load(const dsn::rpc_address &node, const replica_load_stat &load);
+
+    // sum of the qps of all the serving replicas
+    int64_t total_qps() const;
+
     void adjust_proposal(const dsn::rpc_address &node, const replica_info &info);
 
 public:
@@ -358,6 +372,8 @@ private:
     bool is_alive;
     bool has_collected_replicas;
     dsn::rpc_address address;
+    // the config version when a partition was removed from this node last time
+    int64_t partition_removed_version;
 
     const partition_set *get_partitions(app_id id, bool only_primary) const;
     partition_set *get_partitions(app_id id, bool only_primary, bool create_new);
@@ -383,6 +399,8 @@ public:
     void set_replicas_collect_flag(bool has_collected) { has_collected_replicas = has_collected; }
     dsn::rpc_address addr() const { return address; }
     void set_addr(const dsn::rpc_address &addr) { address = addr; }
+    int64_t removed_version() const { return partition_removed_version; }
+    void set_removed_version(int64_t version) { partition_removed_version = version; }
 
     void put_partition(const dsn::gpid &pid, bool is_primary);
     void remove_partition(const dsn::gpid &pid, bool only_primary);
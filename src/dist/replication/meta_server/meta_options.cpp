@@ -115,6 +115,30 @@ void meta_options::initialize()
         10,
         "add secondary max count for one node when flow control enabled");
 
+    hotspot_qps_factor = dsn_config_get_value_double(
+        "meta_server",
+        "hotspot_qps_factor",
+        3.0,
+        "a partition is a hotspot if its qps is more than hotspot_qps_factor times the mean "
+        "qps of the partitions in the same app");
+    hotspot_min_qps =
+        dsn_config_get_value_uint64("meta_server",
+                                    "hotspot_min_qps",
+                                    1000,
+                                    "partitions with less qps than this are never hotspots");
+
+    config_sync_batch_interval_ms = dsn_config_get_value_uint64(
+        "meta_server",
+        "config_sync_batch_interval_ms",
+        10,
+        "how long partition config updates are collected before persisted in one transaction, "
+        "0 for persisting them one by one");
+    config_sync_batch_max_count =
+        (int32_t)dsn_config_get_value_uint64("meta_server",
+                                             "config_sync_batch_max_count",
+                                             64,
+                                             "max partition config updates in one transaction");
+
     /// failure detector options
     _fd_opts.distributed_lock_service_type =
         dsn_config_get_value_string("meta_server",
@@ -160,6 +184,22 @@ void meta_options::initialize()
         "meta_server", "only_primary_balancer", false, "only try to make the primary balanced");
     _lb_opts.only_move_primary = dsn_config_get_value_bool(
         "meta_server", "only_move_primary", false, "only try to make the primary balanced by move");
+    _lb_opts.load_aware_balancer =
+        dsn_config_get_value_bool("meta_server",
+                                  "load_aware_balancer",
+                                  false,
+                                  "balance by the reported qps and storage of the replicas "
+                                  "instead of the replica count");
+    _lb_opts.load_aware_balancer_time_budget_ms =
+        dsn_config_get_value_uint64("meta_server",
+                                    "load_aware_balancer_time_budget_ms",
+                                    1000,
+                                    "max time to plan the moves in one load-aware balancer round");
+    _lb_opts.load_aware_balancer_max_moves =
+        (int32_t)dsn_config_get_value_uint64("meta_server",
+                                             "load_aware_balancer_max_moves",
+                                             20,
+                                             "max moves in one load-aware balancer round");
 
     cold_backup_disabled = dsn_config_get_value_bool(
         "meta_server", "cold_backup_disabled", true, "whether to disable cold backup");
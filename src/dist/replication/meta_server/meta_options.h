@@ -61,6 +61,10 @@ public:
     bool balancer_in_turn;
     bool only_primary_balancer;
     bool only_move_primary;
+
+    bool load_aware_balancer;
+    uint64_t load_aware_balancer_time_budget_ms;
+    int32_t load_aware_balancer_max_moves;
 };
 
 class meta_options
@@ -79,6 +83,13 @@ public:
     bool add_secondary_enable_flow_control;
     int32_t add_secondary_max_count_for_one_node;
 
+    double hotspot_qps_factor;
+    uint64_t hotspot_min_qps;
+
+    // partition config updates are persisted in batches, 0 for one by one
+    uint64_t config_sync_batch_interval_ms;
+    int32_t config_sync_batch_max_count;
+
     fd_suboptions _fd_opts;
     lb_suboptions _lb_opts;
 
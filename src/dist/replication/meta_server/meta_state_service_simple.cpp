@@ -31,13 +31,15 @@
  * Revision history:
  *     2015-11-04, @imzhenyu (Zhenyu.Guo@microsoft.com), setup the sketch
  *     2015-11-11, Tianyi WANG, first version done
- *     xxxx-xx-xx, author, fix bug about xxx
+ *     xxxx-xx-xx, author, log segments and snapshots
  */
 
 #include "meta_state_service_simple.h"
 #include <dsn/tool-api/task.h>
 #include <dsn/utility/filesystem.h>
+#include <dsn/utility/crc.h>
 
+#include <algorithm>
 #include <stack>
 #include <utility>
 
@@ -83,6 +85,11 @@ void meta_state_service_simple::write_log(blob &&log_blob,
                                           task_ptr task)
 {
     _log_lock.lock();
+    if (_offset >= _log_segment_size && !_snapshot_in_progress) {
+        rotate_log();
+    }
+    // the handle may be switched by the next write once the lock is released
+    dsn_handle_t log = _log;
     uint64_t log_offset = _offset;
     _offset += log_blob.length();
     auto continuation_task = std::unique_ptr<operation>(new operation(false, [=](bool log_succeed) {
@@ -93,7 +100,7 @@ void meta_state_service_simple::write_log(blob &&log_blob,
     _task_queue.emplace(move(continuation_task));
     _log_lock.unlock();
 
-    file::write(_log,
+    file::write(log,
                 log_blob.data(),
                 log_blob.length(),
                 log_offset,
@@ -231,72 +238,400 @@ error_code meta_state_service_simple::apply_transaction(
     return ERR_OK;
 }
 
+static const char *log_prefix = "meta_state_service.log.";
+static const char *snapshot_prefix = "meta_state_service.snapshot.";
+
+std::string meta_state_service_simple::log_path(int64_t index) const
+{
+    return utils::filesystem::path_combine(_work_dir, log_prefix + std::to_string(index));
+}
+
+std::string meta_state_service_simple::snapshot_path(int64_t index) const
+{
+    return utils::filesystem::path_combine(_work_dir, snapshot_prefix + std::to_string(index));
+}
+
+std::vector<int64_t> meta_state_service_simple::get_file_indexes(const std::string &prefix) const
+{
+    std::vector<int64_t> indexes;
+    std::vector<std::string> files;
+    if (!utils::filesystem::get_subfiles(_work_dir, files, false)) {
+        derror("get subfiles of %s failed", _work_dir.c_str());
+        return indexes;
+    }
+    for (auto &f : files) {
+        std::string name = utils::filesystem::get_file_name(f);
+        if (name.length() <= prefix.length() || name.compare(0, prefix.length(), prefix) != 0) {
+            continue;
+        }
+        std::string suffix = name.substr(prefix.length());
+        if (suffix.find_first_not_of("0123456789") != std::string::npos) {
+            // e.g., the temporary file of an unfinished snapshot
+            continue;
+        }
+        indexes.push_back(std::stoll(suffix));
+    }
+    std::sort(indexes.begin(), indexes.end());
+    return indexes;
+}
+
+error_code meta_state_service_simple::replay_log(const std::string &path,
+                                                 /*out*/ uint64_t &log_size)
+{
+    log_size = 0;
+    FILE *fd = fopen(path.c_str(), "rb");
+    if (fd == nullptr) {
+        derror("open file failed: %s", path.c_str());
+        return ERR_FILE_OPERATION_FAILED;
+    }
+    for (;;) {
+        log_header header;
+        if (fread(&header, sizeof(log_header), 1, fd) != 1) {
+            break;
+        }
+        if (header.magic != log_header::default_magic) {
+            break;
+        }
+        std::shared_ptr<char> buffer(dsn::utils::make_shared_array<char>(header.size));
+        if (fread(buffer.get(), header.size, 1, fd) != 1) {
+            break;
+        }
+        log_size += sizeof(header) + header.size;
+        binary_reader reader(blob(buffer, (int)header.size));
+        int op_type;
+        reader.read(op_type);
+
+        switch (static_cast<operation_type>(op_type)) {
+        case operation_type::create_node: {
+            std::string node;
+            blob data;
+            create_node_log::parse(reader, node, data);
+            create_node_internal(node, data);
+            break;
+        }
+        case operation_type::delete_node: {
+            std::string node;
+            bool recursively_delete;
+            delete_node_log::parse(reader, node, recursively_delete);
+            delete_node_internal(node, recursively_delete);
+            break;
+        }
+        case operation_type::set_data: {
+            std::string node;
+            blob data;
+            set_data_log::parse(reader, node, data);
+            set_data_internal(node, data);
+            break;
+        }
+        default:
+            // The log is complete but its content is modified by cosmic ray. This is
+            // unacceptable
+            dassert(false, "meta state server log corrupted");
+        }
+    }
+    fclose(fd);
+
+    int64_t file_size = 0;
+    if (!utils::filesystem::file_size(path, file_size)) {
+        derror("get size of file %s failed", path.c_str());
+        return ERR_FILE_OPERATION_FAILED;
+    }
+    // the tail is torn when the service crashed during writing the log
+    return (uint64_t)file_size == log_size ? ERR_OK : ERR_INCOMPLETE_DATA;
+}
+
+// keep the first size bytes only, so later appends are not hidden behind a torn tail
+static error_code truncate_log(const std::string &path, uint64_t size)
+{
+    std::shared_ptr<char> buffer(dsn::utils::make_shared_array<char>(size));
+    FILE *fd = fopen(path.c_str(), "rb");
+    if (fd == nullptr || (size > 0 && fread(buffer.get(), size, 1, fd) != 1)) {
+        derror("read file failed: %s", path.c_str());
+        if (fd != nullptr)
+            fclose(fd);
+        return ERR_FILE_OPERATION_FAILED;
+    }
+    fclose(fd);
+
+    std::string tmp_path = path + ".tmp";
+    fd = fopen(tmp_path.c_str(), "wb");
+    if (fd == nullptr) {
+        derror("open file failed: %s", tmp_path.c_str());
+        return ERR_FILE_OPERATION_FAILED;
+    }
+    bool ok = (size == 0 || fwrite(buffer.get(), size, 1, fd) == 1);
+    ok = (fclose(fd) == 0) && ok;
+    if (!ok || !utils::filesystem::rename_path(tmp_path, path)) {
+        derror("truncate file %s failed", path.c_str());
+        utils::filesystem::remove_path(tmp_path);
+        return ERR_FILE_OPERATION_FAILED;
+    }
+    return ERR_OK;
+}
+
+error_code meta_state_service_simple::load_snapshot(const std::string &path)
+{
+    int64_t file_size = 0;
+    if (!utils::filesystem::file_size(path, file_size)) {
+        derror("get size of file %s failed", path.c_str());
+        return ERR_FILE_OPERATION_FAILED;
+    }
+    if (file_size < (int64_t)sizeof(snapshot_header)) {
+        derror("snapshot %s is too short, size = %" PRId64, path.c_str(), file_size);
+        return ERR_CORRUPTION;
+    }
+
+    FILE *fd = fopen(path.c_str(), "rb");
+    if (fd == nullptr) {
+        derror("open file failed: %s", path.c_str());
+        return ERR_FILE_OPERATION_FAILED;
+    }
+    std::shared_ptr<char> buffer(dsn::utils::make_shared_array<char>(file_size));
+    size_t read_size = fread(buffer.get(), 1, file_size, fd);
+    fclose(fd);
+    if (read_size != (size_t)file_size) {
+        derror("read file failed: %s", path.c_str());
+        return ERR_FILE_OPERATION_FAILED;
+    }
+
+    const snapshot_header *header = reinterpret_cast<const snapshot_header *>(buffer.get());
+    const char *body = buffer.get() + sizeof(snapshot_header);
+    if (header->magic != snapshot_header::default_magic ||
+        header->version != snapshot_header::default_version ||
+        header->body_size != (uint64_t)file_size - sizeof(snapshot_header) ||
+        header->body_crc != dsn::utils::crc32_calc(body, header->body_size, 0)) {
+        derror("snapshot %s is corrupted", path.c_str());
+        return ERR_CORRUPTION;
+    }
+
+    binary_reader reader(blob(buffer, sizeof(snapshot_header), (int)header->body_size));
+    int64_t count;
+    reader.read(count);
+    for (int64_t i = 0; i < count; ++i) {
+        std::string node;
+        blob data;
+        unmarshall(reader, node, DSF_THRIFT_BINARY);
+        unmarshall(reader, data, DSF_THRIFT_BINARY);
+        // nodes are dumped in preorder, so parents always come first
+        error_code err =
+            (node == "/") ? set_data_internal(node, data) : create_node_internal(node, data);
+        if (err != ERR_OK) {
+            derror("load node %s from snapshot %s failed, err = %s",
+                   node.c_str(),
+                   path.c_str(),
+                   err.to_string());
+            return ERR_CORRUPTION;
+        }
+    }
+    return ERR_OK;
+}
+
 error_code meta_state_service_simple::initialize(const std::vector<std::string> &args)
 {
-    const char *work_dir =
-        args.empty() ? service_app::current_service_app_info().data_dir.c_str() : args[0].c_str();
+    _work_dir = args.empty() ? service_app::current_service_app_info().data_dir : args[0];
+    _log_segment_size = dsn_config_get_value_uint64("meta_server",
+                                                    "meta_state_service_simple_log_segment_size_mb",
+                                                    64,
+                                                    "log segment size of meta_state_service_simple")
+                        << 20;
+
+    // the log of earlier versions is not segmented
+    std::string legacy_log = utils::filesystem::path_combine(_work_dir, "meta_state_service.log");
+    if (utils::filesystem::file_exists(legacy_log) &&
+        !utils::filesystem::file_exists(log_path(0))) {
+        if (!utils::filesystem::rename_path(legacy_log, log_path(0))) {
+            derror("rename %s to %s failed", legacy_log.c_str(), log_path(0).c_str());
+            return ERR_FILE_OPERATION_FAILED;
+        }
+    }
+
+    int64_t snapshot_index = 0;
+    std::vector<int64_t> snapshots = get_file_indexes(snapshot_prefix);
+    if (!snapshots.empty()) {
+        snapshot_index = snapshots.back();
+        error_code err = load_snapshot(snapshot_path(snapshot_index));
+        if (err != ERR_OK) {
+            return err;
+        }
+        ddebug("snapshot %s loaded, node count = %d",
+               snapshot_path(snapshot_index).c_str(),
+               (int)_quick_map.size());
+    }
 
+    // replay the segments following the snapshot
+    _log_index = snapshot_index;
     _offset = 0;
-    std::string log_path = dsn::utils::filesystem::path_combine(work_dir, "meta_state_service.log");
-    if (utils::filesystem::file_exists(log_path)) {
-        if (FILE *fd = fopen(log_path.c_str(), "rb")) {
-            for (;;) {
-                log_header header;
-                if (fread(&header, sizeof(log_header), 1, fd) != 1) {
-                    break;
-                }
-                if (header.magic != log_header::default_magic) {
-                    break;
-                }
-                std::shared_ptr<char> buffer(dsn::utils::make_shared_array<char>(header.size));
-                if (fread(buffer.get(), header.size, 1, fd) != 1) {
-                    break;
-                }
-                _offset += sizeof(header) + header.size;
-                binary_reader reader(blob(buffer, (int)header.size));
-                int op_type;
-                reader.read(op_type);
-
-                switch (static_cast<operation_type>(op_type)) {
-                case operation_type::create_node: {
-                    std::string node;
-                    blob data;
-                    create_node_log::parse(reader, node, data);
-                    create_node_internal(node, data);
-                    break;
-                }
-                case operation_type::delete_node: {
-                    std::string node;
-                    bool recursively_delete;
-                    delete_node_log::parse(reader, node, recursively_delete);
-                    delete_node_internal(node, recursively_delete);
-                    break;
-                }
-                case operation_type::set_data: {
-                    std::string node;
-                    blob data;
-                    set_data_log::parse(reader, node, data);
-                    set_data_internal(node, data);
-                    break;
-                }
-                default:
-                    // The log is complete but its content is modified by cosmic ray. This is
-                    // unacceptable
-                    dassert(false, "meta state server log corrupted");
-                }
+    for (int64_t index = snapshot_index; utils::filesystem::file_exists(log_path(index));
+         ++index) {
+        uint64_t log_size = 0;
+        error_code err = replay_log(log_path(index), log_size);
+        _log_index = index;
+        _offset = log_size;
+        if (err == ERR_INCOMPLETE_DATA) {
+            dwarn("log %s is incomplete, keep the first %" PRIu64 " bytes only",
+                  log_path(index).c_str(),
+                  log_size);
+            err = truncate_log(log_path(index), log_size);
+            if (err != ERR_OK) {
+                return err;
             }
-            fclose(fd);
+            break;
+        }
+        if (err != ERR_OK) {
+            return err;
+        }
+    }
+    for (int64_t index : get_file_indexes(log_prefix)) {
+        if (index > _log_index) {
+            dwarn("remove log %s as it follows an incomplete one", log_path(index).c_str());
+            utils::filesystem::remove_path(log_path(index));
         }
     }
+    remove_obsolete_files(snapshot_index);
 
-    _log = dsn_file_open(log_path.c_str(), O_RDWR | O_CREAT | O_BINARY, 0666);
+    std::string path = log_path(_log_index);
+    _log = dsn_file_open(path.c_str(), O_RDWR | O_CREAT | O_BINARY, 0666);
     if (!_log) {
-        derror("open file failed: %s", log_path.c_str());
+        derror("open file failed: %s", path.c_str());
         return ERR_FILE_OPERATION_FAILED;
     }
     return ERR_OK;
 }
 
+void meta_state_service_simple::rotate_log()
+{
+    std::string path = log_path(_log_index + 1);
+    dsn_handle_t new_log = dsn_file_open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_BINARY, 0666);
+    if (!new_log) {
+        derror("open file failed: %s, keep writing the current log", path.c_str());
+        return;
+    }
+
+    dsn_handle_t old_log = _log;
+    _log = new_log;
+    _offset = 0;
+    ++_log_index;
+    _snapshot_in_progress = true;
+
+    // the snapshot must cover exactly the operations logged before the new segment, so it is
+    // taken after these are applied, and before any operation logged later
+    int64_t snapshot_index = _log_index;
+    auto marker = [this, old_log, snapshot_index](bool) {
+        dsn_file_close(old_log);
+        start_snapshot(snapshot_index);
+    };
+    if (_task_queue.empty()) {
+        marker(true);
+    } else {
+        _task_queue.emplace(new operation(true, std::move(marker)));
+    }
+}
+
+void meta_state_service_simple::start_snapshot(int64_t snapshot_index)
+{
+    // only the paths and the references of the data are copied here, while the serialization
+    // and the io are done in background
+    auto nodes = std::make_shared<std::vector<std::pair<std::string, blob>>>();
+    {
+        zauto_lock _(_state_lock);
+        nodes->reserve(_quick_map.size());
+        std::stack<std::pair<std::string, state_node *>> dfs_stack;
+        dfs_stack.push(std::make_pair(std::string("/"), &_root));
+        while (!dfs_stack.empty()) {
+            auto top = dfs_stack.top();
+            dfs_stack.pop();
+            nodes->emplace_back(top.first, top.second->data);
+            std::string prefix = (top.first == "/") ? top.first : top.first + "/";
+            for (auto &child : top.second->children) {
+                dfs_stack.push(std::make_pair(prefix + child.first, child.second));
+            }
+        }
+    }
+
+    tasking::enqueue(LPC_META_STATE_SERVICE_SIMPLE_SNAPSHOT, this, [this, snapshot_index, nodes]() {
+        write_snapshot(snapshot_index, *nodes);
+    });
+}
+
+void meta_state_service_simple::write_snapshot(
+    int64_t snapshot_index, const std::vector<std::pair<std::string, blob>> &nodes)
+{
+    binary_writer writer;
+    writer.write_pod(snapshot_header());
+    writer.write((int64_t)nodes.size());
+    for (auto &node : nodes) {
+        marshall(writer, node.first, DSF_THRIFT_BINARY);
+        marshall(writer, node.second, DSF_THRIFT_BINARY);
+    }
+    blob buffer = writer.get_buffer();
+    snapshot_header *header = reinterpret_cast<snapshot_header *>((char *)buffer.data());
+    header->body_size = buffer.length() - sizeof(snapshot_header);
+    header->body_crc =
+        dsn::utils::crc32_calc(buffer.data() + sizeof(snapshot_header), header->body_size, 0);
+
+    auto on_failure = [this](const std::string &tmp_path) {
+        utils::filesystem::remove_path(tmp_path);
+        zauto_lock l(_log_lock);
+        // try again on the next segment
+        _snapshot_in_progress = false;
+    };
+
+    std::string path = snapshot_path(snapshot_index);
+    std::string tmp_path = path + ".tmp";
+    dsn_handle_t fh = dsn_file_open(tmp_path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_BINARY, 0666);
+    if (!fh) {
+        derror("open file failed: %s", tmp_path.c_str());
+        on_failure(tmp_path);
+        return;
+    }
+
+    file::write(
+        fh,
+        buffer.data(),
+        buffer.length(),
+        0,
+        LPC_META_STATE_SERVICE_SIMPLE_INTERNAL,
+        this,
+        [=](error_code err, size_t bytes) {
+            if (err == ERR_OK && bytes == buffer.length()) {
+                err = dsn_file_flush(fh);
+            } else if (err == ERR_OK) {
+                err = ERR_FILE_OPERATION_FAILED;
+            }
+            dsn_file_close(fh);
+            if (err == ERR_OK && !utils::filesystem::rename_path(tmp_path, path)) {
+                err = ERR_FILE_OPERATION_FAILED;
+            }
+            if (err != ERR_OK) {
+                derror("write snapshot %s failed, err = %s", path.c_str(), err.to_string());
+                on_failure(tmp_path);
+                return;
+            }
+
+            ddebug("snapshot %s written, node count = %d, size = %d",
+                   path.c_str(),
+                   (int)nodes.size(),
+                   buffer.length());
+            remove_obsolete_files(snapshot_index);
+            zauto_lock l(_log_lock);
+            _snapshot_in_progress = false;
+        });
+}
+
+void meta_state_service_simple::remove_obsolete_files(int64_t snapshot_index)
+{
+    for (int64_t index : get_file_indexes(log_prefix)) {
+        if (index < snapshot_index && !utils::filesystem::remove_path(log_path(index))) {
+            dwarn("remove obsolete log %s failed", log_path(index).c_str());
+        }
+    }
+    for (int64_t index : get_file_indexes(snapshot_prefix)) {
+        if (index < snapshot_index && !utils::filesystem::remove_path(snapshot_path(index))) {
+            dwarn("remove obsolete snapshot %s failed", snapshot_path(index).c_str());
+        }
+    }
+}
+
 std::shared_ptr<meta_state_service::transaction_entries>
 meta_state_service_simple::new_transaction_entries(unsigned int capacity)
 {
@@ -498,6 +833,11 @@ task_ptr meta_state_service_simple::get_children(const std::string &node,
     }
 }
 
-meta_state_service_simple::~meta_state_service_simple() { dsn_file_close(_log); }
+meta_state_service_simple::~meta_state_service_simple()
+{
+    // the pending logging and snapshot writes refer to the handles and this object
+    dsn_task_tracker_wait_all(tracker());
+    dsn_file_close(_log);
+}
 }
 }
@@ -31,6 +31,7 @@
  * Revision history:
  *     2015-11-03, @imzhenyu (Zhenyu.Guo@microsoft.com), setup the sketch
  *     2015-11-11, Tianyi WANG, first version done
+ *     xxxx-xx-xx, author, log segments and snapshots
  */
 
 #include <dsn/dist/meta_state_service.h>
@@ -45,7 +46,15 @@ namespace dist {
 DEFINE_TASK_CODE_AIO(LPC_META_STATE_SERVICE_SIMPLE_INTERNAL,
                      TASK_PRIORITY_HIGH,
                      THREAD_POOL_DEFAULT);
-
+DEFINE_TASK_CODE(LPC_META_STATE_SERVICE_SIMPLE_SNAPSHOT, TASK_PRIORITY_LOW, THREAD_POOL_DEFAULT);
+
+//
+// the operations are logged into segments named meta_state_service.log.<index>. once the
+// current segment grows beyond the configured size, a new segment is started and the tree
+// is dumped into meta_state_service.snapshot.<new index> in background, after which the
+// older segments and snapshots are removed. so startup loads the latest snapshot and replays
+// at most a segment or two, no matter how long the service has run.
+//
 class meta_state_service_simple : public meta_state_service, public clientlet
 {
 public:
@@ -54,7 +63,10 @@ public:
           _quick_map({std::make_pair("/", &_root)}),
           _log_lock(true),
           _log(nullptr),
-          _offset(0)
+          _offset(0),
+          _log_index(0),
+          _log_segment_size(0),
+          _snapshot_in_progress(false)
     {
     }
 
@@ -121,6 +133,21 @@ private:
         static const int default_magic = 0xdeadbeef;
         log_header() : magic(default_magic), size(0) {}
     };
+
+    // followed by the node count and the <path, data> of each node in preorder
+    struct snapshot_header
+    {
+        int magic;
+        int version;
+        uint32_t body_crc;
+        uint64_t body_size;
+        static const int default_magic = 0x534e4150;
+        static const int default_version = 1;
+        snapshot_header()
+            : magic(default_magic), version(default_version), body_crc(0), body_size(0)
+        {
+        }
+    };
 #pragma pack(pop)
 
     struct state_node
@@ -253,6 +280,22 @@ private:
     error_code
     apply_transaction(const std::shared_ptr<meta_state_service::transaction_entries> &t_entries);
 
+    std::string log_path(int64_t index) const;
+    std::string snapshot_path(int64_t index) const;
+    // sorted indexes of the files named as <prefix><index> in the work dir
+    std::vector<int64_t> get_file_indexes(const std::string &prefix) const;
+
+    error_code replay_log(const std::string &path, /*out*/ uint64_t &log_size);
+    error_code load_snapshot(const std::string &path);
+
+    // called with _log_lock held
+    void rotate_log();
+    void start_snapshot(int64_t snapshot_index);
+
+    void write_snapshot(int64_t snapshot_index,
+                        const std::vector<std::pair<std::string, blob>> &nodes);
+    void remove_obsolete_files(int64_t snapshot_index);
+
     typedef std::unordered_map<std::string, state_node *> quick_map;
 
     zlock _queue_lock;
@@ -264,7 +307,11 @@ private:
 
     zlock _log_lock;
     dsn_handle_t _log;
-    uint64_t _offset;
+    uint64_t _offset; // in the current log segment
+    int64_t _log_index;
+    uint64_t _log_segment_size;
+    bool _snapshot_in_progress;
+    std::string _work_dir;
 };
 }
 }
@@ -39,6 +39,7 @@
 #include <dsn/tool-api/task.h>
 #include <dsn/tool-api/command_manager.h>
 #include <sstream>
+#include <set>
 #include <cinttypes>
 #include <string>
 #include <boost/lexical_cast.hpp>
@@ -59,6 +60,11 @@ static const char *unlock_state = "unlock";
 
 server_state::server_state()
     : _meta_svc(nullptr),
+      _config_epoch(0),
+      _config_version(0),
+      _config_updates_flush_scheduled(false),
+      _config_sync_batch_interval_ms(0),
+      _config_sync_batch_max_count(0),
       _add_secondary_enable_flow_control(false),
       _add_secondary_max_count_for_one_node(0),
       _cli_dump_handle(nullptr),
@@ -156,6 +162,9 @@ void server_state::initialize(meta_service *meta_svc, const std::string &apps_ro
         _meta_svc->get_meta_options().add_secondary_enable_flow_control;
     _add_secondary_max_count_for_one_node =
         _meta_svc->get_meta_options().add_secondary_max_count_for_one_node;
+    _config_sync_batch_interval_ms = _meta_svc->get_meta_options().config_sync_batch_interval_ms;
+    _config_sync_batch_max_count =
+        std::max(1, _meta_svc->get_meta_options().config_sync_batch_max_count);
 
     _dead_partition_count.init_app_counter("eon.server_state",
                                            "dead_partition_count",
@@ -177,6 +186,10 @@ void server_state::initialize(meta_service *meta_svc, const std::string &apps_ro
                                               "healthy_partition_count",
                                               COUNTER_TYPE_NUMBER,
                                               "current healthy partition count");
+    _hotspot_partition_count.init_app_counter("eon.server_state",
+                                              "hotspot_partition_count",
+                                              COUNTER_TYPE_NUMBER,
+                                              "current hotspot partition count");
     _recent_update_config_count.init_app_counter("eon.server_state",
                                                  "recent_update_config_count",
                                                  COUNTER_TYPE_VOLATILE_NUMBER,
@@ -191,6 +204,11 @@ void server_state::initialize(meta_service *meta_svc, const std::string &apps_ro
         "recent_partition_change_writable_count",
         COUNTER_TYPE_VOLATILE_NUMBER,
         "partition change to writable count in the recent period");
+    _recent_config_sync_batch_count.init_app_counter(
+        "eon.server_state",
+        "recent_config_sync_batch_count",
+        COUNTER_TYPE_VOLATILE_NUMBER,
+        "partition config sync batches of more than one update in the recent period");
 }
 
 bool server_state::spin_wait_staging(int timeout_seconds)
@@ -690,6 +708,8 @@ dsn::error_code server_state::sync_apps_from_remote_storage()
 void server_state::initialize_node_state()
 {
     zauto_write_lock l(_lock);
+    _config_epoch = static_cast<int64_t>(dsn_random64(1, INT64_MAX));
+    _config_version = 0;
     for (auto &app_pair : _all_apps) {
         app_state &app = *(app_pair.second);
         for (partition_configuration &pc : app.partitions) {
@@ -800,9 +820,21 @@ void server_state::on_config_sync(dsn_message_t msg)
             response.err = ERR_OBJECT_NOT_FOUND;
         } else {
             response.err = ERR_OK;
-            unsigned int i = 0;
-            response.partitions.resize(ns->partition_count());
-            ns->for_each_partition([&, this](const gpid &pid) {
+
+            // the replica server who reports the version it has applied can accept a delta
+            // and deduplicated app infos. A delta is only possible if the version comes from
+            // this epoch and no partition is removed from the node since then, as the replica
+            // server removes the replicas not in a full response
+            bool support_delta = request.__isset.config_epoch && request.__isset.config_version;
+            bool is_delta = support_delta && request.config_epoch == _config_epoch &&
+                            request.config_version > 0 &&
+                            ns->removed_version() <= request.config_version;
+            std::set<int32_t> app_ids;
+
+            if (!is_delta) {
+                response.partitions.reserve(ns->partition_count());
+            }
+            reject_this_request = !ns->for_each_partition([&, this](const gpid &pid) {
                 std::shared_ptr<app_state> app = get_app(pid.get_app_id());
                 dassert(app != nullptr, "invalid app_id, app_id = %d", pid.get_app_id());
                 config_context &cc = app->helpers->contexts[pid.get_partition_index()];
@@ -816,14 +848,30 @@ void server_state::on_config_sync(dsn_message_t msg)
                         return false;
                 }
 
-                response.partitions[i].info = *app;
-                response.partitions[i].config = app->partitions[pid.get_partition_index()];
-                response.partitions[i].host_node = request.node;
-                ++i;
+                if (is_delta && cc.config_version <= request.config_version)
+                    return true;
+
+                response.partitions.emplace_back();
+                configuration_update_request &update = response.partitions.back();
+                if (support_delta) {
+                    app_ids.insert(pid.get_app_id());
+                } else {
+                    update.info = *app;
+                }
+                update.config = app->partitions[pid.get_partition_index()];
+                update.host_node = request.node;
                 return true;
             });
-            if (i < response.partitions.size()) {
-                reject_this_request = true;
+
+            if (support_delta) {
+                response.__set_config_epoch(_config_epoch);
+                response.__set_config_version(_config_version);
+                response.__set_is_delta(is_delta);
+                response.__isset.apps = true;
+                response.apps.reserve(app_ids.size());
+                for (int32_t app_id : app_ids) {
+                    response.apps.push_back(*get_app(app_id));
+                }
             }
         }
 
@@ -905,17 +953,39 @@ void server_state::on_config_sync(dsn_message_t msg)
                 response.__isset.gc_replicas = true;
             }
         }
+
+        // record the load of the serving replicas for hotspot detection and load balancing
+        if (!reject_this_request && request.__isset.load_stats) {
+            for (const replica_load_stat &stat : request.load_stats) {
+                std::shared_ptr<app_state> app = get_app(stat.pid.get_app_id());
+                if (app == nullptr || app->status != app_status::AS_AVAILABLE ||
+                    stat.pid.get_partition_index() >= app->partition_count) {
+                    continue;
+                }
+                config_context &cc = app->helpers->contexts[stat.pid.get_partition_index()];
+                if (!cc.collect_serving_load(request.node, stat)) {
+                    dinfo("ignore load of gpid(%d.%d) on node(%s) as it is not serving",
+                          stat.pid.get_app_id(),
+                          stat.pid.get_partition_index(),
+                          request.node.to_string());
+                }
+            }
+        }
     }
 
     if (reject_this_request) {
         response.err = ERR_BUSY;
         response.partitions.clear();
+        response.apps.clear();
     }
-    ddebug("send config sync response to %s, err(%s), partitions_count(%d), gc_replicas_count(%d)",
+    ddebug("send config sync response to %s, err(%s), partitions_count(%d), gc_replicas_count(%d), "
+           "is_delta(%s), config_version(%" PRId64 ")",
            request.node.to_string(),
            response.err.to_string(),
            (int)response.partitions.size(),
-           (int)response.gc_replicas.size());
+           (int)response.gc_replicas.size(),
+           response.is_delta ? "true" : "false",
+           response.config_version);
     _meta_svc->reply_data(msg, response);
     dsn_msg_release_ref(msg);
 }
@@ -1373,6 +1443,9 @@ void server_state::update_configuration_locally(
     health_status old_health_status = partition_health_status(old_cfg, min_2pc_count);
     health_status new_health_status = partition_health_status(new_cfg, min_2pc_count);
 
+    int64_t config_version = ++_config_version;
+    app.helpers->contexts[gpid.get_partition_index()].config_version = config_version;
+
     if (app.is_stateful) {
         dassert(old_cfg.ballot + 1 == new_cfg.ballot,
                 "invalid configuration update request, old ballot %" PRId64 ", new ballot %" PRId64
@@ -1407,6 +1480,7 @@ void server_state::update_configuration_locally(
         case config_type::CT_DOWNGRADE_TO_INACTIVE:
         case config_type::CT_REMOVE:
             ns->remove_partition(gpid, false);
+            ns->set_removed_version(config_version);
             break;
         // nothing to handle, the ballot will updated in below
         case config_type::CT_PRIMARY_FORCE_UPDATE_BALLOT:
@@ -1415,8 +1489,10 @@ void server_state::update_configuration_locally(
         case config_type::CT_DROP_PARTITION:
             for (const rpc_address &node : new_cfg.last_drops) {
                 ns = get_node_state(_nodes, node, false);
-                if (ns != nullptr)
+                if (ns != nullptr) {
                     ns->remove_partition(gpid, false);
+                    ns->set_removed_version(config_version);
+                }
             }
             break;
 
@@ -1454,6 +1530,7 @@ void server_state::update_configuration_locally(
                 config_request->host_node.to_string());
         if (config_type::CT_REMOVE == config_request->type) {
             it->second.remove_partition(gpid, false);
+            it->second.set_removed_version(config_version);
         } else {
             it->second.put_partition(gpid, false);
         }
@@ -1517,14 +1594,96 @@ task_ptr server_state::update_configuration_on_remote(
     std::string storage_path = get_partition_path(pc.pid);
 
     blob json_config = dsn::json::json_forwarder<partition_configuration>::encode(pc);
-    return _meta_svc->get_remote_storage()->set_data(
-        storage_path,
-        json_config,
-        LPC_META_STATE_HIGH,
+    dist::meta_state_service::err_callback on_reply =
         std::bind(&server_state::on_update_configuration_on_remote_reply,
                   this,
                   std::placeholders::_1,
-                  config_request));
+                  config_request);
+    if (_config_sync_batch_interval_ms == 0) {
+        return _meta_svc->get_remote_storage()->set_data(
+            storage_path, json_config, LPC_META_STATE_HIGH, on_reply);
+    }
+
+    // the returned task is fired when the batch it joins is persisted, and it may be
+    // cancelled like the one returned by set_data
+    task_ptr callback = tasking::create_late_task(LPC_META_STATE_HIGH, on_reply);
+    bool flush_now = false;
+    bool schedule_flush = false;
+    {
+        zauto_lock l(_pending_config_updates_lock);
+        _pending_config_updates.push_back({storage_path, json_config, callback});
+        if (_pending_config_updates.size() >= (size_t)_config_sync_batch_max_count) {
+            flush_now = true;
+        } else if (!_config_updates_flush_scheduled) {
+            _config_updates_flush_scheduled = true;
+            schedule_flush = true;
+        }
+    }
+
+    if (flush_now) {
+        flush_config_updates_on_remote();
+    } else if (schedule_flush) {
+        tasking::enqueue(LPC_META_STATE_HIGH,
+                         nullptr,
+                         [this]() {
+                             {
+                                 zauto_lock l(_pending_config_updates_lock);
+                                 _config_updates_flush_scheduled = false;
+                             }
+                             flush_config_updates_on_remote();
+                         },
+                         server_state::sStateHash,
+                         std::chrono::milliseconds(_config_sync_batch_interval_ms));
+    }
+    return callback;
+}
+
+static void bind_and_enqueue(task_ptr callback, error_code ec)
+{
+    auto t = dynamic_cast<safe_late_task<dist::meta_state_service::err_callback> *>(callback.get());
+    dassert(t != nullptr, "invalid late task");
+    t->bind_and_enqueue(
+        [ec](dist::meta_state_service::err_callback &cb) { return std::bind(cb, ec); });
+}
+
+void server_state::flush_config_updates_on_remote()
+{
+    std::vector<pending_config_update> updates;
+    {
+        zauto_lock l(_pending_config_updates_lock);
+        updates.swap(_pending_config_updates);
+    }
+    if (updates.empty()) {
+        return;
+    }
+
+    dist::meta_state_service *storage = _meta_svc->get_remote_storage();
+    if (updates.size() == 1) {
+        task_ptr callback = updates[0].callback;
+        storage->set_data(updates[0].path,
+                          updates[0].value,
+                          LPC_META_STATE_HIGH,
+                          [callback](error_code ec) { bind_and_enqueue(callback, ec); });
+        return;
+    }
+
+    // the transaction succeeds or fails as a whole, so all requests in it share the result;
+    // several updates of the same partition are applied in order
+    auto callbacks = std::make_shared<std::vector<task_ptr>>();
+    callbacks->reserve(updates.size());
+    auto entries = storage->new_transaction_entries(updates.size());
+    for (pending_config_update &u : updates) {
+        error_code err = entries->set_data(u.path, u.value);
+        dassert(err == ERR_OK, "append to transaction failed, err = %s", err.to_string());
+        callbacks->push_back(u.callback);
+    }
+    dinfo("persist %d partition config updates in one transaction", (int)updates.size());
+    _recent_config_sync_batch_count->increment();
+    storage->submit_transaction(entries, LPC_META_STATE_HIGH, [callbacks](error_code ec) {
+        for (task_ptr &callback : *callbacks) {
+            bind_and_enqueue(callback, ec);
+        }
+    });
 }
 
 void server_state::on_update_configuration_on_remote_reply(
@@ -2307,6 +2466,51 @@ void server_state::update_partition_perf_counter()
     _healthy_partition_count->set(counters[HS_HEALTHY]);
 }
 
+void server_state::detect_hotspot_partitions()
+{
+    const meta_options &opts = _meta_svc->get_meta_options();
+    int hotspot_count = 0;
+    auto func = [&](const std::shared_ptr<app_state> &app) {
+        std::vector<int64_t> qps(app->partition_count);
+        int64_t total_qps = 0;
+        for (int i = 0; i < app->partition_count; i++) {
+            qps[i] = app->helpers->contexts[i].total_qps();
+            total_qps += qps[i];
+        }
+        double mean_qps = static_cast<double>(total_qps) / app->partition_count;
+
+        for (int i = 0; i < app->partition_count; i++) {
+            config_context &cc = app->helpers->contexts[i];
+            bool is_hotspot = qps[i] >= static_cast<int64_t>(opts.hotspot_min_qps) &&
+                              qps[i] > mean_qps * opts.hotspot_qps_factor;
+            if (is_hotspot) {
+                hotspot_count++;
+                if (!cc.is_hotspot) {
+                    dwarn("gpid(%d.%d) of app(%s) becomes a hotspot, qps = %" PRId64
+                          ", app mean qps = %.1f",
+                          app->app_id,
+                          i,
+                          app->app_name.c_str(),
+                          qps[i],
+                          mean_qps);
+                }
+            } else if (cc.is_hotspot) {
+                ddebug("gpid(%d.%d) of app(%s) is no longer a hotspot, qps = %" PRId64
+                       ", app mean qps = %.1f",
+                       app->app_id,
+                       i,
+                       app->app_name.c_str(),
+                       qps[i],
+                       mean_qps);
+            }
+            cc.is_hotspot = is_hotspot;
+        }
+        return true;
+    };
+    for_each_available_app(_all_apps, func);
+    _hotspot_partition_count->set(hotspot_count);
+}
+
 bool server_state::check_all_partitions()
 {
     int healthy_partitions = 0;
@@ -2316,6 +2520,7 @@ bool server_state::check_all_partitions()
     zauto_write_lock l(_lock);
 
     update_partition_perf_counter();
+    detect_hotspot_partitions();
 
     // first the cure stage
     if (level <= meta_function_level::fl_freezed) {
@@ -186,6 +186,8 @@ private:
 
     // user should lock it first
     void update_partition_perf_counter();
+    // user should lock it first
+    void detect_hotspot_partitions();
 
     error_code dump_app_states(const char *local_path,
                                const std::function<app_state *()> &iterator);
@@ -225,6 +227,8 @@ private:
 
     task_ptr
     update_configuration_on_remote(std::shared_ptr<configuration_update_request> &config_request);
+    // persist the config updates collected so far in one transaction
+    void flush_config_updates_on_remote();
     void
     on_update_configuration_on_remote_reply(error_code ec,
                                             std::shared_ptr<configuration_update_request> &request);
@@ -298,6 +302,26 @@ private:
     // for load balancer
     migration_list _temporary_list;
 
+    // for incremental config sync: every config change gets a new version, and the epoch is
+    // renewed each time the state is loaded, so versions from another meta server are rejected
+    int64_t _config_epoch;
+    int64_t _config_version;
+
+    // group commit of partition config updates: when a node dies, hundreds of partitions
+    // may fail over at once, and persisting their configs one by one serializes them on
+    // the round trips to the remote storage
+    struct pending_config_update
+    {
+        std::string path;
+        blob value;
+        task_ptr callback; // late task of on_update_configuration_on_remote_reply
+    };
+    zlock _pending_config_updates_lock;
+    std::vector<pending_config_update> _pending_config_updates;
+    bool _config_updates_flush_scheduled;
+    uint64_t _config_sync_batch_interval_ms;
+    int32_t _config_sync_batch_max_count;
+
     // for test
     config_change_subscriber _config_change_subscriber;
     replica_migration_subscriber _replica_migration_subscriber;
@@ -313,9 +337,11 @@ private:
     perf_counter_wrapper _unwritable_partition_count;
     perf_counter_wrapper _writable_ill_partition_count;
     perf_counter_wrapper _healthy_partition_count;
+    perf_counter_wrapper _hotspot_partition_count;
     perf_counter_wrapper _recent_update_config_count;
     perf_counter_wrapper _recent_partition_change_unwritable_count;
     perf_counter_wrapper _recent_partition_change_writable_count;
+    perf_counter_wrapper _recent_config_sync_batch_count;
 };
 }
 }
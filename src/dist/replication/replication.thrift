@@ -224,11 +224,31 @@ struct replica_server_info
     2:i64 total_capacity_mb;
 }
 
+// load of a replica since the last config sync, the rates are per second and the latencies
+// are the 99th percentile in nanoseconds, storage_mb is the size of the replica directory
+// as of the last disk stat
+struct replica_load_stat
+{
+    1:dsn.gpid pid;
+    2:i64 read_qps;
+    3:i64 write_qps;
+    4:i64 read_bytes_per_sec;
+    5:i64 write_bytes_per_sec;
+    6:i64 read_latency_p99_ns;
+    7:i64 write_latency_p99_ns;
+    8:i64 storage_mb;
+}
+
 struct configuration_query_by_node_request
 {
     1:dsn.rpc_address  node;
     2:optional list<replica_info> stored_replicas;
     3:optional replica_server_info info;
+    4:optional list<replica_load_stat> load_stats;
+    // the config_epoch and config_version of the last response the replica server applied,
+    // the meta server then only returns the partitions changed since that version
+    5:optional i64 config_epoch;
+    6:optional i64 config_version;
 }
 
 struct configuration_query_by_node_response
@@ -236,6 +256,12 @@ struct configuration_query_by_node_response
     1:dsn.error_code err;
     2:list<configuration_update_request> partitions;
     3:optional list<replica_info> gc_replicas;
+    4:optional i64 config_epoch;
+    5:optional i64 config_version;
+    // if true, partitions only contains the ones changed since the requested version
+    6:optional bool is_delta;
+    // if set, partitions[i].info is left empty and the app_info is found here by app_id
+    7:optional list<dsn.app_info> apps;
 }
 
 struct create_app_options
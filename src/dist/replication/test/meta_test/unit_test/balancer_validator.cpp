@@ -6,6 +6,7 @@
 #include <dsn/cpp/serialization_helper/dsn.layer2_types.h>
 
 #include <fstream>
+#include <limits>
 
 #include "dist/replication/meta_server/meta_data.h"
 #include "dist/replication/meta_server/server_load_balancer.h"
@@ -259,6 +260,86 @@ void meta_service_test_app::balancer_validator()
     }
 }
 
+void meta_service_test_app::load_aware_balancer_test()
+{
+    std::vector<dsn::rpc_address> node_list;
+    generate_node_list(node_list, 10, 10);
+
+    app_mapper apps;
+    node_mapper nodes;
+    generate_apps(apps, node_list, 1, 3, std::pair<uint32_t, uint32_t>(64, 64), true);
+    generate_node_mapper(nodes, apps, node_list);
+
+    // every replica on the hot node is 20 times busier than the others
+    const dsn::rpc_address &hot = node_list[0];
+    std::shared_ptr<app_state> &the_app = apps[1];
+    for (config_context &cc : the_app->helpers->contexts) {
+        for (serving_replica &s : cc.serving) {
+            s.load.read_qps = (s.node == hot ? 2000 : 100);
+            s.storage_mb = 100;
+        }
+    }
+
+    meta_service svc;
+    svc._meta_opts._lb_opts.load_aware_balancer = true;
+    greedy_load_balancer glb(&svc);
+
+    migration_list ml;
+    ASSERT_TRUE(glb.balance({&apps, &nodes}, ml));
+    int max_moves = svc._meta_opts._lb_opts.load_aware_balancer_max_moves;
+    ASSERT_TRUE(static_cast<int>(ml.size()) <= max_moves);
+    for (const auto &kv : ml) {
+        // every planned move must take some load away from the hot node
+        bool off_hot = false;
+        for (const configuration_proposal_action &act : kv.second->action_list) {
+            if ((act.type == config_type::CT_REMOVE ||
+                 act.type == config_type::CT_DOWNGRADE_TO_SECONDARY) &&
+                act.node == hot)
+                off_hot = true;
+        }
+        ASSERT_TRUE(off_hot);
+    }
+
+    // without any load reported, the balancer falls back to balance by replica count
+    for (config_context &cc : the_app->helpers->contexts) {
+        for (serving_replica &s : cc.serving) {
+            s.load = replica_load_stat();
+            s.storage_mb = 0;
+        }
+    }
+    int rounds = 0;
+    for (; rounds < 1000 && glb.balance({&apps, &nodes}, ml); ++rounds) {
+        migration_check_and_apply(apps, nodes, ml, nullptr);
+    }
+    ASSERT_TRUE(rounds < 1000);
+    for (::dsn::partition_configuration &pc : the_app->partitions) {
+        ASSERT_FALSE(pc.primary.is_invalid());
+    }
+
+    // the primaries and the replicas are spread by count
+    int node_count = static_cast<int>(node_list.size());
+    int primaries_low = the_app->partition_count / node_count;
+    int primaries_high = (the_app->partition_count + node_count - 1) / node_count;
+    int min_replicas = std::numeric_limits<int>::max(), max_replicas = 0;
+    for (const auto &kv : nodes) {
+        int primaries = static_cast<int>(kv.second.primary_count(the_app->app_id));
+        int replicas = static_cast<int>(kv.second.partition_count(the_app->app_id));
+        ASSERT_TRUE(primaries >= primaries_low && primaries <= primaries_high);
+        min_replicas = std::min(min_replicas, replicas);
+        max_replicas = std::max(max_replicas, replicas);
+    }
+    ASSERT_TRUE(max_replicas - min_replicas <= 1);
+
+    // an even load plans no load aware move, and the count balancer has nothing to do
+    for (config_context &cc : the_app->helpers->contexts) {
+        for (serving_replica &s : cc.serving) {
+            s.load.read_qps = 100;
+            s.storage_mb = 100;
+        }
+    }
+    ASSERT_FALSE(glb.balance({&apps, &nodes}, ml));
+}
+
 dsn::rpc_address get_rpc_address(const std::string &ip_port)
 {
     int splitter = ip_port.find_first_of(':');
@@ -33,6 +33,8 @@ TEST(meta, data_definition) { g_app->data_definition_op_test(); }
 
 TEST(meta, update_configuration) { g_app->update_configuration_test(); }
 
+TEST(meta, update_configuration_batch) { g_app->update_configuration_batch_test(); }
+
 TEST(meta, balancer_validator) { g_app->balancer_validator(); }
 
 TEST(meta, apply_balancer) { g_app->apply_balancer_test(); }
@@ -43,6 +45,8 @@ TEST(meta, construct_apps_test) { g_app->construct_apps_test(); }
 
 TEST(meta, balance_config_file) { g_app->balance_config_file(); }
 
+TEST(meta, load_aware_balancer) { g_app->load_aware_balancer_test(); }
+
 TEST(meta, simple_lb_balanced_cure) { g_app->simple_lb_balanced_cure(); }
 
 TEST(meta, simple_lb_cure_test) { g_app->simple_lb_cure_test(); }
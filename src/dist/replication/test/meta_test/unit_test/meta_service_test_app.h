@@ -76,8 +76,10 @@ public:
     void state_sync_test();
     void data_definition_op_test();
     void update_configuration_test();
+    void update_configuration_batch_test();
     void balancer_validator();
     void balance_config_file();
+    void load_aware_balancer_test();
     void apply_balancer_test();
     void cannot_run_balancer_test();
     void construct_apps_test();
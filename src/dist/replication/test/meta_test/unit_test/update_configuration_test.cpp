@@ -237,6 +237,84 @@ void meta_service_test_app::update_configuration_test()
     ASSERT_TRUE(wait_state(ss, validator3, 10));
 }
 
+void meta_service_test_app::update_configuration_batch_test()
+{
+    dsn::error_code ec;
+    std::shared_ptr<fake_sender_meta_service> svc(new fake_sender_meta_service(this));
+    svc->_failure_detector.reset(new dsn::replication::meta_server_failure_detector(svc.get()));
+    ec = svc->remote_storage_initialize();
+    ASSERT_EQ(ec, dsn::ERR_OK);
+    svc->_balancer.reset(new simple_load_balancer(svc.get()));
+    // long enough to collect the updates of all partitions in a few batches
+    svc->_meta_opts.config_sync_batch_interval_ms = 100;
+    svc->_meta_opts.config_sync_batch_max_count = 8;
+
+    server_state *ss = svc->_state.get();
+    ss->initialize(svc.get(), meta_options::concat_path_unix_style(svc->_cluster_root, "apps"));
+    dsn::app_info info;
+    info.is_stateful = true;
+    info.status = dsn::app_status::AS_CREATING;
+    info.app_id = 1;
+    info.app_name = "simple_kv.instance0";
+    info.app_type = "simple_kv";
+    info.max_replica_count = 3;
+    info.partition_count = 32;
+    std::shared_ptr<app_state> app = app_state::create(info);
+
+    ss->_all_apps.emplace(1, app);
+
+    std::vector<dsn::rpc_address> nodes;
+    generate_node_list(nodes, 3, 3);
+
+    // all partitions fail over at once when the primary node dies
+    for (dsn::partition_configuration &pc : app->partitions) {
+        pc.primary = nodes[0];
+        pc.secondaries.push_back(nodes[1]);
+        pc.secondaries.push_back(nodes[2]);
+        pc.ballot = 3;
+    }
+
+    ss->sync_apps_to_remote_storage();
+    ASSERT_TRUE(ss->spin_wait_staging(30));
+    ss->initialize_node_state();
+    svc->set_node_state({nodes[0], nodes[1], nodes[2]}, true);
+    svc->_started = true;
+
+    dsn::rpc_address dead = nodes[0];
+    state_validator validator = [dead](const app_mapper &apps) {
+        for (const dsn::partition_configuration &pc : apps.find(1)->second->partitions) {
+            if (pc.primary.is_invalid() || pc.primary == dead || pc.secondaries.size() != 1)
+                return false;
+        }
+        return true;
+    };
+    svc->set_node_state({nodes[0]}, false);
+    ASSERT_TRUE(wait_state(ss, validator, 30));
+
+    // the remote storage agrees with the local state
+    std::vector<dsn::partition_configuration> local_configs;
+    {
+        zauto_read_lock l(ss->_lock);
+        local_configs = app->partitions;
+    }
+    for (const dsn::partition_configuration &local : local_configs) {
+        svc->get_remote_storage()
+            ->get_data(ss->get_partition_path(local.pid),
+                       LPC_META_STATE_HIGH,
+                       [&local](dsn::error_code ec, const dsn::blob &value) {
+                           ASSERT_EQ(dsn::ERR_OK, ec);
+                           dsn::partition_configuration remote;
+                           ASSERT_TRUE(
+                               dsn::json::json_forwarder<dsn::partition_configuration>::decode(
+                                   value, remote));
+                           ASSERT_EQ(local.ballot, remote.ballot);
+                           ASSERT_EQ(local.primary, remote.primary);
+                           ASSERT_EQ(local.secondaries, remote.secondaries);
+                       })
+            ->wait();
+    }
+}
+
 void meta_service_test_app::adjust_dropped_size()
 {
     dsn::error_code ec;
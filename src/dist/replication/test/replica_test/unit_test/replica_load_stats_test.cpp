@@ -0,0 +1,52 @@
+#include <gtest/gtest.h>
+#include "../../../lib/replica_load_stats.h"
+
+using namespace dsn::replication;
+
+TEST(replica_load_stats, latency_p99)
+{
+    replica_load_stats stats;
+    replica_load_stat stat;
+    stats.fetch_and_reset(stat);
+    ASSERT_EQ(0, stat.read_latency_p99_ns);
+
+    for (int i = 0; i < 99; i++) {
+        stats.on_read(100, 1000);
+    }
+    stats.on_read(100, 1000000);
+    // 1000 is in the bucket [992, 1023]
+    stats.fetch_and_reset(stat);
+    ASSERT_EQ(1023, stat.read_latency_p99_ns);
+
+    for (int i = 0; i < 98; i++) {
+        stats.on_read(100, 1000);
+    }
+    stats.on_read(100, 1000000);
+    stats.on_read(100, 1000000);
+    // the bucket of 1000000 is clipped by the max
+    stats.fetch_and_reset(stat);
+    ASSERT_EQ(1000000, stat.read_latency_p99_ns);
+}
+
+TEST(replica_load_stats, fetch_and_reset)
+{
+    replica_load_stats stats;
+    for (int i = 0; i < 10; i++) {
+        stats.on_read(100, 1000);
+        stats.on_write(200);
+        stats.on_write_committed(2000);
+    }
+
+    replica_load_stat stat;
+    stats.fetch_and_reset(stat);
+    ASSERT_GT(stat.read_qps, 0);
+    ASSERT_EQ(stat.read_qps, stat.write_qps);
+    ASSERT_GT(stat.write_bytes_per_sec, stat.read_bytes_per_sec);
+    ASSERT_EQ(1000, stat.read_latency_p99_ns);
+    ASSERT_EQ(2000, stat.write_latency_p99_ns);
+
+    stats.fetch_and_reset(stat);
+    ASSERT_EQ(0, stat.read_qps);
+    ASSERT_EQ(0, stat.write_bytes_per_sec);
+    ASSERT_EQ(0, stat.write_latency_p99_ns);
+}
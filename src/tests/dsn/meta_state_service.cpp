@@ -1,4 +1,5 @@
 #include <dsn/dist/meta_state_service.h>
+#include <dsn/utility/filesystem.h>
 #include <boost/lexical_cast.hpp>
 
 #include <gtest/gtest.h>
@@ -261,6 +262,92 @@ TEST(meta_state_service, simple)
     provider_recursively_create_delete_test(simple_service_creator, simple_service_deleter);
 }
 
+TEST(meta_state_service, simple_snapshot)
+{
+    const std::string work_dir = "./meta_state_service_simple_snapshot";
+    const int node_count = 64;
+    utils::filesystem::remove_path(work_dir);
+    ASSERT_TRUE(utils::filesystem::create_directory(work_dir));
+
+    auto make_data = [](int i, int size) {
+        std::shared_ptr<char> buffer(utils::make_shared_array<char>(size));
+        memset(buffer.get(), 'a' + i % 26, size);
+        return blob(buffer, size);
+    };
+    auto check_nodes = [&](meta_state_service_simple *svc, int step, int data_size) {
+        for (int i = 0; i < node_count; i += step) {
+            blob data = make_data(i + 1, data_size);
+            std::string expected(data.data(), data.length());
+            svc->get_data("/snapshot/" + boost::lexical_cast<std::string>(i),
+                          META_STATE_SERVICE_SIMPLE_TEST_CALLBACK,
+                          [&](error_code ec, const blob &value) {
+                              EXPECT_EQ(ERR_OK, ec);
+                              EXPECT_EQ(expected, std::string(value.data(), value.length()));
+                          })
+                ->wait();
+        }
+        svc->get_children("/snapshot",
+                          META_STATE_SERVICE_SIMPLE_TEST_CALLBACK,
+                          [&](error_code ec, const std::vector<std::string> &children) {
+                              EXPECT_EQ(ERR_OK, ec);
+                              EXPECT_EQ(node_count / step, (int)children.size());
+                          })
+            ->wait();
+    };
+    auto expect_ok = [](error_code ec) { EXPECT_EQ(ERR_OK, ec); };
+
+    // write about 3MB, which spans several 1MB log segments
+    meta_state_service_simple *svc = new meta_state_service_simple();
+    ASSERT_EQ(ERR_OK, svc->initialize({work_dir}));
+    svc->create_node("/snapshot", META_STATE_SERVICE_SIMPLE_TEST_CALLBACK, expect_ok)->wait();
+    for (int i = 0; i < node_count; ++i) {
+        svc->create_node("/snapshot/" + boost::lexical_cast<std::string>(i),
+                         META_STATE_SERVICE_SIMPLE_TEST_CALLBACK,
+                         expect_ok,
+                         make_data(i, 16 << 10))
+            ->wait();
+    }
+    for (int i = 0; i < node_count; ++i) {
+        svc->set_data("/snapshot/" + boost::lexical_cast<std::string>(i),
+                      make_data(i + 1, 32 << 10),
+                      META_STATE_SERVICE_SIMPLE_TEST_CALLBACK,
+                      expect_ok)
+            ->wait();
+    }
+    delete svc;
+
+    // the early segments are compacted into a snapshot
+    EXPECT_FALSE(utils::filesystem::file_exists(
+        utils::filesystem::path_combine(work_dir, "meta_state_service.log.0")));
+    std::vector<std::string> files;
+    ASSERT_TRUE(utils::filesystem::get_subfiles(work_dir, files, false));
+    int snapshot_count = 0;
+    for (auto &f : files) {
+        if (utils::filesystem::get_file_name(f).find("meta_state_service.snapshot.") == 0)
+            ++snapshot_count;
+    }
+    EXPECT_EQ(1, snapshot_count);
+
+    // the state is recovered from the snapshot and the remaining segments
+    svc = new meta_state_service_simple();
+    ASSERT_EQ(ERR_OK, svc->initialize({work_dir}));
+    check_nodes(svc, 1, 32 << 10);
+    for (int i = 1; i < node_count; i += 2) {
+        svc->delete_node("/snapshot/" + boost::lexical_cast<std::string>(i),
+                         false,
+                         META_STATE_SERVICE_SIMPLE_TEST_CALLBACK,
+                         expect_ok)
+            ->wait();
+    }
+    delete svc;
+
+    svc = new meta_state_service_simple();
+    ASSERT_EQ(ERR_OK, svc->initialize({work_dir}));
+    check_nodes(svc, 2, 32 << 10);
+    delete svc;
+    utils::filesystem::remove_path(work_dir);
+}
+
 TEST(meta_state_service, zookeeper)
 {
     auto zookeeper_service_creator = [] {
@@ -59,7 +59,8 @@ enum IDL
 enum Format
 {
     format_binary,
-    format_json
+    format_json,
+    format_compact // thrift only
 };
 
 std::string DSN_ROOT;
@@ -179,6 +180,38 @@ bool test_code_generation(Language lang, IDL idl, Format format)
     return result;
 }
 
+template <typename T>
+void marshall_thrift(dsn::binary_writer &writer, const T &val, Format fmt)
+{
+    switch (fmt) {
+    case format_binary:
+        dsn::marshall_thrift_binary(writer, val);
+        break;
+    case format_compact:
+        dsn::marshall_thrift_compact(writer, val);
+        break;
+    default:
+        dsn::marshall_thrift_json(writer, val);
+        break;
+    }
+}
+
+template <typename T>
+void unmarshall_thrift(dsn::binary_reader &reader, T &val, Format fmt)
+{
+    switch (fmt) {
+    case format_binary:
+        dsn::unmarshall_thrift_binary(reader, val);
+        break;
+    case format_compact:
+        dsn::unmarshall_thrift_compact(reader, val);
+        break;
+    default:
+        dsn::unmarshall_thrift_json(reader, val);
+        break;
+    }
+}
+
 template <typename T>
 void thrift_basic_type_serialization_checker(std::vector<T> &data, Format fmt)
 {
@@ -188,18 +221,10 @@ void thrift_basic_type_serialization_checker(std::vector<T> &data, Format fmt)
         T input = i;
         dsn::blob b(buf, 0, bufsize);
         dsn::binary_writer writer(b);
-        if (fmt == format_binary) {
-            dsn::marshall_thrift_binary(writer, input);
-        } else {
-            dsn::marshall_thrift_json(writer, input);
-        }
+        marshall_thrift(writer, input, fmt);
         dsn::binary_reader reader(b);
         T output;
-        if (fmt == format_binary) {
-            dsn::unmarshall_thrift_binary(reader, output);
-        } else {
-            dsn::unmarshall_thrift_json(reader, output);
-        }
+        unmarshall_thrift(reader, output, fmt);
         EXPECT_TRUE(input == output);
     }
 }
@@ -257,6 +282,32 @@ void test_thrift_basic_type_serialization(Format fmt)
     thrift_basic_type_serialization_checker(data_map_int32_str_t, fmt);
 }
 
+void test_thrift_builtin_type_serialization(Format fmt)
+{
+    std::vector<dsn::rpc_address> data_address_t{dsn::rpc_address("127.0.0.1", 34601),
+                                                 dsn::rpc_address("10.2.3.4", 65535)};
+    thrift_basic_type_serialization_checker(data_address_t, fmt);
+
+    std::vector<dsn::gpid> data_gpid_t{dsn::gpid(), dsn::gpid(1, 0), dsn::gpid(12345, 255)};
+    thrift_basic_type_serialization_checker(data_gpid_t, fmt);
+
+    std::vector<dsn::error_code> data_error_t{dsn::ERR_OK, dsn::ERR_TIMEOUT, dsn::ERR_UNKNOWN};
+    thrift_basic_type_serialization_checker(data_error_t, fmt);
+
+    // blob has no operator==
+    const int bufsize = 2000;
+    char buf[bufsize];
+    std::string data("hello\0world", 11);
+    dsn::blob input(data.data(), 0, static_cast<int>(data.size()));
+    dsn::blob b(buf, 0, bufsize);
+    dsn::binary_writer writer(b);
+    marshall_thrift(writer, input, fmt);
+    dsn::binary_reader reader(b);
+    dsn::blob output;
+    unmarshall_thrift(reader, output, fmt);
+    EXPECT_EQ(data, std::string(output.data(), output.length()));
+}
+
 void check_thrift_generated_type_serialization(const dsn::idl::test::test_thrift_item &input,
                                                Format fmt)
 {
@@ -264,18 +315,10 @@ void check_thrift_generated_type_serialization(const dsn::idl::test::test_thrift
     char buf[bufsize];
     dsn::blob b(buf, 0, bufsize);
     dsn::binary_writer writer(b);
-    if (fmt == format_binary) {
-        dsn::marshall_thrift_binary(writer, input);
-    } else {
-        dsn::marshall_thrift_json(writer, input);
-    }
+    marshall_thrift(writer, input, fmt);
     dsn::binary_reader reader(b);
     dsn::idl::test::test_thrift_item output;
-    if (fmt == format_binary) {
-        dsn::unmarshall_thrift_binary(reader, output);
-    } else {
-        dsn::unmarshall_thrift_json(reader, output);
-    }
+    unmarshall_thrift(reader, output, fmt);
     EXPECT_EQ(input.bool_item, output.bool_item);
     EXPECT_EQ(input.byte_item, output.byte_item);
     EXPECT_EQ(input.i16_item, output.i16_item);
@@ -433,6 +476,23 @@ TEST(thrift_helper, cpp_json_generated_type_serialization)
     test_thrift_generated_type_serialization(format_json);
 }
 
+TEST(thrift_helper, cpp_compact_basic_type_serialization)
+{
+    test_thrift_basic_type_serialization(format_compact);
+}
+
+TEST(thrift_helper, cpp_compact_generated_type_serialization)
+{
+    test_thrift_generated_type_serialization(format_compact);
+}
+
+TEST(thrift_helper, cpp_builtin_type_serialization)
+{
+    test_thrift_builtin_type_serialization(format_binary);
+    test_thrift_builtin_type_serialization(format_compact);
+    test_thrift_builtin_type_serialization(format_json);
+}
+
 TEST(thrift_helper, cpp_binary_code_generation)
 {
     EXPECT_TRUE(test_code_generation(lang_cpp, idl_thrift, format_binary));